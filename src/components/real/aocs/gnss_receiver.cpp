@@ -75,7 +75,9 @@ void GnssReceiver::MainRoutine(const int time_count) {
 
   // Time is updated with internal clock
   utc_ = simulation_time_->GetCurrentUtc();
-  ConvertJulianDayToGpsTime(simulation_time_->GetCurrentTime_jd());
+  const time_system::GpsTime& gps_time = simulation_time_->GetCurrentGpsTime();
+  gps_time_week_ = (unsigned int)gps_time.GetWeek();
+  gps_time_s_ = gps_time.GetElapsedTimeFromWeek_s();
 }
 
 void GnssReceiver::CheckAntenna(const math::Vector<3> position_true_eci_m, const math::Quaternion quaternion_i2b) {
@@ -119,43 +121,17 @@ void GnssReceiver::CheckAntennaCone(const math::Vector<3> position_true_eci_m, c
   // Antenna position vector at inertial frame
   math::Vector<3> antenna_position_i_m = position_true_eci_m + quaternion_i2b.InverseFrameConversion(antenna_position_b_m_);
 
-  // initialize
-  visible_satellite_number_ = 0;
-
-  size_t number_of_calculated_gnss_satellites = gnss_satellites_->GetNumberOfCalculatedSatellite();
-
-  for (size_t i = 0; i < number_of_calculated_gnss_satellites; i++) {
-    // compute direction from sat to gnss in body-fixed frame
-    math::Vector<3> gnss_satellite_position_i_m = gnss_satellites_->GetPosition_eci_m(i);
-    math::Vector<3> antenna_to_gnss_satellite_i_m = gnss_satellite_position_i_m - antenna_position_i_m;
-    math::Vector<3> antenna_to_gnss_satellite_direction_i = antenna_to_gnss_satellite_i_m.CalcNormalizedVector();
-
-    // Check GNSS satellites are visible from the receiver(not care antenna direction)
-    bool is_gnss_satellite_visible_from_receiver = false;
-    double inner1 = InnerProduct(antenna_position_i_m, gnss_satellite_position_i_m);
-    if (inner1 > 0.0) {  // GNSS satellite and receiver are in the same hemisphere
-      is_gnss_satellite_visible_from_receiver = true;
-    } else {  // GNSS satellite is in the another hemisphere
-      double angle_bw_earth_center_and_edge_rad = asin(environment::earth_equatorial_radius_m / antenna_position_i_m.CalcNorm());
-      double angle_bw_earth_center_and_gnss_rad =
-          acos(InnerProduct(-antenna_position_i_m.CalcNormalizedVector(), antenna_to_gnss_satellite_direction_i));
-
-      if (angle_bw_earth_center_and_edge_rad < angle_bw_earth_center_and_gnss_rad) {
-        // There is no Earth between receiver and GNSS satellite
-        is_gnss_satellite_visible_from_receiver = true;
-      } else {
-        // There is Earth between receiver and GNSS satellite
-        is_gnss_satellite_visible_from_receiver = false;
-      }
-    }
-
-    // Check GNSS satellites are in the antenna half width angle
-    double inner2 = InnerProduct(antenna_pointing_direction_i, antenna_to_gnss_satellite_direction_i);
-    if (inner2 > cos(half_width_deg_ * math::deg_to_rad) && is_gnss_satellite_visible_from_receiver) {
-      // is visible
-      visible_satellite_number_++;
-      SetGnssInfo(antenna_to_gnss_satellite_i_m, quaternion_i2b, i);
-    }
+  // Geometry of all satellites
+  // The satellite positions, velocities and clocks in the inertial frame are shared by all receivers
+  observation_geometry_.Update(antenna_position_i_m, gnss_satellites_->GetPositions_eci_m(), gnss_satellites_->GetVelocities_eci_m_s(),
+                               gnss_satellites_->GetClockOffsets_s());
+  visible_satellite_number_ =
+      observation_geometry_.CalcVisibility(environment::earth_equatorial_radius_m, antenna_pointing_direction_i, half_width_deg_ * math::deg_to_rad);
+
+  // The frame conversion to the antenna frame is shared by all visible satellites
+  const math::Matrix<3, 3> dcm_i2c = quaternion_b2c_.ConvertToDcm() * quaternion_i2b.ConvertToDcm();
+  for (size_t i = 0; i < observation_geometry_.GetNumberOfSatellites(); i++) {
+    if (observation_geometry_.IsVisible(i)) SetGnssInfo(dcm_i2c, i);
   }
 
   if (visible_satellite_number_ >= 4) {
@@ -165,17 +141,16 @@ void GnssReceiver::CheckAntennaCone(const math::Vector<3> position_true_eci_m, c
   }
 }
 
-void GnssReceiver::SetGnssInfo(const math::Vector<3> antenna_to_satellite_i_m, const math::Quaternion quaternion_i2b,
-                               const std::size_t gnss_system_id) {
-  math::Vector<3> antenna_to_satellite_direction_b = quaternion_i2b.FrameConversion(antenna_to_satellite_i_m);
-  math::Vector<3> antenna_to_satellite_direction_c = quaternion_b2c_.FrameConversion(antenna_to_satellite_direction_b);
+void GnssReceiver::SetGnssInfo(const math::Matrix<3, 3>& dcm_i2c, const std::size_t gnss_system_id) {
+  math::Vector<3> antenna_to_satellite_direction_c = dcm_i2c * observation_geometry_.GetLineOfSight_m(gnss_system_id);
 
-  double distance_m = antenna_to_satellite_i_m.CalcNorm();
+  double distance_m = observation_geometry_.GetGeometricDistance_m(gnss_system_id);
   double longitude_rad = AcTan(antenna_to_satellite_direction_c[1], antenna_to_satellite_direction_c[0]);
-  double latitude_rad =
-      AcTan(antenna_to_satellite_direction_c[2], sqrt(pow(antenna_to_satellite_direction_c[0], 2.0) + pow(antenna_to_satellite_direction_c[1], 2.0)));
+  double latitude_rad = AcTan(antenna_to_satellite_direction_c[2], sqrt(antenna_to_satellite_direction_c[0] * antenna_to_satellite_direction_c[0] +
+                                                                        antenna_to_satellite_direction_c[1] * antenna_to_satellite_direction_c[1]));
 
-  GnssInfo gnss_info_new = {gnss_system_id, latitude_rad, longitude_rad, distance_m};
+  GnssInfo gnss_info_new = {gnss_system_id, latitude_rad, longitude_rad, distance_m, observation_geometry_.GetRange_m(gnss_system_id),
+                            observation_geometry_.GetPseudorange_m(gnss_system_id)};
   gnss_information_list_.push_back(gnss_info_new);
 }
 
@@ -186,18 +161,6 @@ void GnssReceiver::AddNoise(const math::Vector<3> position_true_ecef_m, const ma
   }
 }
 
-void GnssReceiver::ConvertJulianDayToGpsTime(const double julian_day) {
-  const double kJulianDayAtGpsTimeZero = 2444244.5;  // corresponds to 1980/1/5 midnight
-  const double kDayInWeek = 7.0;
-  const double kSecInDay = 86400.0;
-
-  // compute time of week from current julian_day
-  // note:"gps_time_week_ " computed in this method is larger than 1024
-  double elapsed_day = julian_day - kJulianDayAtGpsTimeZero;
-  gps_time_week_ = (unsigned int)(elapsed_day / kDayInWeek);
-  gps_time_s_ = (elapsed_day - (double)(gps_time_week_)*kDayInWeek) * kSecInDay;
-}
-
 std::string GnssReceiver::GetLogHeader() const  // For logs
 {
   std::string str_tmp = "";
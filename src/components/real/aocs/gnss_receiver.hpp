@@ -11,6 +11,7 @@
 #include <environment/global/simulation_time.hpp>
 #include <logger/loggable.hpp>
 #include <math_physics/geodesy/geodetic_position.hpp>
+#include <math_physics/gnss/gnss_observation_geometry.hpp>
 #include <math_physics/math/quaternion.hpp>
 #include <math_physics/randomization/normal_randomization.hpp>
 
@@ -35,7 +36,9 @@ typedef struct _gnss_info {
   size_t gnss_id;        //!< ID of GNSS satellites
   double latitude_rad;   //!< Latitude on the antenna frame [rad]
   double longitude_rad;  //!< Longitude on the antenna frame [rad]
-  double distance_m;     //!< Distance between the GNSS satellite and the GNSS receiver antenna [m]
+  double distance_m;     //!< Distance between the GNSS satellite and the GNSS receiver antenna at the reception time [m]
+  double range_m;        //!< Geometric range with the light time correction [m]
+  double pseudorange_m;  //!< Pseudorange without noise, ionosphere and troposphere [m]
 } GnssInfo;
 
 /**
@@ -152,9 +155,10 @@ class GnssReceiver : public Component, public logger::ILoggable {
   double gps_time_s_ = 0.0;                         //!< Observed GPS time second part
 
   // Satellite visibility
-  bool is_gnss_visible_ = false;                 //!< Flag for GNSS satellite is visible or not
-  size_t visible_satellite_number_ = 0;          //!< Number of visible GNSS satellites
-  std::vector<GnssInfo> gnss_information_list_;  //!< Information List of visible GNSS satellites
+  bool is_gnss_visible_ = false;                        //!< Flag for GNSS satellite is visible or not
+  size_t visible_satellite_number_ = 0;                 //!< Number of visible GNSS satellites
+  std::vector<GnssInfo> gnss_information_list_;         //!< Information List of visible GNSS satellites
+  gnss::GnssObservationGeometry observation_geometry_;  //!< Geometry between the antenna and all GNSS satellites
 
   // References
   const dynamics::Dynamics* dynamics_;                  //!< Dynamics of spacecraft
@@ -189,11 +193,10 @@ class GnssReceiver : public Component, public logger::ILoggable {
   /**
    * @fn SetGnssInfo
    * @brief Calculate and set the GnssInfo values of target GNSS satellite
-   * @param [in] antenna_to_satellite_i_m: Position vector from the antenna to the GNSS satellites in the ECI frame
-   * @param [in] quaternion_i2b: True attitude of the spacecraft expressed by quaternion from the inertial frame to the body-fixed frame
+   * @param [in] dcm_i2c: Direction cosine matrix from the inertial frame to the component frame
    * @param [in] gnss_system_id: ID of target GNSS satellite
    */
-  void SetGnssInfo(const math::Vector<3> antenna_to_satellite_i_m, const math::Quaternion quaternion_i2b, const size_t gnss_system_id);
+  void SetGnssInfo(const math::Matrix<3, 3>& dcm_i2c, const size_t gnss_system_id);
   /**
    * @fn AddNoise
    * @brief Substitutional method for "Measure" in other sensor models inherited Sensor class
@@ -201,12 +204,6 @@ class GnssReceiver : public Component, public logger::ILoggable {
    * @param [in] velocity_true_ecef_m_s: True velocity of the spacecraft in the ECEF frame [m/s]
    */
   void AddNoise(const math::Vector<3> position_true_ecef_m, const math::Vector<3> velocity_true_ecef_m_s);
-  /**
-   * @fn ConvertJulianDayToGpsTime
-   * @brief Convert Julian day to GPS time
-   * @param [in] julian_day: Julian day
-   */
-  void ConvertJulianDayToGpsTime(const double julian_day);
 };
 
 /**
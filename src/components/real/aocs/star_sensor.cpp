@@ -131,10 +131,11 @@ void StarSensor::update(const environment::LocalCelestialInformation* local_cele
 
 void StarSensor::AllJudgement(const environment::LocalCelestialInformation* local_celestial_information,
                               const dynamics::attitude::Attitude* attitude) {
+  const environment::CelestialInformation& celestial_information = local_celestial_information->GetGlobalInformation();
   int judgement = 0;
-  judgement = SunJudgement(local_celestial_information->GetPositionFromSpacecraft_b_m("SUN"));
-  judgement += EarthJudgement(local_celestial_information->GetPositionFromSpacecraft_b_m("EARTH"));
-  judgement += MoonJudgement(local_celestial_information->GetPositionFromSpacecraft_b_m("MOON"));
+  judgement = SunJudgement(local_celestial_information->GetPositionFromSpacecraft_b_m(celestial_information.GetSunId()));
+  judgement += EarthJudgement(local_celestial_information->GetPositionFromSpacecraft_b_m(celestial_information.GetEarthId()));
+  judgement += MoonJudgement(local_celestial_information->GetPositionFromSpacecraft_b_m(celestial_information.GetMoonId()));
   judgement += CaptureRateJudgement(attitude->GetAngularVelocity_b_rad_s());
   if (judgement > 0)
     error_flag_ = true;
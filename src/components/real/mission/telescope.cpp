@@ -67,14 +67,18 @@ Telescope::~Telescope() {}
 
 void Telescope::MainRoutine(const int time_count) {
   UNUSED(time_count);
+  const environment::CelestialInformation& celestial_information = local_celestial_information_->GetGlobalInformation();
+  const math::Vector<3> sun_position_b_m = local_celestial_information_->GetPositionFromSpacecraft_b_m(celestial_information.GetSunId());
+  const math::Vector<3> earth_position_b_m = local_celestial_information_->GetPositionFromSpacecraft_b_m(celestial_information.GetEarthId());
+  const math::Vector<3> moon_position_b_m = local_celestial_information_->GetPositionFromSpacecraft_b_m(celestial_information.GetMoonId());
   // Check forbidden angle
-  is_sun_in_forbidden_angle = JudgeForbiddenAngle(local_celestial_information_->GetPositionFromSpacecraft_b_m("SUN"), sun_forbidden_angle_rad_);
-  is_earth_in_forbidden_angle = JudgeForbiddenAngle(local_celestial_information_->GetPositionFromSpacecraft_b_m("EARTH"), earth_forbidden_angle_rad_);
-  is_moon_in_forbidden_angle = JudgeForbiddenAngle(local_celestial_information_->GetPositionFromSpacecraft_b_m("MOON"), moon_forbidden_angle_rad_);
+  is_sun_in_forbidden_angle = JudgeForbiddenAngle(sun_position_b_m, sun_forbidden_angle_rad_);
+  is_earth_in_forbidden_angle = JudgeForbiddenAngle(earth_position_b_m, earth_forbidden_angle_rad_);
+  is_moon_in_forbidden_angle = JudgeForbiddenAngle(moon_position_b_m, moon_forbidden_angle_rad_);
   // Position calculation of celestial bodies from CelesInfo
-  Observe(sun_position_image_sensor, local_celestial_information_->GetPositionFromSpacecraft_b_m("SUN"));
-  Observe(earth_position_image_sensor, local_celestial_information_->GetPositionFromSpacecraft_b_m("EARTH"));
-  Observe(moon_position_image_sensor, local_celestial_information_->GetPositionFromSpacecraft_b_m("MOON"));
+  Observe(sun_position_image_sensor, sun_position_b_m);
+  Observe(earth_position_image_sensor, earth_position_b_m);
+  Observe(moon_position_image_sensor, moon_position_b_m);
   // Position calculation of stars from Hipparcos Catalogue
   // No update when Hipparcos Catalogue was not read
   if (hipparcos_->IsCalcEnabled) ObserveStars();
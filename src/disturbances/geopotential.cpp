@@ -49,24 +49,10 @@ Geopotential::Geopotential(const int degree, const std::string file_path, const
 }
 
 bool Geopotential::ReadCoefficientsEgm96(std::string file_name) {
-  std::ifstream coeff_file(file_name);
-  if (!coeff_file.is_open()) {
+  if (!gravity::ReadCoefficientsEgm96(file_name, degree_, c_, s_)) {
     std::cerr << "File open error: Geopotential\n";
     return false;
   }
-
-  size_t num_coeff = ((degree_ + 1) * (degree_ + 2) / 2) - 3;  //-3 for C00,C10,C11
-  for (size_t i = 0; i < num_coeff; i++) {
-    int n, m;
-    double c_nm_norm, s_nm_norm;
-    std::string line;
-    getline(coeff_file, line);
-    std::istringstream streamline(line);
-    streamline >> n >> m >> c_nm_norm >> s_nm_norm;
-
-    c_[n][m] = c_nm_norm;
-    s_[n][m] = s_nm_norm;
-  }
   return true;
 }
 
@@ -19,7 +19,9 @@ SolarRadiationPressureDisturbance::SolarRadiationPressureDisturbance(const std::
 void SolarRadiationPressureDisturbance::Update(const environment::LocalEnvironment& local_environment, const dynamics::Dynamics& dynamics) {
   UNUSED(dynamics);
 
-  math::Vector<3> sun_position_from_sc_b_m = local_environment.GetCelestialInformation().GetPositionFromSpacecraft_b_m("SUN");
+  const environment::LocalCelestialInformation& local_celestial_information = local_environment.GetCelestialInformation();
+  const unsigned int sun_id = local_celestial_information.GetGlobalInformation().GetSunId();
+  math::Vector<3> sun_position_from_sc_b_m = local_celestial_information.GetPositionFromSpacecraft_b_m(sun_id);
   CalcTorqueForce(sun_position_from_sc_b_m, local_environment.GetSolarRadiationPressure().GetPressure_N_m2());
 }
 
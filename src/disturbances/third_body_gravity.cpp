@@ -19,11 +19,20 @@ ThirdBodyGravity::~ThirdBodyGravity() {}
 void ThirdBodyGravity::Update(const environment::LocalEnvironment& local_environment, const dynamics::Dynamics& dynamics) {
   acceleration_i_m_s2_ = math::Vector<3>(0.0);  // initialize
 
+  const environment::LocalCelestialInformation& local_celestial_information = local_environment.GetCelestialInformation();
+  // Resolve the IDs of the third bodies once
+  if (third_body_id_list_.size() != third_body_list_.size()) {
+    third_body_id_list_.clear();
+    for (auto third_body : third_body_list_) {
+      third_body_id_list_.push_back(local_celestial_information.GetGlobalInformation().CalcBodyIdFromName(third_body.c_str()));
+    }
+  }
+
   math::Vector<3> sc_position_i_m = dynamics.GetOrbit().GetPosition_i_m();
-  for (auto third_body : third_body_list_) {
-    math::Vector<3> third_body_position_from_sc_i_m = local_environment.GetCelestialInformation().GetPositionFromSpacecraft_i_m(third_body.c_str());
+  for (auto third_body_id : third_body_id_list_) {
+    math::Vector<3> third_body_position_from_sc_i_m = local_celestial_information.GetPositionFromSpacecraft_i_m(third_body_id);
     math::Vector<3> third_body_pos_i_m = sc_position_i_m + third_body_position_from_sc_i_m;
-    double gravity_constant = local_environment.GetCelestialInformation().GetGlobalInformation().GetGravityConstant_m3_s2(third_body.c_str());
+    double gravity_constant = local_celestial_information.GetGlobalInformation().GetGravityConstant_m3_s2(third_body_id);
 
     third_body_acceleration_i_m_s2_ = CalcAcceleration_i_m_s2(third_body_pos_i_m, third_body_position_from_sc_i_m, gravity_constant);
     acceleration_i_m_s2_ += third_body_acceleration_i_m_s2_;
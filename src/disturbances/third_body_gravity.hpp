@@ -9,6 +9,7 @@
 #include <cassert>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "../logger/loggable.hpp"
 #include "../math_physics/math/vector.hpp"
@@ -45,6 +46,7 @@ class ThirdBodyGravity : public Disturbance {
 
  private:
   std::set<std::string> third_body_list_;                //!< List of celestial bodies to calculate the third body disturbances
+  std::vector<unsigned int> third_body_id_list_;         //!< ID list of CelestialInformation list for the third bodies
   math::Vector<3> third_body_acceleration_i_m_s2_{0.0};  //!< Calculated third body disturbance acceleration in the inertial frame [m/s2]
 
   // Override classes for logger::ILoggable
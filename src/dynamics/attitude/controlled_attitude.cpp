@@ -78,19 +78,20 @@ void ControlledAttitude::Propagate(const double end_time_s) {
 
 math::Vector<3> ControlledAttitude::CalcTargetDirection_i(AttitudeControlMode mode) {
   math::Vector<3> direction;
+  const environment::CelestialInformation& celestial_information = local_celestial_information_->GetGlobalInformation();
   if (mode == AttitudeControlMode::kSunPointing) {
-    direction = local_celestial_information_->GetPositionFromSpacecraft_i_m("SUN");
+    direction = local_celestial_information_->GetPositionFromSpacecraft_i_m(celestial_information.GetSunId());
     // When the local_celestial_information is not initialized. FIXME: This is temporary codes for attitude initialize.
     if (direction.CalcNorm() == 0.0) {
-      math::Vector<3> sun_position_i_m = local_celestial_information_->GetGlobalInformation().GetPositionFromCenter_i_m("SUN");
+      math::Vector<3> sun_position_i_m = celestial_information.GetPositionFromCenter_i_m(celestial_information.GetSunId());
       math::Vector<3> spacecraft_position_i_m = orbit_->GetPosition_i_m();
       direction = sun_position_i_m - spacecraft_position_i_m;
     }
   } else if (mode == AttitudeControlMode::kEarthCenterPointing) {
-    direction = local_celestial_information_->GetPositionFromSpacecraft_i_m("EARTH");
+    direction = local_celestial_information_->GetPositionFromSpacecraft_i_m(celestial_information.GetEarthId());
     // When the local_celestial_information is not initialized. FIXME: This is temporary codes for attitude initialize.
     if (direction.CalcNorm() == 0.0) {
-      math::Vector<3> earth_position_i_m = local_celestial_information_->GetGlobalInformation().GetPositionFromCenter_i_m("EARTH");
+      math::Vector<3> earth_position_i_m = celestial_information.GetPositionFromCenter_i_m(celestial_information.GetEarthId());
       math::Vector<3> spacecraft_position_i_m = orbit_->GetPosition_i_m();
       direction = earth_position_i_m - spacecraft_position_i_m;
     }
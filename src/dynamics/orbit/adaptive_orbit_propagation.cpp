@@ -0,0 +1,114 @@
+/**
+ * @file adaptive_orbit_propagation.cpp
+ * @brief Class to propagate spacecraft orbit with the adaptive step width Dormand-Prince method
+ */
+#include "adaptive_orbit_propagation.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <utilities/macros.hpp>
+
+namespace s2e::dynamics::orbit {
+
+AdaptiveOrbitPropagation::AdaptiveOrbitPropagation(const environment::CelestialInformation* celestial_information,
+                                                   const double gravity_constant_m3_s2, const double initial_step_width_s,
+                                                   const double maximum_step_width_s, const double error_tolerance,
+                                                   const math::Vector<3> position_i_m, const math::Vector<3> velocity_i_m_s,
+                                                   const double initial_time_s, const gravity::GravityPotential& geopotential)
+    : Orbit(celestial_information),
+      gravity_constant_m3_s2_(gravity_constant_m3_s2),
+      maximum_step_width_s_(maximum_step_width_s),
+      error_tolerance_(error_tolerance),
+      geopotential_(geopotential),
+      step_acceleration_i_m_s2_(0.0),
+      dcm_i_to_ecef_(celestial_information->GetEarthRotation().GetDcmJ2000ToEcef()),
+      integrator_(initial_step_width_s, *this),
+      propagation_time_s_(initial_time_s),
+      next_step_width_s_(std::min(initial_step_width_s, maximum_step_width_s)) {
+  propagate_mode_ = OrbitPropagateMode::kAdaptive;
+
+  spacecraft_acceleration_i_m_s2_ *= 0;
+  spacecraft_position_i_m_ = position_i_m;
+  spacecraft_velocity_i_m_s_ = velocity_i_m_s;
+  Restart();
+
+  TransformEciToEcef();
+  TransformEcefToGeodetic();
+}
+
+AdaptiveOrbitPropagation::~AdaptiveOrbitPropagation() {}
+
+math::Vector<6> AdaptiveOrbitPropagation::DerivativeFunction(const double time_s, const math::Vector<6>& state) const {
+  UNUSED(time_s);
+
+  const double r3 = pow(state[0] * state[0] + state[1] * state[1] + state[2] * state[2], 1.5);
+
+  math::Vector<3> acceleration_i_m_s2 = step_acceleration_i_m_s2_;
+  if (geopotential_.GetDegree() > 0) {
+    math::Vector<3> position_i_m;
+    for (size_t i = 0; i < 3; i++) position_i_m[i] = state[i];
+    acceleration_i_m_s2 += dcm_i_to_ecef_.Transpose() * geopotential_.CalcAcceleration_xcxf_m_s2(dcm_i_to_ecef_ * position_i_m);
+  }
+
+  math::Vector<6> rhs;
+  for (size_t i = 0; i < 3; i++) {
+    rhs[i] = state[i + 3];
+    rhs[i + 3] = acceleration_i_m_s2[i] - gravity_constant_m3_s2_ / r3 * state[i];
+  }
+  return rhs;
+}
+
+void AdaptiveOrbitPropagation::Propagate(const double end_time_s, const double current_time_jd) {
+  UNUSED(current_time_jd);
+
+  if (!is_calc_enabled_) return;
+  if (end_time_s <= propagation_time_s_) return;
+
+  // The acceleration change is negligible when the position deviation by holding the previous acceleration until the step end is within the tolerance
+  const double remaining_time_s = std::max(integrator_.GetIndependentVariable(), end_time_s) - propagation_time_s_;
+  const double acceleration_change_m_s2 = (spacecraft_acceleration_i_m_s2_ - step_acceleration_i_m_s2_).CalcNorm();
+  if (0.5 * acceleration_change_m_s2 * remaining_time_s * remaining_time_s > error_tolerance_) {
+    Restart();
+    // Frequent acceleration changes (e.g. thruster maneuver) are followed with steps up to the update period
+    next_step_width_s_ = std::min(next_step_width_s_, end_time_s - propagation_time_s_);
+  }
+
+  // The earth rotation within a step is neglected since the zonal terms, which do not change with the rotation, are dominant
+  dcm_i_to_ecef_ = celestial_information_->GetEarthRotation().GetDcmJ2000ToEcef();
+
+  // Integrate until the latest step covers the end time
+  while (integrator_.GetIndependentVariable() < end_time_s) {
+    step_acceleration_i_m_s2_ = spacecraft_acceleration_i_m_s2_;
+    integrator_.SetStepWidth(next_step_width_s_);
+    if (!integrator_.IntegrateWithStepControl(error_tolerance_)) {
+      std::cout << "[Warning] AdaptiveOrbitPropagation: the local truncation error exceeds the tolerance." << std::endl;
+    }
+    next_step_width_s_ = std::min(integrator_.CalcOptimalStepWidth(error_tolerance_), maximum_step_width_s_);
+  }
+
+  // Dense output interpolation in the latest step
+  const double step_width_s = integrator_.GetStepWidth();
+  const double step_start_time_s = integrator_.GetIndependentVariable() - step_width_s;
+  const math::Vector<6> state = integrator_.CalcInterpolationState((end_time_s - step_start_time_s) / step_width_s);
+  propagation_time_s_ = end_time_s;
+
+  for (size_t i = 0; i < 3; i++) {
+    spacecraft_position_i_m_[i] = state[i];
+    spacecraft_velocity_i_m_s_[i] = state[i + 3];
+  }
+
+  TransformEciToEcef();
+  TransformEcefToGeodetic();
+}
+
+void AdaptiveOrbitPropagation::Restart() {
+  math::Vector<6> state;
+  for (size_t i = 0; i < 3; i++) {
+    state[i] = spacecraft_position_i_m_[i];
+    state[i + 3] = spacecraft_velocity_i_m_s_[i];
+  }
+  integrator_.SetState(propagation_time_s_, state);
+  step_acceleration_i_m_s2_ = spacecraft_acceleration_i_m_s2_;
+}
+
+}  // namespace s2e::dynamics::orbit
@@ -0,0 +1,94 @@
+/**
+ * @file adaptive_orbit_propagation.hpp
+ * @brief Class to propagate spacecraft orbit with the adaptive step width Dormand-Prince method
+ */
+
+#ifndef S2E_DYNAMICS_ORBIT_ADAPTIVE_ORBIT_PROPAGATION_HPP_
+#define S2E_DYNAMICS_ORBIT_ADAPTIVE_ORBIT_PROPAGATION_HPP_
+
+#include <environment/global/celestial_information.hpp>
+#include <math_physics/gravity/gravity_potential.hpp>
+#include <math_physics/numerical_integration/dormand_prince_5.hpp>
+#include <math_physics/numerical_integration/interface_ode.hpp>
+
+#include "orbit.hpp"
+
+namespace s2e::dynamics::orbit {
+
+/**
+ * @class AdaptiveOrbitPropagation
+ * @brief Class to propagate spacecraft orbit with the adaptive step width Dormand-Prince method
+ * @note The integrator takes error controlled steps which can be longer than the orbit update period, and the state at the simulation time is
+ *       calculated with the dense output interpolation. The external acceleration is held constant in each step. When the acceleration changes
+ *       significantly within the current step (e.g. thruster maneuver), the integration is restarted from the current state.
+ * @note The two body gravity and the geopotential of the central body are evaluated in the integration steps. The other disturbances are
+ *       still calculated once per update period by the simulation and given as the external acceleration, so the long steps are effective
+ *       only when their change is small (e.g. drag or SRP). The geopotential disturbance must be disabled when the geopotential is given here,
+ *       otherwise it is counted twice.
+ */
+class AdaptiveOrbitPropagation : public Orbit, public numerical_integration::InterfaceOde<6> {
+ public:
+  /**
+   * @fn AdaptiveOrbitPropagation
+   * @brief Constructor
+   * @param [in] celestial_information: Celestial information
+   * @param [in] gravity_constant_m3_s2: Gravity constant [m3/s2]
+   * @param [in] initial_step_width_s: Initial step width [sec]
+   * @param [in] maximum_step_width_s: Maximum step width [sec]
+   * @param [in] error_tolerance: Tolerance of the local truncation error of the position and velocity vector
+   * @param [in] position_i_m: Initial value of position in the inertial frame [m]
+   * @param [in] velocity_i_m_s: Initial value of velocity in the inertial frame [m/s]
+   * @param [in] initial_time_s: Initial time [sec]
+   * @param [in] geopotential: Geopotential of the central body evaluated in the integration steps. The default has no high-order term.
+   */
+  AdaptiveOrbitPropagation(const environment::CelestialInformation* celestial_information, const double gravity_constant_m3_s2,
+                           const double initial_step_width_s, const double maximum_step_width_s, const double error_tolerance,
+                           const math::Vector<3> position_i_m, const math::Vector<3> velocity_i_m_s, const double initial_time_s = 0.0,
+                           const gravity::GravityPotential& geopotential = gravity::GravityPotential());
+  /**
+   * @fn ~AdaptiveOrbitPropagation
+   * @brief Destructor
+   */
+  ~AdaptiveOrbitPropagation();
+
+  // Override InterfaceOde
+  /**
+   * @fn DerivativeFunction
+   * @brief Right Hand Side of ordinary difference equation
+   * @param [in] time_s: Time as independent variable [sec]
+   * @param [in] state: Position and velocity as state vector
+   * @return Differentiated value of state vector
+   */
+  virtual math::Vector<6> DerivativeFunction(const double time_s, const math::Vector<6>& state) const;
+
+  // Override Orbit
+  /**
+   * @fn Propagate
+   * @brief Propagate orbit
+   * @param [in] end_time_s: End time of simulation [sec]
+   * @param [in] current_time_jd: Current Julian day [day]
+   */
+  virtual void Propagate(const double end_time_s, const double current_time_jd);
+
+ private:
+  const double gravity_constant_m3_s2_;           //!< Gravity constant [m3/s2]
+  const double maximum_step_width_s_;             //!< Maximum step width [sec]
+  const double error_tolerance_;                  //!< Tolerance of the local truncation error
+  const gravity::GravityPotential geopotential_;  //!< Geopotential of the central body evaluated in the integration steps
+
+  math::Vector<3> step_acceleration_i_m_s2_;             //!< External acceleration held in the current step [m/s2]
+  math::Matrix<3, 3> dcm_i_to_ecef_;                     //!< Earth orientation held in the current propagation for the geopotential
+  numerical_integration::DormandPrince5<6> integrator_;  //!< Numerical integrator
+  double propagation_time_s_;                            //!< Time of the current position and velocity [sec]
+  double next_step_width_s_;                             //!< Step width for the next integration step [sec]
+
+  /**
+   * @fn Restart
+   * @brief Restart the integration from the current position and velocity with the current external acceleration
+   */
+  void Restart();
+};
+
+}  // namespace s2e::dynamics::orbit
+
+#endif  // S2E_DYNAMICS_ORBIT_ADAPTIVE_ORBIT_PROPAGATION_HPP_
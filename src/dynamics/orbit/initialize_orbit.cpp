@@ -4,8 +4,11 @@
  */
 #include "initialize_orbit.hpp"
 
+#include <algorithm>
+#include <iostream>
 #include <setting_file_reader/initialize_file_access.hpp>
 
+#include "adaptive_orbit_propagation.hpp"
 #include "encke_orbit_propagation.hpp"
 #include "kepler_orbit_propagation.hpp"
 #include "relative_orbit.hpp"
@@ -110,6 +113,32 @@ Orbit* InitOrbit(const environment::CelestialInformation* celestial_information,
     orbit = new TimeSeriesFileOrbitPropagation(celestial_information, time_series_file_path, number_of_interpolation, interpolation_method,
                                                orbital_period_correction_s, current_time_jd);
 
+  } else if (propagate_mode == "ADAPTIVE") {
+    // initialize orbit for adaptive step width propagation
+    math::Vector<3> position_i_m;
+    math::Vector<3> velocity_i_m_s;
+    math::Vector<6> pos_vel = InitializePosVel(initialize_file, current_time_jd, gravity_constant_m3_s2);
+    for (size_t i = 0; i < 3; i++) {
+      position_i_m[i] = pos_vel[i];
+      velocity_i_m_s[i] = pos_vel[i + 3];
+    }
+
+    const double error_tolerance = conf.ReadDouble(section_, "adaptive_error_tolerance");
+    const double maximum_step_width_s = conf.ReadDouble(section_, "adaptive_maximum_step_width_s");
+    // Geopotential evaluated in the integration steps
+    const size_t geopotential_degree = (size_t)std::clamp(conf.ReadInt(section_, "adaptive_geopotential_degree"), 0, 360);  // EGM96 limit
+    gravity::GravityPotential geopotential;
+    if (geopotential_degree >= 2) {
+      const std::string coefficients_file_path = conf.ReadString(section_, "adaptive_geopotential_coefficients_file_path");
+      std::vector<std::vector<double>> cosine_coefficients, sine_coefficients;
+      if (gravity::ReadCoefficientsEgm96(coefficients_file_path, geopotential_degree, cosine_coefficients, sine_coefficients)) {
+        geopotential = gravity::GravityPotential(geopotential_degree, cosine_coefficients, sine_coefficients);
+      } else {
+        std::cout << "[Warning] Geopotential coefficients file not found: " << coefficients_file_path << std::endl;
+      }
+    }
+    orbit = new AdaptiveOrbitPropagation(celestial_information, gravity_constant_m3_s2, step_width_s, maximum_step_width_s, error_tolerance,
+                                         position_i_m, velocity_i_m_s, 0.0, geopotential);
   } else {
     std::cerr << "ERROR: orbit propagation mode: " << propagate_mode << " is not defined!" << std::endl;
     std::cerr << "The orbit mode is automatically set as RK4" << std::endl;
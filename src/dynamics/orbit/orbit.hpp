@@ -23,12 +23,13 @@ namespace s2e::dynamics::orbit {
  * @brief Propagation mode of orbit
  */
 enum class OrbitPropagateMode {
-  kRk4 = 0,        //!< 4th order Runge-Kutta propagation with disturbances and thruster maneuver
-  kSgp4,           //!< SGP4 propagation using TLE without thruster maneuver
-  kRelativeOrbit,  //!< Relative dynamics (for formation flying simulation)
-  kKepler,         //!< Kepler orbit propagation without disturbances and thruster maneuver
-  kEncke,          //!< Encke orbit propagation with disturbances and thruster maneuver
-  kTimeSeriesFile  //!< Orbit propagation using time series file
+  kRk4 = 0,         //!< 4th order Runge-Kutta propagation with disturbances and thruster maneuver
+  kSgp4,            //!< SGP4 propagation using TLE without thruster maneuver
+  kRelativeOrbit,   //!< Relative dynamics (for formation flying simulation)
+  kKepler,          //!< Kepler orbit propagation without disturbances and thruster maneuver
+  kEncke,           //!< Encke orbit propagation with disturbances and thruster maneuver
+  kTimeSeriesFile,  //!< Orbit propagation using time series file
+  kAdaptive         //!< Adaptive step width Dormand-Prince propagation with disturbances and thruster maneuver
 };
 
 /**
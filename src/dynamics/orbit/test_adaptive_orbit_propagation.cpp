@@ -0,0 +1,192 @@
+/**
+ * @file test_adaptive_orbit_propagation.cpp
+ * @brief Test codes for AdaptiveOrbitPropagation class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <math_physics/numerical_integration/runge_kutta_4.hpp>
+#include <math_physics/orbit/kepler_orbit.hpp>
+#include <memory>
+#include <utilities/macros.hpp>
+
+#include "adaptive_orbit_propagation.hpp"
+#include "rk4_orbit_propagation.hpp"
+
+using namespace s2e;
+
+/**
+ * @class CountingAdaptiveOrbitPropagation
+ * @brief AdaptiveOrbitPropagation which counts the number of derivative evaluations
+ */
+class CountingAdaptiveOrbitPropagation : public dynamics::orbit::AdaptiveOrbitPropagation {
+ public:
+  using AdaptiveOrbitPropagation::AdaptiveOrbitPropagation;
+  math::Vector<6> DerivativeFunction(const double time_s, const math::Vector<6>& state) const override {
+    number_of_evaluations_++;
+    return AdaptiveOrbitPropagation::DerivativeFunction(time_s, state);
+  }
+  mutable size_t number_of_evaluations_ = 0;
+};
+
+/**
+ * @brief Generate celestial information with the Earth at the origin and the idle rotation without SPICE
+ */
+static environment::CelestialInformation GenerateCelestialInformation() {
+  auto ephemeris = std::make_shared<orbit::ChebyshevEphemeris>(0.0, 1.0e6, 1, 1, "J2000", "NONE", "EARTH");
+  std::vector<std::vector<std::vector<double>>> orbits_km(1, std::vector<std::vector<double>>(2, std::vector<double>(6, 0.0)));
+  orbit::EphemerisBodyInformation earth;
+  earth.id = 399;
+  earth.name = "EARTH";
+  earth.gravity_constant_m3_s2 = 3.986004418e14;
+  for (size_t i = 0; i < 3; i++) earth.radii_m[i] = 6378137.0;
+  EXPECT_TRUE(ephemeris->AddBody(earth, orbits_km));
+  return environment::CelestialInformation(ephemeris, {"IDLE"});
+}
+
+/**
+ * @brief Test for the dense output without the external acceleration
+ */
+TEST(AdaptiveOrbitPropagation, PropagateTwoBody) {
+  const environment::CelestialInformation celestial_information = GenerateCelestialInformation();
+  const double gravity_constant_m3_s2 = 3.986004418e14;
+  math::Vector<3> position_i_m(0.0);
+  math::Vector<3> velocity_i_m_s(0.0);
+  const double semi_major_axis_m = 8.0e6;
+  const double eccentricity = 0.1;
+  position_i_m[0] = semi_major_axis_m * (1.0 - eccentricity);
+  velocity_i_m_s[1] = sqrt(gravity_constant_m3_s2 / semi_major_axis_m * (1.0 + eccentricity) / (1.0 - eccentricity));
+
+  CountingAdaptiveOrbitPropagation orbit(&celestial_information, gravity_constant_m3_s2, 1.0, 300.0, 1.0e-3, position_i_m, velocity_i_m_s);
+  orbit.SetIsCalcEnabled(true);
+
+  orbit::OrbitalElements oe(gravity_constant_m3_s2, 0.0, position_i_m, velocity_i_m_s);
+  orbit::KeplerOrbit kepler(gravity_constant_m3_s2, oe);
+
+  // Update every second for one orbital period
+  const size_t number_of_updates = 7000;
+  for (size_t i = 1; i <= number_of_updates; i++) {
+    orbit.Propagate((double)i, 0.0);
+    if (i % 1000 == 0) {
+      kepler.CalcOrbit((double)i / (24.0 * 60.0 * 60.0));
+      for (size_t axis = 0; axis < 3; axis++) {
+        EXPECT_NEAR(kepler.GetPosition_i_m()[axis], orbit.GetPosition_i_m()[axis], 1.0);
+        EXPECT_NEAR(kepler.GetVelocity_i_m_s()[axis], orbit.GetVelocity_i_m_s()[axis], 1.0e-3);
+      }
+    }
+  }
+  // The states at the updates are interpolated from the long steps
+  EXPECT_LT(orbit.number_of_evaluations_, number_of_updates / 2);
+}
+
+/**
+ * @brief Test for the restart with the change of the external acceleration
+ */
+TEST(AdaptiveOrbitPropagation, PropagateWithManeuver) {
+  const environment::CelestialInformation celestial_information = GenerateCelestialInformation();
+  const double gravity_constant_m3_s2 = 3.986004418e14;
+  math::Vector<3> position_i_m(0.0);
+  math::Vector<3> velocity_i_m_s(0.0);
+  position_i_m[0] = 7.0e6;
+  velocity_i_m_s[1] = sqrt(gravity_constant_m3_s2 / position_i_m[0]);
+
+  CountingAdaptiveOrbitPropagation orbit(&celestial_information, gravity_constant_m3_s2, 1.0, 300.0, 1.0e-3, position_i_m, velocity_i_m_s);
+  dynamics::orbit::Rk4OrbitPropagation reference_orbit(&celestial_information, gravity_constant_m3_s2, 0.1, position_i_m, velocity_i_m_s);
+  orbit.SetIsCalcEnabled(true);
+  reference_orbit.SetIsCalcEnabled(true);
+
+  // Thrust in the along track direction from 1000 s to 1060 s
+  math::Vector<3> thrust_acceleration_i_m_s2(0.0);
+  thrust_acceleration_i_m_s2[1] = 1.0e-2;
+  size_t number_of_evaluations_before_maneuver = 0;
+  for (size_t i = 1; i <= 3000; i++) {
+    const bool is_thrusting = i > 1000 && i <= 1060;
+    const math::Vector<3> acceleration_i_m_s2 = is_thrusting ? thrust_acceleration_i_m_s2 : math::Vector<3>(0.0);
+    orbit.SetAcceleration_i_m_s2(acceleration_i_m_s2);
+    reference_orbit.SetAcceleration_i_m_s2(acceleration_i_m_s2);
+    if (i == 1001) number_of_evaluations_before_maneuver = orbit.number_of_evaluations_;
+
+    orbit.Propagate((double)i, 0.0);
+    reference_orbit.Propagate((double)i, 0.0);
+    for (size_t axis = 0; axis < 3; axis++) {
+      EXPECT_NEAR(reference_orbit.GetPosition_i_m()[axis], orbit.GetPosition_i_m()[axis], 1.0);
+    }
+  }
+  // The integration is restarted at the start and the end of the maneuver with steps limited to the update period
+  EXPECT_GT(orbit.number_of_evaluations_ - number_of_evaluations_before_maneuver, 60);
+}
+
+/**
+ * @class GeopotentialOrbitOde
+ * @brief Orbit ODE with the two body gravity and the geopotential for the reference solution
+ */
+class GeopotentialOrbitOde : public numerical_integration::InterfaceOde<6> {
+ public:
+  GeopotentialOrbitOde(const double gravity_constant_m3_s2, const gravity::GravityPotential& geopotential)
+      : gravity_constant_m3_s2_(gravity_constant_m3_s2), geopotential_(geopotential) {}
+  math::Vector<6> DerivativeFunction(const double time_s, const math::Vector<6>& state) const override {
+    UNUSED(time_s);
+    math::Vector<3> position_m;
+    for (size_t i = 0; i < 3; i++) position_m[i] = state[i];
+    const math::Vector<3> acceleration_m_s2 = geopotential_.CalcAcceleration_xcxf_m_s2(position_m);
+    const double r3 = pow(position_m.CalcNorm(), 3.0);
+    math::Vector<6> rhs;
+    for (size_t i = 0; i < 3; i++) {
+      rhs[i] = state[i + 3];
+      rhs[i + 3] = acceleration_m_s2[i] - gravity_constant_m3_s2_ / r3 * state[i];
+    }
+    return rhs;
+  }
+
+ private:
+  const double gravity_constant_m3_s2_;
+  const gravity::GravityPotential& geopotential_;
+};
+
+/**
+ * @brief Test for the geopotential evaluated in the integration steps
+ */
+TEST(AdaptiveOrbitPropagation, PropagateWithGeopotential) {
+  const environment::CelestialInformation celestial_information = GenerateCelestialInformation();
+  const double gravity_constant_m3_s2 = 3.986004418e14;
+  math::Vector<3> position_i_m(0.0);
+  math::Vector<3> velocity_i_m_s(0.0);
+  position_i_m[0] = 7.0e6;
+  velocity_i_m_s[1] = sqrt(gravity_constant_m3_s2 / position_i_m[0]) * cos(1.0);
+  velocity_i_m_s[2] = sqrt(gravity_constant_m3_s2 / position_i_m[0]) * sin(1.0);
+
+  // J2 and a tesseral term
+  const size_t degree = 2;
+  std::vector<std::vector<double>> cosine_coefficients(degree + 1, std::vector<double>(degree + 1, 0.0));
+  std::vector<std::vector<double>> sine_coefficients(degree + 1, std::vector<double>(degree + 1, 0.0));
+  cosine_coefficients[2][0] = -4.84165371736e-4;
+  cosine_coefficients[2][2] = 2.43914352398e-6;
+  sine_coefficients[2][2] = -1.40016683654e-6;
+  const gravity::GravityPotential geopotential(degree, cosine_coefficients, sine_coefficients);
+
+  CountingAdaptiveOrbitPropagation orbit(&celestial_information, gravity_constant_m3_s2, 1.0, 60.0, 1.0e-4, position_i_m, velocity_i_m_s, 0.0,
+                                         geopotential);
+  orbit.SetIsCalcEnabled(true);
+
+  const GeopotentialOrbitOde ode(gravity_constant_m3_s2, geopotential);
+  numerical_integration::RungeKutta4<6> reference(1.0, ode);
+  math::Vector<6> initial_state;
+  for (size_t i = 0; i < 3; i++) {
+    initial_state[i] = position_i_m[i];
+    initial_state[i + 3] = velocity_i_m_s[i];
+  }
+  reference.SetState(0.0, initial_state);
+
+  // Update every second for one orbital period. The geopotential moves the position by tens of km in this duration.
+  const size_t number_of_updates = 6000;
+  for (size_t i = 1; i <= number_of_updates; i++) {
+    orbit.Propagate((double)i, 0.0);
+    reference.Integrate();
+    if (i % 1000 == 0) {
+      for (size_t axis = 0; axis < 3; axis++) {
+        EXPECT_NEAR(reference.GetState()[axis], orbit.GetPosition_i_m()[axis], 1.0);
+      }
+    }
+  }
+  // The geopotential does not cause the restart, so that the long steps are taken
+  EXPECT_LT(orbit.number_of_evaluations_, number_of_updates / 2);
+}
@@ -71,7 +71,9 @@ void Temperature::Propagate(const environment::LocalCelestialInformation* local_
     for (auto itr = nodes_.begin(); itr != nodes_.end(); ++itr) {
       cout << setprecision(4) << itr->GetSolarRadiation_W() << "  ";
     }
-    math::Vector<3> sun_direction_b = local_celestial_information->GetPositionFromSpacecraft_b_m("SUN").CalcNormalizedVector();
+    const environment::CelestialInformation& celestial_information = local_celestial_information->GetGlobalInformation();
+    math::Vector<3> sun_direction_b =
+        local_celestial_information->GetPositionFromSpacecraft_b_m(celestial_information.GetSunId()).CalcNormalizedVector();
     cout << "SunDir:  ";
     for (size_t i = 0; i < 3; i++) {
       cout << setprecision(3) << sun_direction_b[i] << "  ";
@@ -81,7 +83,8 @@ void Temperature::Propagate(const environment::LocalCelestialInformation* local_
     for (auto itr = nodes_.begin(); itr != nodes_.end(); ++itr) {
       cout << setprecision(4) << itr->GetAlbedoRadiation_W() << "  ";
     }
-    math::Vector<3> earth_direction_b = local_celestial_information->GetPositionFromSpacecraft_b_m("EARTH").CalcNormalizedVector();
+    math::Vector<3> earth_direction_b =
+        local_celestial_information->GetPositionFromSpacecraft_b_m(celestial_information.GetEarthId()).CalcNormalizedVector();
     cout << "EarthDir:  ";
     for (size_t i = 0; i < 3; i++) {
       cout << setprecision(3) << earth_direction_b[i] << "  ";
@@ -136,7 +139,10 @@ vector<double> Temperature::CalcTemperatureDifferentials(vector<double> temperat
   // TODO: consider the following unused arguments are really needed
   UNUSED(temperatures_K);
 
-  math::Vector<3> sun_direction_b = local_celestial_information->GetPositionFromSpacecraft_b_m("SUN").CalcNormalizedVector();
+  const environment::CelestialInformation& celestial_information = local_celestial_information->GetGlobalInformation();
+  math::Vector<3> sun_direction_b =
+      local_celestial_information->GetPositionFromSpacecraft_b_m(celestial_information.GetSunId()).CalcNormalizedVector();
+  math::Vector<3> earth_position_b_m = local_celestial_information->GetPositionFromSpacecraft_b_m(celestial_information.GetEarthId());
   vector<double> differentials_K_s(node_num);
   for (size_t i = 0; i < node_num; i++) {
     heatloads_[i].SetElapsedTime_s(t);
@@ -144,7 +150,6 @@ vector<double> Temperature::CalcTemperatureDifferentials(vector<double> temperat
       double solar_flux_W_m2 = srp_environment_->GetPowerDensity_W_m2();
       if (solar_calc_setting_ == SolarCalcSetting::kEnable) {
         double solar_radiation_W = nodes_[i].CalcSolarRadiation_W(sun_direction_b, solar_flux_W_m2);
-        math::Vector<3> earth_position_b_m = local_celestial_information->GetPositionFromSpacecraft_b_m("EARTH");
         double albedo_radiation_W = nodes_[i].CalcAlbedoRadiation_W(earth_position_b_m, earth_albedo_->GetEarthAlbedoRadiationPower_W_m2());
         heatloads_[i].SetAlbedoHeatload_W(albedo_radiation_W);
         heatloads_[i].SetSolarHeatload_W(solar_radiation_W);
@@ -11,6 +11,7 @@
 #include <string.h>
 
 #include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <locale>
 #include <sstream>
@@ -65,16 +66,79 @@ CelestialInformation::CelestialInformation(const std::string inertial_frame_name
     celestial_body_mean_radius_m_[i] = pow(rx * ry * rz, 1.0 / 3.0);
   }
 
+  // Acquisition of body name
+  for (unsigned int i = 0; i < number_of_selected_bodies_; i++) {
+    SpiceBoolean found;
+    const int kMaxNameLength = 100;
+    char name_buffer[kMaxNameLength];
+    bodc2n_c(selected_body_ids_[i], kMaxNameLength, name_buffer, (SpiceBoolean*)&found);
+    selected_body_names_.push_back(name_buffer);
+  }
+
+  ResolveBodyIds();
+
   // Initialize rotation
   earth_rotation_ = new EarthRotation(ConvertEarthRotationMode(GetRotationMode("EARTH")));
   moon_rotation_ = new MoonRotation(*this, ConvertMoonRotationMode(GetRotationMode("MOON")));
 }
 
+CelestialInformation::CelestialInformation(std::shared_ptr<const orbit::ChebyshevEphemeris> ephemeris_file,
+                                           const std::vector<std::string> rotation_mode_list)
+    : number_of_selected_bodies_((unsigned int)ephemeris_file->GetNumberOfBodies()),
+      inertial_frame_name_(ephemeris_file->GetInertialFrameName()),
+      center_body_name_(ephemeris_file->GetCenterBodyName()),
+      aberration_correction_setting_(ephemeris_file->GetAberrationCorrectionSetting()),
+      ephemeris_file_(ephemeris_file),
+      rotation_mode_list_(rotation_mode_list) {
+  // Initialize list
+  unsigned int num_of_state = number_of_selected_bodies_ * 3;
+  selected_body_ids_ = new int[number_of_selected_bodies_];
+  celestial_body_position_from_center_i_m_ = new double[num_of_state];
+  celestial_body_velocity_from_center_i_m_s_ = new double[num_of_state];
+  celestial_body_gravity_constant_m3_s2_ = new double[number_of_selected_bodies_];
+  celestial_body_mean_radius_m_ = new double[number_of_selected_bodies_];
+  celestial_body_planetographic_radii_m_ = new double[num_of_state];
+
+  // Constants of the bodies are stored in the ephemeris file
+  for (unsigned int i = 0; i < number_of_selected_bodies_; i++) {
+    const orbit::EphemerisBodyInformation& body = ephemeris_file_->GetBodyInformation(i);
+    selected_body_ids_[i] = body.id;
+    selected_body_names_.push_back(body.name);
+    celestial_body_gravity_constant_m3_s2_[i] = body.gravity_constant_m3_s2;
+    for (int j = 0; j < 3; j++) {
+      celestial_body_planetographic_radii_m_[i * 3 + j] = body.radii_m[j];
+    }
+    celestial_body_mean_radius_m_[i] = pow(body.radii_m[0] * body.radii_m[1] * body.radii_m[2], 1.0 / 3.0);
+  }
+
+  ResolveBodyIds();
+
+  // Initialize rotation
+  earth_rotation_ = new EarthRotation(ConvertEarthRotationMode(GetRotationMode("EARTH")));
+  MoonRotationMode moon_rotation_mode = ConvertMoonRotationMode(GetRotationMode("MOON"));
+  if (moon_rotation_mode == MoonRotationMode::kIauMoon) {
+    // The IAU_MOON frame needs the SPICE kernels, which are not loaded in the ephemeris file mode
+    std::cout << "[Warning] IAU_MOON rotation mode is not available with the ephemeris file. IDLE mode is used." << std::endl;
+    moon_rotation_mode = MoonRotationMode::kIdle;
+  }
+  moon_rotation_ = new MoonRotation(*this, moon_rotation_mode);
+}
+
 CelestialInformation::CelestialInformation(const CelestialInformation& obj)
     : number_of_selected_bodies_(obj.number_of_selected_bodies_),
       inertial_frame_name_(obj.inertial_frame_name_),
       center_body_name_(obj.center_body_name_),
-      aberration_correction_setting_(obj.aberration_correction_setting_) {
+      aberration_correction_setting_(obj.aberration_correction_setting_),
+      center_body_id_(obj.center_body_id_),
+      sun_id_(obj.sun_id_),
+      earth_id_(obj.earth_id_),
+      moon_id_(obj.moon_id_),
+      selected_body_names_(obj.selected_body_names_),
+      ephemeris_cache_segment_length_s_(obj.ephemeris_cache_segment_length_s_),
+      ephemeris_cache_degree_(obj.ephemeris_cache_degree_),
+      ephemeris_cache_(obj.ephemeris_cache_),
+      ephemeris_file_(obj.ephemeris_file_),
+      is_ephemeris_file_range_warned_(obj.is_ephemeris_file_range_warned_) {
   unsigned int num_of_state = number_of_selected_bodies_ * 3;
 
   selected_body_ids_ = new int[number_of_selected_bodies_];
@@ -106,19 +170,26 @@ CelestialInformation::~CelestialInformation() {
 }
 
 void CelestialInformation::UpdateAllObjectsInformation(const SimulationTime& simulation_time) {
+  UpdateAllObjectsInformation(simulation_time.GetCurrentEphemerisTime(), simulation_time.GetCurrentTime_jd());
+}
+
+void CelestialInformation::UpdateAllObjectsInformation(const double ephemeris_time_s, const double current_time_jd) {
   // Update celestial body orbit
+  const double et = ephemeris_time_s;
   for (unsigned int i = 0; i < number_of_selected_bodies_; i++) {
-    SpiceInt planet_id = selected_body_ids_[i];
-
-    // Acquisition of body name from id
-    SpiceBoolean found;
-    const int kMaxNameLength = 100;
-    char name_buffer[kMaxNameLength];
-    bodc2n_c(planet_id, kMaxNameLength, name_buffer, (SpiceBoolean*)&found);
-
     // Acquisition of position and velocity
     SpiceDouble orbit_buffer_km[6];
-    GetPlanetOrbit(name_buffer, simulation_time.GetCurrentEphemerisTime(), (SpiceDouble*)orbit_buffer_km);
+    if (ephemeris_file_ != nullptr) {
+      if (!ephemeris_file_->CalcOrbit(i, et, orbit_buffer_km) && !is_ephemeris_file_range_warned_) {
+        std::cout << "[Warning] The time is out of the ephemeris file range. The orbits at the end of the range are used." << std::endl;
+        is_ephemeris_file_range_warned_ = true;
+      }
+    } else if (ephemeris_cache_segment_length_s_ > 0.0) {
+      if (!ephemeris_cache_[i].IsInRange(et)) FitEphemerisSegment(i, et);
+      ephemeris_cache_[i].CalcValue(et, orbit_buffer_km);
+    } else {
+      GetPlanetOrbit(selected_body_names_[i].c_str(), et, (SpiceDouble*)orbit_buffer_km);
+    }
     // Convert unit [km], [km/s] to [m], [m/s]
     for (int j = 0; j < 3; j++) {
       celestial_body_position_from_center_i_m_[i * 3 + j] = orbit_buffer_km[j] * 1000.0;
@@ -127,13 +198,75 @@ void CelestialInformation::UpdateAllObjectsInformation(const SimulationTime& sim
   }
 
   // Update earth rotation
-  earth_rotation_->Update(simulation_time.GetCurrentTime_jd());
+  earth_rotation_->Update(current_time_jd);
   // Update moon rotation
-  moon_rotation_->Update(simulation_time);
+  moon_rotation_->Update(ephemeris_time_s);
+}
+
+void CelestialInformation::SetEphemerisCache(const double segment_length_s, const size_t chebyshev_degree) {
+  ephemeris_cache_segment_length_s_ = segment_length_s;
+  ephemeris_cache_degree_ = chebyshev_degree;
+  ephemeris_cache_.assign(number_of_selected_bodies_, math::ChebyshevInterpolation());
+}
+
+void CelestialInformation::FitEphemerisSegment(const size_t body_index, const double et) {
+  const double end_et = et + ephemeris_cache_segment_length_s_;
+  std::vector<std::vector<double>> orbits_km;
+  for (const double node_et : math::ChebyshevInterpolation::CalcNodes(et, end_et, ephemeris_cache_degree_)) {
+    std::vector<double> orbit_km(6);
+    GetPlanetOrbit(selected_body_names_[body_index].c_str(), node_et, orbit_km.data());
+    orbits_km.push_back(orbit_km);
+  }
+  ephemeris_cache_[body_index] = math::ChebyshevInterpolation(et, end_et, orbits_km);
+}
+
+bool CelestialInformation::WriteEphemerisFile(const std::string file_name, const double start_ephemeris_time_s, const double end_ephemeris_time_s,
+                                              const double segment_length_s, const size_t chebyshev_degree) {
+  if (segment_length_s <= 0.0 || chebyshev_degree == 0) {
+    std::cout << "[Warning] Invalid segment setting for the ephemeris file." << std::endl;
+    return false;
+  }
+  const size_t number_of_segments = (size_t)std::max(1.0, ceil((end_ephemeris_time_s - start_ephemeris_time_s) / segment_length_s));
+  orbit::ChebyshevEphemeris ephemeris(start_ephemeris_time_s, segment_length_s, number_of_segments, chebyshev_degree, inertial_frame_name_,
+                                      aberration_correction_setting_, center_body_name_);
+
+  for (unsigned int i = 0; i < number_of_selected_bodies_; i++) {
+    orbit::EphemerisBodyInformation body;
+    body.id = selected_body_ids_[i];
+    body.name = selected_body_names_[i];
+    body.gravity_constant_m3_s2 = celestial_body_gravity_constant_m3_s2_[i];
+    for (int j = 0; j < 3; j++) body.radii_m[j] = celestial_body_planetographic_radii_m_[i * 3 + j];
+
+    std::vector<std::vector<std::vector<double>>> orbits_km;
+    for (size_t segment_index = 0; segment_index < number_of_segments; segment_index++) {
+      std::vector<std::vector<double>> segment_orbits_km;
+      for (const double node_et : ephemeris.CalcSegmentNodes(segment_index)) {
+        std::vector<double> orbit_km(6);
+        GetPlanetOrbit(selected_body_names_[i].c_str(), node_et, orbit_km.data());
+        segment_orbits_km.push_back(orbit_km);
+      }
+      orbits_km.push_back(segment_orbits_km);
+    }
+    ephemeris.AddBody(body, orbits_km);
+  }
+  return ephemeris.WriteFile(file_name);
 }
 
 int CelestialInformation::CalcBodyIdFromName(const char* body_name) const {
   int index = 0;
+  if (ephemeris_file_ != nullptr) {
+    // SPICE is not available. The SPICE names of the bodies are stored in upper case.
+    std::string name = body_name;
+    std::locale loc = std::locale::classic();
+    std::transform(name.begin(), name.end(), name.begin(), [loc](char c) { return std::toupper(c, loc); });
+    for (unsigned int i = 0; i < number_of_selected_bodies_; i++) {
+      if (selected_body_names_[i] == name) {
+        index = i;
+        break;
+      }
+    }
+    return index;
+  }
   SpiceInt planet_id;
   SpiceBoolean found;
 
@@ -148,16 +281,17 @@ int CelestialInformation::CalcBodyIdFromName(const char* body_name) const {
   return index;
 }
 
+void CelestialInformation::ResolveBodyIds(void) {
+  center_body_id_ = CalcBodyIdFromName(center_body_name_.c_str());
+  sun_id_ = CalcBodyIdFromName("SUN");
+  earth_id_ = CalcBodyIdFromName("EARTH");
+  moon_id_ = CalcBodyIdFromName("MOON");
+}
+
 std::string CelestialInformation::GetLogHeader() const {
-  SpiceBoolean found;
-  const int kMaxNameLength = 100;
-  char name_buffer[kMaxNameLength];
   std::string str_tmp = "";
   for (unsigned int i = 0; i < number_of_selected_bodies_; i++) {
-    SpiceInt planet_id = selected_body_ids_[i];
-    // Acquisition of body name from id
-    bodc2n_c(planet_id, kMaxNameLength, name_buffer, (SpiceBoolean*)&found);
-    std::string name = name_buffer;
+    std::string name = selected_body_names_[i];
 
     std::locale loc = std::locale::classic();
     std::transform(name.begin(), name.end(), name.begin(), [loc](char c) { return std::tolower(c, loc); });
@@ -210,6 +344,35 @@ CelestialInformation* InitCelestialInformation(std::string file_name) {
   std::string aber_cor = ini_file.ReadString(section, "aberration_correction");
   std::string center_obj = ini_file.ReadString(section, "center_object");
 
+  // Pre-generated ephemeris file
+  if (ini_file.ReadEnable(section, "use_ephemeris_file")) {
+    const std::string ephemeris_file_name = ini_file.ReadString(section, "ephemeris_file");
+    std::shared_ptr<orbit::ChebyshevEphemeris> ephemeris_file = std::make_shared<orbit::ChebyshevEphemeris>();
+    if (ephemeris_file->ReadFile(ephemeris_file_name)) {
+      if (ephemeris_file->GetInertialFrameName() != inertial_frame || ephemeris_file->GetCenterBodyName() != center_obj ||
+          ephemeris_file->GetAberrationCorrectionSetting() != aber_cor) {
+        std::cout << "[Warning] The frame setting of the ephemeris file is used: " << ephemeris_file->GetInertialFrameName() << ", "
+                  << ephemeris_file->GetCenterBodyName() << ", " << ephemeris_file->GetAberrationCorrectionSetting() << std::endl;
+      }
+      std::vector<std::string> rotation_mode_list = ini_file.ReadVectorString(section, "rotation_mode", ephemeris_file->GetNumberOfBodies());
+      if (std::find(rotation_mode_list.begin(), rotation_mode_list.end(), "IAU_MOON") == rotation_mode_list.end()) {
+        // Only the leap second kernel is used to calculate the ephemeris time of the simulation start
+        furnsh_c(ini_file.ReadString(furnsh_section, "tls").c_str());
+
+        CelestialInformation* celestial_info = new CelestialInformation(ephemeris_file, rotation_mode_list);
+        const double earth_update_interval_s = ini_file.ReadDouble(section, "earth_precession_nutation_update_interval_s");
+        celestial_info->GetEarthRotation().SetPrecessionNutationUpdateInterval(earth_update_interval_s);
+        const double moon_update_interval_s = ini_file.ReadDouble(section, "moon_rotation_update_interval_s");
+        celestial_info->GetMoonRotation().SetUpdateInterval(moon_update_interval_s);
+        celestial_info->is_log_enabled_ = ini_file.ReadEnable(section, INI_LOG_LABEL);
+        return celestial_info;
+      }
+      std::cout << "[Warning] SPICE is used since IAU_MOON rotation mode needs the SPICE kernels." << std::endl;
+    } else {
+      std::cout << "[Warning] SPICE is used since the ephemeris file cannot be read." << std::endl;
+    }
+  }
+
   // SPICE Furnsh
   std::vector<std::string> keywords = {"tls", "tpc1", "tpc2", "tpc3", "bsp"};
   for (size_t i = 0; i < keywords.size(); i++) {
@@ -240,6 +403,20 @@ CelestialInformation* InitCelestialInformation(std::string file_name) {
 
   CelestialInformation* celestial_info;
   celestial_info = new CelestialInformation(inertial_frame, aber_cor, center_obj, num_of_selected_body, selected_body, rotation_mode_list);
+  // Earth rotation setting
+  const double earth_update_interval_s = ini_file.ReadDouble(section, "earth_precession_nutation_update_interval_s");
+  celestial_info->GetEarthRotation().SetPrecessionNutationUpdateInterval(earth_update_interval_s);
+  // Moon rotation setting
+  const double moon_update_interval_s = ini_file.ReadDouble(section, "moon_rotation_update_interval_s");
+  celestial_info->GetMoonRotation().SetUpdateInterval(moon_update_interval_s);
+
+  // Ephemeris cache setting
+  const double ephemeris_cache_segment_length_s = ini_file.ReadDouble(section, "ephemeris_cache_segment_length_s");
+  if (ephemeris_cache_segment_length_s > 0.0) {
+    int chebyshev_degree = ini_file.ReadInt(section, "ephemeris_cache_chebyshev_degree");
+    if (chebyshev_degree <= 0) chebyshev_degree = 12;
+    celestial_info->SetEphemerisCache(ephemeris_cache_segment_length_s, (size_t)chebyshev_degree);
+  }
 
   // log setting
   celestial_info->is_log_enabled_ = ini_file.ReadEnable(section, INI_LOG_LABEL);
@@ -7,11 +7,14 @@
 #ifndef S2E_ENVIRONMENT_GLOBAL_CELESTIAL_INFORMATION_HPP_
 #define S2E_ENVIRONMENT_GLOBAL_CELESTIAL_INFORMATION_HPP_
 
+#include <memory>
 #include <vector>
 
 #include "earth_rotation.hpp"
 #include "logger/loggable.hpp"
+#include "math_physics/math/chebyshev_interpolation.hpp"
 #include "math_physics/math/vector.hpp"
+#include "math_physics/orbit/chebyshev_ephemeris.hpp"
 #include "moon_rotation.hpp"
 #include "simulation_time.hpp"
 
@@ -38,6 +41,13 @@ class CelestialInformation : public logger::ILoggable {
    */
   CelestialInformation(const std::string inertial_frame_name, const std::string aberration_correction_setting, const std::string center_body_name,
                        const unsigned int number_of_selected_body, int* selected_body_ids, const std::vector<std::string> rotation_mode_list);
+  /**
+   * @fn CelestialInformation
+   * @brief Constructor with a pre-generated ephemeris. SPICE is not used to get the orbits and constants of the bodies.
+   * @param [in] ephemeris_file: Ephemeris read from the file generated by WriteEphemerisFile
+   * @param [in] rotation_mode_list: Rotation mode list for planets
+   */
+  CelestialInformation(std::shared_ptr<const orbit::ChebyshevEphemeris> ephemeris_file, const std::vector<std::string> rotation_mode_list);
   /**
    * @fn CelestialInformation
    * @brief Copy constructor
@@ -67,6 +77,34 @@ class CelestialInformation : public logger::ILoggable {
    * @param [in] simulation_time: Simulation Time information
    */
   void UpdateAllObjectsInformation(const SimulationTime& simulation_time);
+  /**
+   * @fn UpdateAllObjectsInformation
+   * @brief Update the information of all selected celestial objects
+   * @param [in] ephemeris_time_s: Ephemeris time [s]
+   * @param [in] current_time_jd: Current time in Julian date
+   */
+  void UpdateAllObjectsInformation(const double ephemeris_time_s, const double current_time_jd);
+
+  /**
+   * @fn SetEphemerisCache
+   * @brief Enable the ephemeris cache which approximates the SPICE ephemeris with Chebyshev polynomials
+   * @note Each segment is fitted lazily with (chebyshev_degree + 1) SPICE calls per body when the time leaves the current segment.
+   * @param [in] segment_length_s: Length of a segment [s]. Zero disables the cache.
+   * @param [in] chebyshev_degree: Degree of the Chebyshev polynomials
+   */
+  void SetEphemerisCache(const double segment_length_s, const size_t chebyshev_degree);
+  /**
+   * @fn WriteEphemerisFile
+   * @brief Sample the SPICE ephemeris of all selected bodies over the time span and write it to a file for CelestialInformation without SPICE
+   * @param [in] file_name: Path to the output file
+   * @param [in] start_ephemeris_time_s: Start of the time span [s]
+   * @param [in] end_ephemeris_time_s: End of the time span [s]
+   * @param [in] segment_length_s: Length of a Chebyshev segment [s]
+   * @param [in] chebyshev_degree: Degree of the Chebyshev polynomials
+   * @return True when succeeded
+   */
+  bool WriteEphemerisFile(const std::string file_name, const double start_ephemeris_time_s, const double end_ephemeris_time_s,
+                          const double segment_length_s, const size_t chebyshev_degree);
 
   // Getters
   // Orbit information
@@ -98,11 +136,17 @@ class CelestialInformation : public logger::ILoggable {
    */
   inline math::Vector<3> GetPositionFromSelectedBody_i_m(const char* target_body_name, const char* reference_body_name) const {
     int target_id = CalcBodyIdFromName(target_body_name);
-    math::Vector<3> target_body_position_i_m = GetPositionFromCenter_i_m(target_id);
     int reference_id = CalcBodyIdFromName(reference_body_name);
-    math::Vector<3> reference_body_position_i_m = GetPositionFromCenter_i_m(reference_id);
-
-    return target_body_position_i_m - reference_body_position_i_m;
+    return GetPositionFromSelectedBody_i_m(target_id, reference_id);
+  }
+  /**
+   * @fn GetPositionFromSelectedBody_i_m
+   * @brief Return position from the selected reference body in the inertial frame [m]
+   * @param [in] target_id: ID of CelestialInformation list for the target body
+   * @param [in] reference_id: ID of CelestialInformation list for the reference body
+   */
+  inline math::Vector<3> GetPositionFromSelectedBody_i_m(const unsigned int target_id, const unsigned int reference_id) const {
+    return GetPositionFromCenter_i_m(target_id) - GetPositionFromCenter_i_m(reference_id);
   }
 
   /**
@@ -133,11 +177,17 @@ class CelestialInformation : public logger::ILoggable {
    */
   inline math::Vector<3> GetVelocityFromSelectedBody_i_m_s(const char* target_body_name, const char* reference_body_name) const {
     int target_id = CalcBodyIdFromName(target_body_name);
-    math::Vector<3> target_body_velocity_i_m_s = GetVelocityFromCenter_i_m_s(target_id);
     int reference_id = CalcBodyIdFromName(reference_body_name);
-    math::Vector<3> reference_body_velocity_i_m_s = GetVelocityFromCenter_i_m_s(reference_id);
-
-    return target_body_velocity_i_m_s - reference_body_velocity_i_m_s;
+    return GetVelocityFromSelectedBody_i_m_s(target_id, reference_id);
+  }
+  /**
+   * @fn GetVelocityFromSelectedBody_i_m_s
+   * @brief Return velocity from the selected reference body in the inertial frame [m/s]
+   * @param [in] target_id: ID of CelestialInformation list for the target body
+   * @param [in] reference_id: ID of CelestialInformation list for the reference body
+   */
+  inline math::Vector<3> GetVelocityFromSelectedBody_i_m_s(const unsigned int target_id, const unsigned int reference_id) const {
+    return GetVelocityFromCenter_i_m_s(target_id) - GetVelocityFromCenter_i_m_s(reference_id);
   }
 
   // Gravity constants
@@ -148,13 +198,19 @@ class CelestialInformation : public logger::ILoggable {
    */
   inline double GetGravityConstant_m3_s2(const char* body_name) const {
     int index = CalcBodyIdFromName(body_name);
-    return celestial_body_gravity_constant_m3_s2_[index];
+    return GetGravityConstant_m3_s2(index);
   }
+  /**
+   * @fn GetGravityConstant_m3_s2
+   * @brief Return gravity constant of the celestial body [m^3/s^2]
+   * @param [in] id: ID of CelestialInformation list
+   */
+  inline double GetGravityConstant_m3_s2(const unsigned int id) const { return celestial_body_gravity_constant_m3_s2_[id]; }
   /**
    * @fn GetCenterBodyGravityConstant_m3_s2
    * @brief Return gravity constant of the center body [m^3/s^2]
    */
-  inline double GetCenterBodyGravityConstant_m3_s2(void) const { return GetGravityConstant_m3_s2(center_body_name_.c_str()); }
+  inline double GetCenterBodyGravityConstant_m3_s2(void) const { return GetGravityConstant_m3_s2(center_body_id_); }
 
   // Shape information
   /**
@@ -184,8 +240,14 @@ class CelestialInformation : public logger::ILoggable {
    */
   inline double GetMeanRadiusFromName_m(const char* body_name) const {
     int index = CalcBodyIdFromName(body_name);
-    return celestial_body_mean_radius_m_[index];
+    return GetMeanRadius_m(index);
   }
+  /**
+   * @fn GetMeanRadius_m
+   * @brief Return mean radius of a celestial body [m]
+   * @param [in] id: ID of CelestialInformation list
+   */
+  inline double GetMeanRadius_m(const unsigned int id) const { return celestial_body_mean_radius_m_[id]; }
 
   // Parameters
   /**
@@ -198,11 +260,38 @@ class CelestialInformation : public logger::ILoggable {
    * @brief Return SPICE IDs of selected bodies
    */
   inline const int* GetSelectedBodyIds(void) const { return selected_body_ids_; }
+  /**
+   * @fn GetSelectedBodyName
+   * @brief Return SPICE name of a selected body in upper case
+   * @note The name is available without SPICE in the ephemeris file mode
+   * @param [in] id: ID of CelestialInformation list
+   */
+  inline std::string GetSelectedBodyName(const unsigned int id) const { return selected_body_names_[id]; }
   /**
    * @fn GetCenterBodyName
    * @brief Return name of the center body
    */
   inline std::string GetCenterBodyName(void) const { return center_body_name_; }
+  /**
+   * @fn GetCenterBodyId
+   * @brief Return ID of CelestialInformation list for the center body
+   */
+  inline unsigned int GetCenterBodyId(void) const { return center_body_id_; }
+  /**
+   * @fn GetSunId
+   * @brief Return ID of CelestialInformation list for the sun
+   */
+  inline unsigned int GetSunId(void) const { return sun_id_; }
+  /**
+   * @fn GetEarthId
+   * @brief Return ID of CelestialInformation list for the earth
+   */
+  inline unsigned int GetEarthId(void) const { return earth_id_; }
+  /**
+   * @fn GetMoonId
+   * @brief Return ID of CelestialInformation list for the moon
+   */
+  inline unsigned int GetMoonId(void) const { return moon_id_; }
 
   // Members
   /**
@@ -220,8 +309,11 @@ class CelestialInformation : public logger::ILoggable {
   /**
    * @fn CalcBodyIdFromName
    * @brief Acquisition of ID of CelestialInformation list from body name
+   * @note The ID is searched with the SPICE name search (bodn2c_c) when the ephemeris is given by SPICE. With the ephemeris file, SPICE is not
+   *       used and the upper-cased name is compared with the body names stored in the file. Resolve the ID once at initialization and use
+   *       the ID based getters in loops.
    * @param [in] body_name: Celestial body name
-   * @return ID of CelestialInformation list
+   * @return ID of CelestialInformation list. 0 when the body is not found.
    */
   int CalcBodyIdFromName(const char* body_name) const;
   /**
@@ -239,6 +331,12 @@ class CelestialInformation : public logger::ILoggable {
   std::string aberration_correction_setting_;  //!< Stellar aberration correction
                                                //!< Ref：http://fermi.gsfc.nasa.gov/ssc/library/fug/051108/Aberration_Julie.ppt
 
+  // IDs of CelestialInformation list resolved at initialization
+  unsigned int center_body_id_ = 0;  //!< ID of the center body
+  unsigned int sun_id_ = 0;          //!< ID of the sun
+  unsigned int earth_id_ = 0;        //!< ID of the earth
+  unsigned int moon_id_ = 0;         //!< ID of the moon
+
   // Calculated values
   double* celestial_body_position_from_center_i_m_;    //!< Position vector list at inertial frame [m]
   double* celestial_body_velocity_from_center_i_m_s_;  //!< Velocity vector list at inertial frame [m/s]
@@ -249,6 +347,14 @@ class CelestialInformation : public logger::ILoggable {
                                                        // Z-axis pass through the 90 degree latitude direction
                                                        // Y-axis equal to the cross product of the unit Z-axis and X-axis vectors
 
+  // Ephemeris
+  std::vector<std::string> selected_body_names_;                     //!< SPICE names of selected bodies
+  double ephemeris_cache_segment_length_s_ = 0.0;                    //!< Segment length of the ephemeris cache [s] (zero: disabled)
+  size_t ephemeris_cache_degree_ = 0;                                //!< Degree of the Chebyshev polynomials of the ephemeris cache
+  std::vector<math::ChebyshevInterpolation> ephemeris_cache_;        //!< Ephemeris cache of each body (position [km], velocity [km/s])
+  std::shared_ptr<const orbit::ChebyshevEphemeris> ephemeris_file_;  //!< Pre-generated ephemeris used instead of SPICE (nullptr: SPICE is used)
+  bool is_ephemeris_file_range_warned_ = false;                      //!< Flag to warn the time out of the ephemeris file only once
+
   // Rotational Motion of each planets
   EarthRotation* earth_rotation_;                //!< Instance of Earth rotation
   MoonRotation* moon_rotation_;                  //!< Instance of Moon rotation
@@ -263,6 +369,19 @@ class CelestialInformation : public logger::ILoggable {
    * @param [out] orbit: Cartesian state vector representing the position and velocity of the target body relative to the specified observer.
    */
   void GetPlanetOrbit(const char* planet_name, const double et, double orbit[6]);
+  /**
+   * @fn FitEphemerisSegment
+   * @brief Fit a segment of the ephemeris cache starting at the ephemeris time
+   * @param [in] body_index: Index of the selected body
+   * @param [in] et: Ephemeris time at the start of the segment
+   */
+  void FitEphemerisSegment(const size_t body_index, const double et);
+
+  /**
+   * @fn ResolveBodyIds
+   * @brief Resolve IDs of CelestialInformation list for the frequently used bodies
+   */
+  void ResolveBodyIds(void);
 
   /**
    * @fn GetRotationMode
@@ -8,6 +8,7 @@
 
 #include "earth_rotation.hpp"
 
+#include <cmath>
 #include <iostream>
 #include <sstream>
 
@@ -115,29 +116,19 @@ void EarthRotation::Update(const double julian_date) {
   double gmst_rad = gstime(julian_date);  // It is a bit different with 長沢(Nagasawa)'s algorithm. TODO: Check the correctness
 
   if (rotation_mode_ == EarthRotationMode::kFull) {
-    // Compute Julian date for terrestrial time
-    double terrestrial_time_julian_day =
-        julian_date + kDtUt1Utc_ * kSec2Day_;  // TODO: Check the correctness. Problem is that S2E doesn't have Gregorian calendar.
-
-    // Compute nth power of julian century for terrestrial time.
-    // The actual unit of tTT_century is [century^(i+1)], i is the index of the array
-    double terrestrial_time_julian_century[4];
-    terrestrial_time_julian_century[0] = (terrestrial_time_julian_day - kJulianDateJ2000_) / kDayJulianCentury_;
-    for (int i = 0; i < 3; i++) {
-      terrestrial_time_julian_century[i + 1] = terrestrial_time_julian_century[i] * terrestrial_time_julian_century[0];
-    }
-
-    math::Matrix<3, 3> dcm_precession;
-    math::Matrix<3, 3> dcm_nutation;
+    math::Matrix<3, 3> dcm_nutation_precession;
     math::Matrix<3, 3> dcm_rotation;
     math::Matrix<3, 3> dcm_polar_motion;
     // Nutation + Precession
-    dcm_precession = Precession(terrestrial_time_julian_century);
-    dcm_nutation = Nutation(terrestrial_time_julian_century);  // epsilon_rad_, d_epsilon_rad_, d_psi_rad_ are updated in this procedure
+    double equinox_rad;  // Equation of equinoxes [rad]
+    if (precession_nutation_update_interval_s_ > 0.0) {
+      equinox_rad = InterpolateNutationPrecession(julian_date, dcm_nutation_precession);
+    } else {
+      equinox_rad = CalcNutationPrecession(julian_date, dcm_nutation_precession);
+    }
 
     // Axial Rotation
-    double equinox_rad = d_psi_rad_ * cos(epsilon_rad_ + d_epsilon_rad_);  // Equation of equinoxes [rad]
-    double gast_rad = gmst_rad + equinox_rad;                              // Greenwich 'Apparent' Sidereal Time [rad]
+    double gast_rad = gmst_rad + equinox_rad;  // Greenwich 'Apparent' Sidereal Time [rad]
     dcm_rotation = AxialRotation(gast_rad);
     // Polar motion (is not considered so far, even without polar motion, the result agrees well with the matlab reference)
     double x_p = 0.0;
@@ -145,7 +136,7 @@ void EarthRotation::Update(const double julian_date) {
     dcm_polar_motion = PolarMotion(x_p, y_p);
 
     // Total orientation
-    dcm_j2000_to_ecef_ = dcm_polar_motion * dcm_rotation * dcm_nutation * dcm_precession;
+    dcm_j2000_to_ecef_ = dcm_polar_motion * dcm_rotation * dcm_nutation_precession;
   } else if (rotation_mode_ == EarthRotationMode::kSimple) {
     // In this case, only Axial Rotation is executed, with its argument replaced from G'A'ST to G'M'ST
     // FIXME: Not suitable when the center body is not the earth
@@ -156,6 +147,56 @@ void EarthRotation::Update(const double julian_date) {
   }
 }
 
+void EarthRotation::SetPrecessionNutationUpdateInterval(const double update_interval_s) {
+  precession_nutation_update_interval_s_ = update_interval_s;
+  is_interpolation_initialized_ = false;
+}
+
+double EarthRotation::CalcNutationPrecession(const double julian_date, math::Matrix<3, 3>& dcm_nutation_precession) {
+  // Compute Julian date for terrestrial time
+  double terrestrial_time_julian_day =
+      julian_date + kDtUt1Utc_ * kSec2Day_;  // TODO: Check the correctness. Problem is that S2E doesn't have Gregorian calendar.
+
+  // Compute nth power of julian century for terrestrial time.
+  // The actual unit of tTT_century is [century^(i+1)], i is the index of the array
+  double terrestrial_time_julian_century[4];
+  terrestrial_time_julian_century[0] = (terrestrial_time_julian_day - kJulianDateJ2000_) / kDayJulianCentury_;
+  for (int i = 0; i < 3; i++) {
+    terrestrial_time_julian_century[i + 1] = terrestrial_time_julian_century[i] * terrestrial_time_julian_century[0];
+  }
+
+  math::Matrix<3, 3> dcm_precession = Precession(terrestrial_time_julian_century);
+  math::Matrix<3, 3> dcm_nutation = Nutation(terrestrial_time_julian_century);  // epsilon_rad_, d_epsilon_rad_, d_psi_rad_ are updated
+  dcm_nutation_precession = dcm_nutation * dcm_precession;
+
+  return d_psi_rad_ * cos(epsilon_rad_ + d_epsilon_rad_);
+}
+
+double EarthRotation::InterpolateNutationPrecession(const double julian_date, math::Matrix<3, 3>& dcm_nutation_precession) {
+  const double interval_day = precession_nutation_update_interval_s_ * kSec2Day_;
+  // The samples are placed on a fixed grid so that the result does not depend on the start time
+  const int64_t grid_index = (int64_t)floor(julian_date / interval_day);
+  if (!is_interpolation_initialized_ || grid_index != interpolation_grid_index_) {
+    const double start_julian_date = (double)grid_index * interval_day;
+    if (is_interpolation_initialized_ && grid_index == interpolation_grid_index_ + 1) {
+      // Reuse the end sample when moving to the next interval
+      dcm_nutation_precession_start_ = dcm_nutation_precession_end_;
+      equinox_start_rad_ = equinox_end_rad_;
+    } else {
+      equinox_start_rad_ = CalcNutationPrecession(start_julian_date, dcm_nutation_precession_start_);
+    }
+    equinox_end_rad_ = CalcNutationPrecession((double)(grid_index + 1) * interval_day, dcm_nutation_precession_end_);
+    interpolation_grid_index_ = grid_index;
+    interpolation_start_julian_date_ = start_julian_date;
+    is_interpolation_initialized_ = true;
+  }
+
+  // The matrix rotates only by tiny angles in the interval, so the orthogonality error of the element-wise interpolation is negligible
+  const double ratio = (julian_date - interpolation_start_julian_date_) / interval_day;
+  dcm_nutation_precession = (1.0 - ratio) * dcm_nutation_precession_start_ + ratio * dcm_nutation_precession_end_;
+  return (1.0 - ratio) * equinox_start_rad_ + ratio * equinox_end_rad_;
+}
+
 math::Matrix<3, 3> EarthRotation::AxialRotation(const double gast_rad) { return math::MakeRotationMatrixZ(gast_rad); }
 
 math::Matrix<3, 3> EarthRotation::Nutation(const double (&t_tt_century)[4]) {
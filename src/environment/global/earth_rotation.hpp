@@ -9,6 +9,8 @@
 #ifndef S2E_ENVIRONMENT_GLOBAL_EARTH_ROTATION_HPP_
 #define S2E_ENVIRONMENT_GLOBAL_EARTH_ROTATION_HPP_
 
+#include <stdint.h>
+
 #include "math_physics/math/matrix.hpp"
 
 namespace s2e::environment {
@@ -43,6 +45,15 @@ class EarthRotation {
    */
   void Update(const double julian_date);
 
+  /**
+   * @fn SetPrecessionNutationUpdateInterval
+   * @brief Set update interval of the precession and nutation in the full rotation mode
+   * @note The precession-nutation matrix is evaluated at the grid points of the interval and linearly interpolated between them.
+   *       Only the axial rotation is calculated every update.
+   * @param [in] update_interval_s: Update interval [s]. Zero means the precession and nutation are calculated every update.
+   */
+  void SetPrecessionNutationUpdateInterval(const double update_interval_s);
+
   /**
    * @fn GetDcmJ2000ToEcef
    * @brief Return the DCM between J2000 inertial frame and the Earth Centered Earth Fixed frame
@@ -63,6 +74,16 @@ class EarthRotation {
   math::Matrix<3, 3> dcm_teme_to_ecef_;   //!< Direction Cosine Matrix TEME to ECEF
   EarthRotationMode rotation_mode_;       //!< Designation of dynamics model
 
+  // Interpolation of the precession and nutation
+  double precession_nutation_update_interval_s_ = 0.0;  //!< Update interval of the precession and nutation [s] (zero: every update)
+  int64_t interpolation_grid_index_ = 0;                 //!< Index of the interpolation interval on the grid of the update interval
+  double interpolation_start_julian_date_ = 0.0;         //!< Julian date of the start of the interpolation interval
+  bool is_interpolation_initialized_ = false;            //!< Flag for the interpolation samples
+  math::Matrix<3, 3> dcm_nutation_precession_start_;     //!< Precession-nutation matrix at the start of the interpolation interval
+  math::Matrix<3, 3> dcm_nutation_precession_end_;       //!< Precession-nutation matrix at the end of the interpolation interval
+  double equinox_start_rad_ = 0.0;                       //!< Equation of equinoxes at the start of the interpolation interval [rad]
+  double equinox_end_rad_ = 0.0;                         //!< Equation of equinoxes at the end of the interpolation interval [rad]
+
   // Definitions of coefficients
   // They are handling as constant values
   // TODO: Consider to read setting files for these coefficients
@@ -90,6 +111,23 @@ class EarthRotation {
    */
   void InitializeParameters();
 
+  /**
+   * @fn CalcNutationPrecession
+   * @brief Calculate the slowly varying part of the earth orientation
+   * @param [in] julian_date: Julian date
+   * @param [out] dcm_nutation_precession: Nutation and precession matrix
+   * @return Equation of equinoxes [rad]
+   */
+  double CalcNutationPrecession(const double julian_date, math::Matrix<3, 3>& dcm_nutation_precession);
+  /**
+   * @fn InterpolateNutationPrecession
+   * @brief Interpolate the slowly varying part of the earth orientation with the samples at the update interval
+   * @param [in] julian_date: Julian date
+   * @param [out] dcm_nutation_precession: Nutation and precession matrix
+   * @return Equation of equinoxes [rad]
+   */
+  double InterpolateNutationPrecession(const double julian_date, math::Matrix<3, 3>& dcm_nutation_precession);
+
   /**
    * @fn AxialRotation
    * @brief Calculate movement of the coordinate axes due to rotation around the rotation axis
@@ -29,6 +29,16 @@ void GlobalEnvironment::Initialize(const simulation::SimulationConfiguration* si
   hipparcos_catalogue_ = InitHipparcosCatalogue(simulation_configuration->initialize_base_file_name_);
   gnss_satellites_ = InitGnssSatellites(simulation_configuration->gnss_file_, celestial_information_->GetEarthRotation(), *simulation_time_);
 
+  // Generate ephemeris file for the simulation time span
+  const char* celestial_section = "CELESTIAL_INFORMATION";
+  if (iniAccess.ReadEnable(celestial_section, "generate_ephemeris_file")) {
+    const double start_ephemeris_time_s = simulation_time_->GetCurrentEphemerisTime();
+    celestial_information_->WriteEphemerisFile(iniAccess.ReadString(celestial_section, "ephemeris_file"), start_ephemeris_time_s,
+                                               start_ephemeris_time_s + simulation_time_->GetEndTime_s(),
+                                               iniAccess.ReadDouble(celestial_section, "ephemeris_file_segment_length_s"),
+                                               (size_t)iniAccess.ReadInt(celestial_section, "ephemeris_file_chebyshev_degree"));
+  }
+
   // Calc initial value
   celestial_information_->UpdateAllObjectsInformation(*simulation_time_);
 }
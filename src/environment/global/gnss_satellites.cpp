@@ -5,6 +5,7 @@
 
 #include "gnss_satellites.hpp"
 
+#include <algorithm>
 #include <math_physics/gnss/igs_product_name_handling.hpp>
 #include <math_physics/gnss/sp3_file_reader.hpp>
 
@@ -20,39 +21,35 @@ using namespace s2e::gnss;
 namespace s2e::environment {
 
 const size_t kNumberOfInterpolation = 9;
+const double kOrbitalPeriodCorrection_s = 24 * 60 * 60 * 1.003;  // See http://acc.igs.org/orbits/orbit-interp_gpssoln03.pdf
 
 void GnssSatellites::Initialize(const std::vector<Sp3FileReader>& sp3_files, const time_system::EpochTime start_time) {
-  sp3_files_ = sp3_files;
   current_epoch_time_ = start_time;
 
-  // Get the initialize SP3 file
-  Sp3FileReader initial_sp3_file = sp3_files_[0];
-  if (!GetCurrentSp3File(initial_sp3_file, start_time)) {
+  // Concatenate all SP3 files into the table
+  for (const Sp3FileReader& sp3_file : sp3_files) {
+    ephemeris_table_.AddSp3File(sp3_file);
+  }
+  const size_t number_of_epochs = ephemeris_table_.GetNumberOfEpochs();
+  const double start_time_s = ephemeris_table_.CalcElapsedTime_s(start_time);
+  if (number_of_epochs < kNumberOfInterpolation || start_time_s < 0.0 || start_time_s > ephemeris_table_.GetEpochTime_s(number_of_epochs - 1)) {
     std::cout << "[Error] GNSS satellites: Calculation time mismatch with SP3 files." << std::endl;
     return;
   }
 
   // Get general info
-  number_of_calculated_gnss_satellites_ = initial_sp3_file.GetNumberOfSatellites();
-  const size_t nearest_epoch_id = initial_sp3_file.SearchNearestEpochId(start_time);
+  number_of_calculated_gnss_satellites_ = ephemeris_table_.GetNumberOfSatellites();
+  const size_t nearest_epoch_id = ephemeris_table_.SearchNearestEpochId(start_time);
   const size_t half_interpolation_number = kNumberOfInterpolation / 2;
   if (nearest_epoch_id >= half_interpolation_number) {
-    reference_interpolation_id_ = nearest_epoch_id - half_interpolation_number;
+    interpolation_start_epoch_id_ = std::min(nearest_epoch_id - half_interpolation_number, number_of_epochs - kNumberOfInterpolation);
   }
-  reference_time_ = time_system::EpochTime(initial_sp3_file.GetEpochData(reference_interpolation_id_));
-
-  // Initialize orbit
-  orbit_.assign(number_of_calculated_gnss_satellites_, orbit::InterpolationOrbit(kNumberOfInterpolation));
+  reference_time_s_ = ephemeris_table_.GetEpochTime_s(interpolation_start_epoch_id_);
 
-  // Initialize clock
-  std::vector<double> temp;
-  temp.assign(kNumberOfInterpolation, -1.0);
-  clock_.assign(number_of_calculated_gnss_satellites_, math::Interpolation(temp, temp));
-
-  // Initialize interpolation
-  for (size_t i = 0; i < kNumberOfInterpolation; i++) {
-    UpdateInterpolationInformation();
-  }
+  orbit_interpolation_ = math::BarycentricInterpolation(math::BarycentricInterpolationType::kTrigonometric, math::tau / kOrbitalPeriodCorrection_s);
+  clock_interpolation_ = math::BarycentricInterpolation(math::BarycentricInterpolationType::kPolynomial);
+  SetInterpolationWindow();
+  UpdateAllSatellites();
 
   return;
 }
@@ -61,96 +58,88 @@ void GnssSatellites::Update(const SimulationTime& simulation_time) {
   if (!IsCalcEnabled()) return;
 
   // Get time
-  UTC current_utc = simulation_time.GetCurrentUtc();
-  time_system::DateTime current_date_time((size_t)current_utc.year, (size_t)current_utc.month, (size_t)current_utc.day, (size_t)current_utc.hour,
-                                          (size_t)current_utc.minute, current_utc.second);
-  current_epoch_time_ = time_system::EpochTime(current_date_time);
-
-  // Check interpolation update
-  double diff_s = current_epoch_time_.GetTimeWithFraction_s() - reference_time_.GetTimeWithFraction_s();
-  double medium_time_s = orbit_[0].GetTimeList()[4];
-  if (diff_s > medium_time_s) {
-    UpdateInterpolationInformation();
+  current_epoch_time_ = simulation_time.GetCurrentEpochTime();
+
+  // Slide the interpolation window so that the current time is kept around the center of the window
+  const double current_time_s = ephemeris_table_.CalcElapsedTime_s(current_epoch_time_);
+  const size_t half_interpolation_number = kNumberOfInterpolation / 2;
+  const size_t previous_start_epoch_id = interpolation_start_epoch_id_;
+  while (interpolation_start_epoch_id_ + kNumberOfInterpolation < ephemeris_table_.GetNumberOfEpochs() &&
+         current_time_s > ephemeris_table_.GetEpochTime_s(interpolation_start_epoch_id_ + half_interpolation_number)) {
+    interpolation_start_epoch_id_++;
   }
+  if (number_of_calculated_gnss_satellites_ == 0) return;
+  if (interpolation_start_epoch_id_ != previous_start_epoch_id) SetInterpolationWindow();
+
+  UpdateAllSatellites();
 
   return;
 }
 
-math::Vector<3> GnssSatellites::GetPosition_ecef_m(const size_t gnss_satellite_id, const time_system::EpochTime time) const {
-  if (gnss_satellite_id > number_of_calculated_gnss_satellites_) return math::Vector<3>(0.0);
-
-  time_system::EpochTime target_time;
+void GnssSatellites::SetInterpolationWindow() {
+  const double* window_epoch_times_s = &ephemeris_table_.GetEpochTimes_s()[interpolation_start_epoch_id_];
+  orbit_interpolation_.SetNodes(window_epoch_times_s, kNumberOfInterpolation);
+  clock_interpolation_.SetNodes(window_epoch_times_s, kNumberOfInterpolation);
+}
 
-  if (time.GetTime_s() == 0) {
-    target_time = current_epoch_time_;
-  } else {
-    target_time = time;
+void GnssSatellites::UpdateAllSatellites() {
+  const double time_s = ephemeris_table_.CalcElapsedTime_s(current_epoch_time_);
+  const double diff_s = time_s - reference_time_s_;
+  if (diff_s < 0.0 || diff_s > 1e6) {
+    positions_ecef_m_.assign(number_of_calculated_gnss_satellites_, math::Vector<3>(0.0));
+    velocities_ecef_m_s_.assign(number_of_calculated_gnss_satellites_, math::Vector<3>(0.0));
+    positions_eci_m_.assign(number_of_calculated_gnss_satellites_, math::Vector<3>(0.0));
+    velocities_eci_m_s_.assign(number_of_calculated_gnss_satellites_, math::Vector<3>(0.0));
+    clock_offsets_s_.assign(number_of_calculated_gnss_satellites_, 0.0);
+    return;
   }
 
-  double diff_s = target_time.GetTimeWithFraction_s() - reference_time_.GetTimeWithFraction_s();
-  if (diff_s < 0.0 || diff_s > 1e6) return math::Vector<3>(0.0);
-
-  const double kOrbitalPeriodCorrection_s = 24 * 60 * 60 * 1.003;  // See http://acc.igs.org/orbits/orbit-interp_gpssoln03.pdf
-  return orbit_[gnss_satellite_id].CalcPositionWithTrigonometric(diff_s, math::tau / kOrbitalPeriodCorrection_s);
+  // The basis is shared by all satellites
+  interpolation_basis_.resize(kNumberOfInterpolation);
+  orbit_interpolation_.CalcBasis(time_s, interpolation_basis_.data());
+  ephemeris_table_.CalcAllPositions_m(interpolation_start_epoch_id_, interpolation_basis_, positions_ecef_m_);
+  orbit_interpolation_.CalcBasisDerivative(time_s, interpolation_basis_.data());
+  ephemeris_table_.CalcAllPositions_m(interpolation_start_epoch_id_, interpolation_basis_, velocities_ecef_m_s_);
+  clock_interpolation_.CalcBasis(time_s, interpolation_basis_.data());
+  ephemeris_table_.CalcAllClockOffsets_s(interpolation_start_epoch_id_, interpolation_basis_, clock_offsets_s_);
+
+  // Inertial frame values shared by all GNSS receivers
+  const math::Matrix<3, 3> dcm_ecef_to_eci = earth_rotation_.GetDcmJ2000ToEcef().Transpose();
+  math::Vector<3> earth_angular_velocity_ecef_rad_s(0.0);
+  earth_angular_velocity_ecef_rad_s[2] = environment::earth_mean_angular_velocity_rad_s;
+  positions_eci_m_.resize(number_of_calculated_gnss_satellites_);
+  velocities_eci_m_s_.resize(number_of_calculated_gnss_satellites_);
+  for (size_t i = 0; i < number_of_calculated_gnss_satellites_; i++) {
+    positions_eci_m_[i] = dcm_ecef_to_eci * positions_ecef_m_[i];
+    velocities_eci_m_s_[i] = dcm_ecef_to_eci * (velocities_ecef_m_s_[i] + OuterProduct(earth_angular_velocity_ecef_rad_s, positions_ecef_m_[i]));
+  }
 }
 
-double GnssSatellites::GetClock_s(const size_t gnss_satellite_id, const time_system::EpochTime time) const {
-  if (gnss_satellite_id > number_of_calculated_gnss_satellites_) return 0.0;
-
-  time_system::EpochTime target_time;
+math::Vector<3> GnssSatellites::GetPosition_ecef_m(const size_t gnss_satellite_id, const time_system::EpochTime time) const {
+  if (gnss_satellite_id >= number_of_calculated_gnss_satellites_) return math::Vector<3>(0.0);
 
-  if (time.GetTime_s() == 0) {
-    target_time = current_epoch_time_;
-  } else {
-    target_time = time;
-  }
+  // The result at the last updated time is calculated in Update
+  if (time.GetTime_s() == 0) return positions_ecef_m_[gnss_satellite_id];
 
-  double diff_s = target_time.GetTimeWithFraction_s() - reference_time_.GetTimeWithFraction_s();
-  if (diff_s < 0.0 || diff_s > 1e6) return 0.0;
-
-  return clock_[gnss_satellite_id].CalcPolynomial(diff_s) * 1e-6;
-}
+  const double time_s = ephemeris_table_.CalcElapsedTime_s(time);
+  double diff_s = time_s - reference_time_s_;
+  if (diff_s < 0.0 || diff_s > 1e6) return math::Vector<3>(0.0);
 
-bool GnssSatellites::GetCurrentSp3File(Sp3FileReader& current_sp3_file, const time_system::EpochTime current_time) {
-  for (size_t i = 0; i < sp3_files_.size(); i++) {
-    time_system::EpochTime sp3_start_time(sp3_files_[i].GetStartEpochDateTime());
-    double diff_s = current_time.GetTimeWithFraction_s() - sp3_start_time.GetTimeWithFraction_s();
-    if (diff_s < 0.0) {
-      // Error
-      return false;
-    } else if (diff_s < 24 * 60 * 60) {
-      current_sp3_file = sp3_files_[i];
-      sp3_file_id_ = i;
-      return true;
-    }
-  }
-  return false;
+  return ephemeris_table_.CalcPositionWithTrigonometric_m(gnss_satellite_id, interpolation_start_epoch_id_, kNumberOfInterpolation, time_s,
+                                                          math::tau / kOrbitalPeriodCorrection_s);
 }
 
-bool GnssSatellites::UpdateInterpolationInformation() {
-  Sp3FileReader sp3_file = sp3_files_[sp3_file_id_];
+double GnssSatellites::GetClock_s(const size_t gnss_satellite_id, const time_system::EpochTime time) const {
+  if (gnss_satellite_id >= number_of_calculated_gnss_satellites_) return 0.0;
 
-  for (size_t gnss_id = 0; gnss_id < number_of_calculated_gnss_satellites_; gnss_id++) {
-    time_system::EpochTime sp3_time = time_system::EpochTime(sp3_file.GetEpochData(reference_interpolation_id_));
-    double time_diff_s = sp3_time.GetTimeWithFraction_s() - reference_time_.GetTimeWithFraction_s();
-    math::Vector<3> sp3_position_m = 1000.0 * sp3_file.GetSatellitePosition_km(reference_interpolation_id_, gnss_id);
+  // The result at the last updated time is calculated in Update
+  if (time.GetTime_s() == 0) return clock_offsets_s_[gnss_satellite_id];
 
-    orbit_[gnss_id].PushAndPopData(time_diff_s, sp3_position_m);
-    clock_[gnss_id].PushAndPopData(time_diff_s, sp3_file.GetSatelliteClockOffset(reference_interpolation_id_, gnss_id));
-  }
-  reference_interpolation_id_++;
-
-  // File update
-  if (reference_interpolation_id_ >= sp3_file.GetNumberOfEpoch()) {
-    reference_interpolation_id_ = 0;
-    sp3_file_id_++;
-    if (sp3_file_id_ >= sp3_files_.size()) {
-      std::cout << "[Error] GNSS satellites: SP3 file range over." << std::endl;
-      return false;
-    }
-  }
+  const double time_s = ephemeris_table_.CalcElapsedTime_s(time);
+  double diff_s = time_s - reference_time_s_;
+  if (diff_s < 0.0 || diff_s > 1e6) return 0.0;
 
-  return true;
+  return ephemeris_table_.CalcClockOffsetWithPolynomial_s(gnss_satellite_id, interpolation_start_epoch_id_, kNumberOfInterpolation, time_s);
 }
 
 std::string GnssSatellites::GetLogHeader() const {
@@ -196,6 +185,8 @@ GnssSatellites* InitGnssSatellites(const std::string file_name, const EarthRotat
   if (clock_file_name_footer == (orbit_data_period + "_ORB.SP3")) {
     use_sp3_for_clock = true;
   }
+  // Binary cache of the SP3 files to skip the text parsing from the next run
+  const bool use_sp3_cache_file = ini_file.ReadEnable(section, "use_sp3_cache_file");
 
   // Duration
   const size_t start_date = (size_t)ini_file.ReadInt(section, "start_date");
@@ -213,7 +204,8 @@ GnssSatellites* InitGnssSatellites(const std::string file_name, const EarthRotat
     std::string sp3_full_file_path = directory_path + sp3_file_name;
 
     // Read SP3
-    sp3_file_readers.push_back(Sp3FileReader(sp3_full_file_path));
+    const std::string sp3_cache_file_path = use_sp3_cache_file ? sp3_full_file_path + ".s2ecache" : "";
+    sp3_file_readers.push_back(Sp3FileReader(sp3_full_file_path, sp3_cache_file_path));
 
     // Clock file
     if (!use_sp3_for_clock) {
@@ -228,11 +220,7 @@ GnssSatellites* InitGnssSatellites(const std::string file_name, const EarthRotat
   }
 
   //
-  time_system::DateTime start_date_time((size_t)simulation_time.GetStartYear(), (size_t)simulation_time.GetStartMonth(),
-                                        (size_t)simulation_time.GetStartDay(), (size_t)simulation_time.GetStartHour(),
-                                        (size_t)simulation_time.GetStartMinute(), simulation_time.GetStartSecond());
-  time_system::EpochTime start_epoch_time(start_date_time);
-  gnss_satellites->Initialize(sp3_file_readers, start_epoch_time);
+  gnss_satellites->Initialize(sp3_file_readers, simulation_time.GetStartEpochTime());
 
   return gnss_satellites;
 }
@@ -7,10 +7,10 @@
 #ifndef S2E_ENVIRONMENT_GLOBAL_GNSS_SATELLITES_HPP_
 #define S2E_ENVIRONMENT_GLOBAL_GNSS_SATELLITES_HPP_
 
+#include <math_physics/gnss/sp3_ephemeris_table.hpp>
 #include <math_physics/gnss/sp3_file_reader.hpp>
 #include <math_physics/math/constants.hpp>
 #include <math_physics/math/matrix_vector.hpp>
-#include <math_physics/orbit/interpolation_orbit.hpp>
 #include <math_physics/time_system/epoch_time.hpp>
 #include <math_physics/time_system/gps_time.hpp>
 #include <vector>
@@ -77,10 +77,30 @@ class GnssSatellites : public logger::ILoggable {
    */
   void Update(const SimulationTime& simulation_time);
 
+  /**
+   * @fn GetPosition_eci_m
+   * @brief Return GNSS satellite position at ECI frame at the last updated time
+   * @param [in] gnss_satellite_id: ID of GNSS satellite
+   */
   inline math::Vector<3> GetPosition_eci_m(const size_t gnss_satellite_id) const {
-    // TODO: Add target time for earth rotation calculation
-    return earth_rotation_.GetDcmJ2000ToEcef().Transpose() * GetPosition_ecef_m(gnss_satellite_id);
+    if (gnss_satellite_id >= number_of_calculated_gnss_satellites_) return math::Vector<3>(0.0);
+    return positions_eci_m_[gnss_satellite_id];
   }
+  /**
+   * @fn GetPositions_eci_m
+   * @brief Return positions of all GNSS satellites at ECI frame at the last updated time [m]
+   */
+  inline const std::vector<math::Vector<3>>& GetPositions_eci_m() const { return positions_eci_m_; }
+  /**
+   * @fn GetVelocities_eci_m_s
+   * @brief Return velocities of all GNSS satellites at ECI frame at the last updated time [m/s]
+   */
+  inline const std::vector<math::Vector<3>>& GetVelocities_eci_m_s() const { return velocities_eci_m_s_; }
+  /**
+   * @fn GetClockOffsets_s
+   * @brief Return clock offsets of all GNSS satellites at the last updated time [s]
+   */
+  inline const std::vector<double>& GetClockOffsets_s() const { return clock_offsets_s_; }
 
   /**
    * @fn GetPosition_ecef_m
@@ -115,34 +135,35 @@ class GnssSatellites : public logger::ILoggable {
  private:
   bool is_calc_enabled_ = false;  //!< Flag to manage the GNSS satellite position calculation
 
-  std::vector<gnss::Sp3FileReader> sp3_files_;   //!< List of SP3 files
-  size_t number_of_calculated_gnss_satellites_;  //!< Number of calculated GNSS satellites
-  size_t sp3_file_id_;                           //!< Current SP3 file ID
-  time_system::EpochTime reference_time_;        //!< Reference start time of the SP3 handling
-  size_t reference_interpolation_id_ = 0;        //!< Reference epoch ID of the interpolation
-  time_system::EpochTime current_epoch_time_;    //!< The last updated time
-
-  std::vector<orbit::InterpolationOrbit> orbit_;  //!< GNSS satellite orbit with interpolation
-  std::vector<math::Interpolation> clock_;        //!< GNSS satellite clock offset with interpolation
+  gnss::Sp3EphemerisTable ephemeris_table_;          //!< Orbit and clock of all epochs in the SP3 files
+  size_t number_of_calculated_gnss_satellites_ = 0;  //!< Number of calculated GNSS satellites
+  double reference_time_s_ = 0.0;                    //!< Reference start time of the SP3 handling from the first epoch of the table [s]
+  size_t interpolation_start_epoch_id_ = 0;          //!< Start epoch ID of the interpolation window
+  time_system::EpochTime current_epoch_time_;        //!< The last updated time
+
+  // Interpolation over the window shared by all satellites
+  math::BarycentricInterpolation orbit_interpolation_;  //!< Trigonometric interpolation for the orbit
+  math::BarycentricInterpolation clock_interpolation_;  //!< Polynomial interpolation for the clock
+  std::vector<double> interpolation_basis_;             //!< Interpolation basis at the last updated time
+  std::vector<math::Vector<3>> positions_ecef_m_;       //!< Positions of all satellites at the last updated time [m]
+  std::vector<math::Vector<3>> velocities_ecef_m_s_;    //!< Velocities of all satellites at the last updated time [m/s]
+  std::vector<math::Vector<3>> positions_eci_m_;        //!< Positions of all satellites in the ECI frame at the last updated time [m]
+  std::vector<math::Vector<3>> velocities_eci_m_s_;     //!< Velocities of all satellites in the ECI frame at the last updated time [m/s]
+  std::vector<double> clock_offsets_s_;                 //!< Clock offsets of all satellites at the last updated time [s]
 
   // References
   const EarthRotation& earth_rotation_;  //!< Earth rotation
 
   /**
-   * @fn GetCurrentSp3File
-   * @brief Get the SP3 file should be used at the time
-   * @param [out] current_sp3_file: SP3 file information should be use.
-   * @param [in] current_time: Target time
-   * @return true means no error, false means the time argument is out of range
+   * @fn SetInterpolationWindow
+   * @brief Set the epochs of the current interpolation window as the interpolation nodes
    */
-  bool GetCurrentSp3File(gnss::Sp3FileReader& current_sp3_file, const time_system::EpochTime current_time);
-
+  void SetInterpolationWindow();
   /**
-   * @fn UpdateInterpolationInformation
-   * @brief Update interpolation information by inserting new data
-   * @return true: No error, false: SP3 file out of range error
+   * @fn UpdateAllSatellites
+   * @brief Calculate positions and clock offsets of all satellites at the last updated time
    */
-  bool UpdateInterpolationInformation();
+  void UpdateAllSatellites();
 };
 
 /**
@@ -7,6 +7,8 @@
 
 #include <SpiceUsr.h>
 
+#include <algorithm>
+#include <cmath>
 #include <math_physics/math/constants.hpp>
 #include <math_physics/planet_rotation/moon_rotation_utilities.hpp>
 
@@ -17,25 +19,110 @@ MoonRotation::MoonRotation(const CelestialInformation& celestial_information, Mo
   dcm_j2000_to_mcmf_ = math::MakeIdentityMatrix<3>();
 }
 
-void MoonRotation::Update(const SimulationTime& simulation_time) {
+void MoonRotation::Update(const SimulationTime& simulation_time) { Update(simulation_time.GetCurrentEphemerisTime()); }
+
+void MoonRotation::Update(const double ephemeris_time_s) {
+  if (mode_ == MoonRotationMode::kIdle) {
+    dcm_j2000_to_mcmf_ = math::MakeIdentityMatrix<3>();
+    return;
+  }
+
+  if (update_interval_s_ <= 0.0) {
+    dcm_j2000_to_mcmf_ = CalcDcmJ2000ToMcmf(ephemeris_time_s);
+    return;
+  }
+
+  UpdateInterpolationSamples(ephemeris_time_s);
+
+  // Spherical linear interpolation of the quaternion
+  const double ratio = (ephemeris_time_s - interpolation_start_time_s_) / (interpolation_end_time_s_ - interpolation_start_time_s_);
+  math::Quaternion q_start = quaternion_j2000_to_mcmf_start_;
+  math::Quaternion q_end = quaternion_j2000_to_mcmf_end_;
+  double cos_angle = 0.0;
+  for (size_t i = 0; i < 4; i++) cos_angle += q_start[i] * q_end[i];
+  const double sign = cos_angle < 0.0 ? -1.0 : 1.0;  // Take the shorter path
+  cos_angle = std::min(fabs(cos_angle), 1.0);
+  const double angle_rad = acos(cos_angle);
+  double coefficient_start = 1.0 - ratio;
+  double coefficient_end = ratio;
+  if (angle_rad > 1e-8) {
+    coefficient_start = sin((1.0 - ratio) * angle_rad) / sin(angle_rad);
+    coefficient_end = sin(ratio * angle_rad) / sin(angle_rad);
+  }
+  math::Quaternion quaternion_j2000_to_mcmf;
+  for (size_t i = 0; i < 4; i++) {
+    quaternion_j2000_to_mcmf[i] = coefficient_start * q_start[i] + sign * coefficient_end * q_end[i];
+  }
+  dcm_j2000_to_mcmf_ = quaternion_j2000_to_mcmf.Normalize().ConvertToDcm();
+}
+
+void MoonRotation::SetUpdateInterval(const double update_interval_s) {
+  update_interval_s_ = update_interval_s;
+  is_interpolation_initialized_ = false;
+}
+
+math::Matrix<3, 3> MoonRotation::CalcDcmJ2000ToMcmf(const double ephemeris_time_s) const {
   if (mode_ == MoonRotationMode::kSimple) {
-    math::Vector<3> moon_position_eci_m = celestial_information_.GetPositionFromSelectedBody_i_m("MOON", "EARTH");
-    math::Vector<3> moon_velocity_eci_m_s = celestial_information_.GetVelocityFromSelectedBody_i_m_s("MOON", "EARTH");
-    dcm_j2000_to_mcmf_ = planet_rotation::CalcDcmEciToPrincipalAxis(moon_position_eci_m, moon_velocity_eci_m_s);
+    const unsigned int moon_id = celestial_information_.GetMoonId();
+    const unsigned int earth_id = celestial_information_.GetEarthId();
+    math::Vector<3> moon_position_eci_m = celestial_information_.GetPositionFromSelectedBody_i_m(moon_id, earth_id);
+    math::Vector<3> moon_velocity_eci_m_s = celestial_information_.GetVelocityFromSelectedBody_i_m_s(moon_id, earth_id);
+    return planet_rotation::CalcDcmEciToPrincipalAxis(moon_position_eci_m, moon_velocity_eci_m_s);
   } else if (mode_ == MoonRotationMode::kIauMoon) {
     ConstSpiceChar from[] = "J2000";
     ConstSpiceChar to[] = "IAU_MOON";
-    SpiceDouble et = simulation_time.GetCurrentEphemerisTime();
-    SpiceDouble state_transition_matrix[6][6];
-    sxform_c(from, to, et, state_transition_matrix);
+    // Only the rotation is needed, so the state transformation (sxform_c) is not used
+    SpiceDouble rotation_matrix[3][3];
+    pxform_c(from, to, ephemeris_time_s, rotation_matrix);
+    math::Matrix<3, 3> dcm_j2000_to_mcmf;
     for (size_t i = 0; i < 3; i++) {
       for (size_t j = 0; j < 3; j++) {
-        dcm_j2000_to_mcmf_[i][j] = state_transition_matrix[i][j];
+        dcm_j2000_to_mcmf[i][j] = rotation_matrix[i][j];
       }
     }
+    return dcm_j2000_to_mcmf;
+  }
+  return math::MakeIdentityMatrix<3>();
+}
+
+void MoonRotation::UpdateInterpolationSamples(const double ephemeris_time_s) {
+  if (is_interpolation_initialized_ && ephemeris_time_s >= interpolation_start_time_s_ && ephemeris_time_s < interpolation_end_time_s_) return;
+
+  if (mode_ == MoonRotationMode::kIauMoon) {
+    // The samples are placed on a fixed grid so that the result does not depend on the start time
+    const int64_t grid_index = (int64_t)floor(ephemeris_time_s / update_interval_s_);
+    const double start_time_s = (double)grid_index * update_interval_s_;
+    if (is_interpolation_initialized_ && grid_index == interpolation_grid_index_ + 1) {
+      // Reuse the end sample when moving to the next interval
+      quaternion_j2000_to_mcmf_start_ = quaternion_j2000_to_mcmf_end_;
+    } else {
+      quaternion_j2000_to_mcmf_start_ = math::Quaternion::ConvertFromDcm(CalcDcmJ2000ToMcmf(start_time_s));
+    }
+    quaternion_j2000_to_mcmf_end_ = math::Quaternion::ConvertFromDcm(CalcDcmJ2000ToMcmf((double)(grid_index + 1) * update_interval_s_));
+    interpolation_grid_index_ = grid_index;
+    interpolation_start_time_s_ = start_time_s;
   } else {
-    dcm_j2000_to_mcmf_ = math::MakeIdentityMatrix<3>();
+    // The mean earth frame rotates with the moon orbit, whose angular velocity is r x v / |r|^2
+    const unsigned int moon_id = celestial_information_.GetMoonId();
+    const unsigned int earth_id = celestial_information_.GetEarthId();
+    const math::Vector<3> moon_position_eci_m = celestial_information_.GetPositionFromSelectedBody_i_m(moon_id, earth_id);
+    const math::Vector<3> moon_velocity_eci_m_s = celestial_information_.GetVelocityFromSelectedBody_i_m_s(moon_id, earth_id);
+    const math::Vector<3> angular_velocity_eci_rad_s =
+        1.0 / pow(moon_position_eci_m.CalcNorm(), 2.0) * math::OuterProduct(moon_position_eci_m, moon_velocity_eci_m_s);
+    const double angular_velocity_rad_s = angular_velocity_eci_rad_s.CalcNorm();
+
+    const math::Matrix<3, 3> dcm_start = CalcDcmJ2000ToMcmf(ephemeris_time_s);
+    math::Matrix<3, 3> dcm_end = dcm_start;
+    if (angular_velocity_rad_s > 0.0) {
+      const math::Quaternion rotation(1.0 / angular_velocity_rad_s * angular_velocity_eci_rad_s, angular_velocity_rad_s * update_interval_s_);
+      dcm_end = dcm_start * rotation.ConvertToDcm();
+    }
+    quaternion_j2000_to_mcmf_start_ = math::Quaternion::ConvertFromDcm(dcm_start);
+    quaternion_j2000_to_mcmf_end_ = math::Quaternion::ConvertFromDcm(dcm_end);
+    interpolation_start_time_s_ = ephemeris_time_s;
   }
+  interpolation_end_time_s_ = interpolation_start_time_s_ + update_interval_s_;
+  is_interpolation_initialized_ = true;
 }
 
 MoonRotationMode ConvertMoonRotationMode(const std::string mode) {
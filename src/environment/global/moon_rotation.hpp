@@ -6,8 +6,11 @@
 #ifndef S2E_ENVIRONMENT_GLOBAL_MOON_ROTATION_HPP_
 #define S2E_ENVIRONMENT_GLOBAL_MOON_ROTATION_HPP_
 
+#include <stdint.h>
+
 #include "celestial_information.hpp"
 #include "math_physics/math/matrix.hpp"
+#include "math_physics/math/quaternion.hpp"
 #include "math_physics/math/vector.hpp"
 #include "simulation_time.hpp"
 
@@ -49,19 +52,64 @@ class MoonRotation {
    * @param [in] simulation_time: simulation_time
    */
   void Update(const SimulationTime &simulation_time);
+  /**
+   * @fn Update
+   * @brief Update rotation
+   * @param [in] ephemeris_time_s: Ephemeris time [s]
+   */
+  void Update(const double ephemeris_time_s);
+
+  /**
+   * @fn SetUpdateInterval
+   * @brief Set update interval of the moon fixed frame
+   * @note The frame is evaluated once per interval and interpolated with quaternion between the samples.
+   *       In the IAU_MOON mode, the samples are evaluated at the grid points of the interval.
+   *       In the SIMPLE mode, the moon state is known only at the current time, so the end sample is extrapolated with the rotation rate of
+   *       the mean earth frame.
+   * @param [in] update_interval_s: Update interval [s]. Zero means the frame is calculated every update.
+   */
+  void SetUpdateInterval(const double update_interval_s);
 
   /**
    * @fn GetDcmJ2000ToMcmf
    * @brief Return the DCM between J2000 inertial frame and the Moon Centered Moon Fixed frame
    * @note Because this is just a DCM, users need to consider the origin of the vector, which you want to convert with this matrix.
    */
-  inline const math::Matrix<3, 3> GetDcmJ2000ToMcmf() const { return dcm_j2000_to_mcmf_; };
+  inline const math::Matrix<3, 3> &GetDcmJ2000ToMcmf() const { return dcm_j2000_to_mcmf_; };
+  /**
+   * @fn GetMode
+   * @brief Return the rotation mode
+   */
+  inline MoonRotationMode GetMode() const { return mode_; };
 
  private:
   MoonRotationMode mode_;                 //!< Rotation mode
   math::Matrix<3, 3> dcm_j2000_to_mcmf_;  //!< Direction Cosine Matrix J2000 to MCMF (Moon Centered Moon Fixed)
 
+  // Interpolation of the moon fixed frame
+  double update_interval_s_ = 0.0;                   //!< Update interval of the moon fixed frame [s] (zero: every update)
+  int64_t interpolation_grid_index_ = 0;             //!< Index of the interpolation interval on the grid of the update interval (IAU_MOON)
+  double interpolation_start_time_s_ = 0.0;          //!< Ephemeris time of the start sample [s]
+  double interpolation_end_time_s_ = 0.0;            //!< Ephemeris time of the end sample [s]
+  bool is_interpolation_initialized_ = false;        //!< Flag for the interpolation samples
+  math::Quaternion quaternion_j2000_to_mcmf_start_;  //!< Attitude of the MCMF frame at the start sample
+  math::Quaternion quaternion_j2000_to_mcmf_end_;    //!< Attitude of the MCMF frame at the end sample
+
   const CelestialInformation &celestial_information_;  //!< Celestial Information to get moon orbit
+
+  /**
+   * @fn CalcDcmJ2000ToMcmf
+   * @brief Calculate the DCM with the current rotation mode
+   * @param [in] ephemeris_time_s: Ephemeris time [s]
+   */
+  math::Matrix<3, 3> CalcDcmJ2000ToMcmf(const double ephemeris_time_s) const;
+
+  /**
+   * @fn UpdateInterpolationSamples
+   * @brief Update the samples of the interpolation when the time is out of the current interval
+   * @param [in] ephemeris_time_s: Ephemeris time [s]
+   */
+  void UpdateInterpolationSamples(const double ephemeris_time_s);
 };
 
 }  // namespace s2e::environment
@@ -46,9 +46,9 @@ SimulationTime::SimulationTime(const double end_sec, const double step_sec, cons
   sscanf(start_ymdhms, "%d/%d/%d %d:%d:%lf", &start_year_, &start_month_, &start_day_, &start_hour_, &start_minute_, &start_sec_);
   jday(start_year_, start_month_, start_day_, start_hour_, start_minute_, start_sec_, start_jd_);
   current_jd_ = start_jd_;
-  current_sidereal_ = gstime(current_jd_);
-  JdToDecyear(current_jd_, &current_decyear_);
-  ConvJDtoCalendarDay(current_jd_);
+  start_epoch_time_ = time_system::EpochTime(time_system::DateTime((size_t)start_year_, (size_t)start_month_, (size_t)start_day_,
+                                                                   (size_t)start_hour_, (size_t)start_minute_, start_sec_));
+  ResetTimeConversion();
   AssertTimeStepParams();
   InitializeState();
   SetParameters();
@@ -136,9 +136,7 @@ void SimulationTime::UpdateTime(void) {
   }
 
   current_jd_ = start_jd_ + elapsed_time_sec_ / (60.0 * 60.0 * 24.0);
-  current_sidereal_ = gstime(current_jd_);
-  JdToDecyear(current_jd_, &current_decyear_);
-  ConvJDtoCalendarDay(current_jd_);
+  ResetTimeConversion();
 
   attitude_update_flag_ = false;
   if (double(attitude_update_counter_) * step_sec_ >= attitude_update_interval_sec_) {
@@ -177,6 +175,55 @@ void SimulationTime::UpdateTime(void) {
   state_.running = true;
 }
 
+void SimulationTime::ResetTimeConversion() {
+  is_sidereal_calculated_ = false;
+  is_decyear_calculated_ = false;
+  is_utc_calculated_ = false;
+  is_epoch_time_calculated_ = false;
+  is_gps_time_calculated_ = false;
+}
+
+double SimulationTime::GetCurrentSiderealTime(void) const {
+  if (!is_sidereal_calculated_) {
+    current_sidereal_ = gstime(current_jd_);
+    is_sidereal_calculated_ = true;
+  }
+  return current_sidereal_;
+}
+
+double SimulationTime::GetCurrentDecimalYear(void) const {
+  if (!is_decyear_calculated_) {
+    JdToDecyear(current_jd_, &current_decyear_);
+    is_decyear_calculated_ = true;
+  }
+  return current_decyear_;
+}
+
+const UTC SimulationTime::GetCurrentUtc(void) const {
+  if (!is_utc_calculated_) {
+    ConvJDtoCalendarDay(current_jd_);
+    is_utc_calculated_ = true;
+  }
+  return current_utc_;
+}
+
+const time_system::EpochTime& SimulationTime::GetCurrentEpochTime(void) const {
+  if (!is_epoch_time_calculated_) {
+    const double elapsed_time_integer_s = floor(elapsed_time_sec_);
+    current_epoch_time_ = start_epoch_time_ + time_system::EpochTime((uint64_t)elapsed_time_integer_s, elapsed_time_sec_ - elapsed_time_integer_s);
+    is_epoch_time_calculated_ = true;
+  }
+  return current_epoch_time_;
+}
+
+const time_system::GpsTime& SimulationTime::GetCurrentGpsTime(void) const {
+  if (!is_gps_time_calculated_) {
+    current_gps_time_ = time_system::GpsTime(GetCurrentEpochTime());
+    is_gps_time_calculated_ = true;
+  }
+  return current_gps_time_;
+}
+
 void SimulationTime::ResetClock(void) { clock_start_time_millisec_ = chrono::system_clock::now(); }
 
 void SimulationTime::PrintStartDateTime(void) const {
@@ -217,10 +264,11 @@ string SimulationTime::GetLogValue() const {
 
   const char kSize = 100;
   char ymdhms[kSize];
-  double sec_floor = floor(current_utc_.second * 1e3) / 1e3;
+  const UTC current_utc = GetCurrentUtc();
+  double sec_floor = floor(current_utc.second * 1e3) / 1e3;
 
-  snprintf(ymdhms, kSize, "%4d/%02d/%02d %02d:%02d:%.3f,", current_utc_.year, current_utc_.month, current_utc_.day, current_utc_.hour,
-           current_utc_.minute, sec_floor);
+  snprintf(ymdhms, kSize, "%4d/%02d/%02d %02d:%02d:%.3f,", current_utc.year, current_utc.month, current_utc.day, current_utc.hour,
+           current_utc.minute, sec_floor);
   str_tmp += ymdhms;
 
   return str_tmp;
@@ -234,7 +282,7 @@ void SimulationTime::InitializeState() {
 }
 
 // wrapper function of invjday @ sgp4ext for interface adjustment
-void SimulationTime::ConvJDtoCalendarDay(const double JD) {
+void SimulationTime::ConvJDtoCalendarDay(const double JD) const {
   int year, mon, day, hr, minute;
   double sec;
   invjday(JD, year, mon, day, hr, minute, sec);
@@ -18,6 +18,8 @@
 #include "math_physics/orbit/sgp4/sgp4ext.h"
 #include "math_physics/orbit/sgp4/sgp4io.h"
 #include "math_physics/orbit/sgp4/sgp4unit.h"
+#include "math_physics/time_system/epoch_time.hpp"
+#include "math_physics/time_system/gps_time.hpp"
 
 namespace s2e::environment {
 
@@ -184,32 +186,55 @@ class SimulationTime : public logger::ILoggable {
    */
   inline int GetProgressionRate(void) const { return (int)floor((elapsed_time_sec_ / end_sec_ * 100)); };
 
+  // Representations of the current time
+  // The conversions other than the Julian day are calculated at most once per step when they are requested.
   /**
    *@fn GetCurrentTime_jd
    *@brief Return current Julian day [day]
    */
   inline double GetCurrentTime_jd(void) const { return current_jd_; };
+  /**
+   *@fn GetCurrentTime_mjd
+   *@brief Return current modified Julian day [day]
+   */
+  inline double GetCurrentTime_mjd(void) const { return current_jd_ - 2400000.5; };
   /**
    *@fn GetCurrentSiderealTime
    *@brief Return current sidereal day [day]
    */
-  inline double GetCurrentSiderealTime(void) const { return current_sidereal_; };
+  double GetCurrentSiderealTime(void) const;
   /**
    *@fn GetCurrentDecimalYear
    *@brief Return current decimal year [year]
    */
-  inline double GetCurrentDecimalYear(void) const { return current_decyear_; };
+  double GetCurrentDecimalYear(void) const;
   /**
    *@fn GetCurrentUtc
    *@brief Return current UTC calendar expression
    */
-  inline const UTC GetCurrentUtc(void) const { return current_utc_; };
+  const UTC GetCurrentUtc(void) const;
+  /**
+   *@fn GetCurrentEpochTime
+   *@brief Return current time as the epoch time in UTC
+   *@note It is accumulated from the start epoch with the elapsed time without the calendar conversion
+   */
+  const time_system::EpochTime& GetCurrentEpochTime(void) const;
+  /**
+   *@fn GetCurrentGpsTime
+   *@brief Return current GPS time
+   */
+  const time_system::GpsTime& GetCurrentGpsTime(void) const;
   /**
    *@fn GetCurrentEphemerisTime
    *@brief Return current Ephemeris time
    */
   inline double GetCurrentEphemerisTime(void) const { return start_ephemeris_time_ + elapsed_time_sec_; };
 
+  /**
+   *@fn GetStartEpochTime
+   *@brief Return start time as the epoch time in UTC
+   */
+  inline const time_system::EpochTime& GetStartEpochTime(void) const { return start_epoch_time_; };
   /**
    *@fn GetStartYear
    *@brief Return start time year [year]
@@ -263,9 +288,19 @@ class SimulationTime : public logger::ILoggable {
   // Variables
   double elapsed_time_sec_;  //!< Elapsed time from start of simulation [sec]
   double current_jd_;        //!< Current Julian date [day]
-  double current_sidereal_;  //!< Current Greenwich sidereal time (GST) [day]
-  double current_decyear_;   //!< Current decimal year [year]
-  UTC current_utc_;          //!< UTC calendar day
+
+  // Representations of the current time calculated on request
+  mutable double current_sidereal_;                    //!< Current Greenwich sidereal time (GST) [day]
+  mutable double current_decyear_;                     //!< Current decimal year [year]
+  mutable UTC current_utc_;                            //!< UTC calendar day
+  mutable time_system::EpochTime current_epoch_time_;  //!< Current epoch time in UTC
+  mutable time_system::GpsTime current_gps_time_;      //!< Current GPS time
+  mutable bool is_sidereal_calculated_ = false;        //!< Flag for current_sidereal_ is calculated at the current step
+  mutable bool is_decyear_calculated_ = false;         //!< Flag for current_decyear_ is calculated at the current step
+  mutable bool is_utc_calculated_ = false;             //!< Flag for current_utc_ is calculated at the current step
+  mutable bool is_epoch_time_calculated_ = false;      //!< Flag for current_epoch_time_ is calculated at the current step
+  mutable bool is_gps_time_calculated_ = false;        //!< Flag for current_gps_time_ is calculated at the current step
+  time_system::EpochTime start_epoch_time_;            //!< Start epoch time in UTC
 
   // Timing controller
   int attitude_update_counter_;   //!< Update counter for attitude calculation
@@ -326,7 +361,12 @@ class SimulationTime : public logger::ILoggable {
    * @brief Convert Julian date to UTC Calendar date
    * @note wrapper function of invjday @ sgp4ext for interface adjustment
    */
-  void ConvJDtoCalendarDay(const double JD);
+  void ConvJDtoCalendarDay(const double JD) const;
+  /**
+   * @fn ResetTimeConversion
+   * @brief Mark all representations of the current time as not calculated
+   */
+  void ResetTimeConversion();
 };
 
 /**
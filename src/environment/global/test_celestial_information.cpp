@@ -0,0 +1,52 @@
+/**
+ * @file test_celestial_information.cpp
+ * @brief Test codes for CelestialInformation class in the ephemeris file mode with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "celestial_information.hpp"
+
+using namespace s2e;
+
+/**
+ * @brief Generate an ephemeris with the earth at the origin and the moon in a fixed position
+ */
+static std::shared_ptr<orbit::ChebyshevEphemeris> GenerateEphemeris() {
+  auto ephemeris = std::make_shared<orbit::ChebyshevEphemeris>(0.0, 1.0e6, 1, 1, "J2000", "NONE", "EARTH");
+  const char* names[] = {"EARTH", "MOON"};
+  const int ids[] = {399, 301};
+  for (size_t body_index = 0; body_index < 2; body_index++) {
+    std::vector<std::vector<std::vector<double>>> orbits_km(1, std::vector<std::vector<double>>(2, std::vector<double>(6, 0.0)));
+    for (auto& orbit_km : orbits_km[0]) orbit_km[0] = body_index == 0 ? 0.0 : 384400.0;
+    orbit::EphemerisBodyInformation body;
+    body.id = ids[body_index];
+    body.name = names[body_index];
+    body.gravity_constant_m3_s2 = body_index == 0 ? 3.986004418e14 : 4.9028e12;
+    for (size_t i = 0; i < 3; i++) body.radii_m[i] = body_index == 0 ? 6378137.0 : 1737.4e3;
+    EXPECT_TRUE(ephemeris->AddBody(body, orbits_km));
+  }
+  return ephemeris;
+}
+
+/**
+ * @brief Test for the body names and IDs without SPICE
+ */
+TEST(CelestialInformation, EphemerisFileBodies) {
+  const environment::CelestialInformation celestial_information(GenerateEphemeris(), {"IDLE", "SIMPLE"});
+  EXPECT_EQ(2, celestial_information.GetNumberOfSelectedBodies());
+  EXPECT_EQ(0u, celestial_information.GetEarthId());
+  EXPECT_EQ(1u, celestial_information.GetMoonId());
+  EXPECT_EQ(1, celestial_information.CalcBodyIdFromName("moon"));
+  EXPECT_EQ("MOON", celestial_information.GetSelectedBodyName(1));
+  EXPECT_EQ(environment::MoonRotationMode::kSimple, celestial_information.GetMoonRotation().GetMode());
+}
+
+/**
+ * @brief Test for the rejection of the IAU_MOON rotation which needs SPICE kernels
+ */
+TEST(CelestialInformation, EphemerisFileRejectsIauMoon) {
+  const environment::CelestialInformation celestial_information(GenerateEphemeris(), {"IDLE", "IAU_MOON"});
+  EXPECT_EQ(environment::MoonRotationMode::kIdle, celestial_information.GetMoonRotation().GetMode());
+}
@@ -0,0 +1,68 @@
+/**
+ * @file test_earth_rotation.cpp
+ * @brief Test codes for EarthRotation class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include "earth_rotation.hpp"
+
+using namespace s2e;
+
+/**
+ * @brief Compare the DCM of the interpolated precession and nutation with the direct calculation
+ */
+static void CompareWithDirectCalculation(environment::EarthRotation& interpolated, environment::EarthRotation& direct, const double julian_date,
+                                         const double tolerance) {
+  interpolated.Update(julian_date);
+  direct.Update(julian_date);
+  const math::Matrix<3, 3> dcm_interpolated = interpolated.GetDcmJ2000ToEcef();
+  const math::Matrix<3, 3> dcm_direct = direct.GetDcmJ2000ToEcef();
+  for (size_t i = 0; i < 3; i++) {
+    for (size_t j = 0; j < 3; j++) {
+      EXPECT_NEAR(dcm_direct[i][j], dcm_interpolated[i][j], tolerance);
+    }
+  }
+}
+
+/**
+ * @brief Test of the interpolated precession and nutation over 10 days including the interval boundaries
+ */
+TEST(EarthRotation, InterpolatedPrecessionNutation) {
+  environment::EarthRotation interpolated(environment::EarthRotationMode::kFull);
+  environment::EarthRotation direct(environment::EarthRotationMode::kFull);
+  const double update_interval_s = 3600.0;
+  interpolated.SetPrecessionNutationUpdateInterval(update_interval_s);
+
+  const double start_julian_date = 2460000.25;
+  const double step_s = 67.0;
+  const double tolerance = 5.0e-11;
+  for (double elapsed_time_s = 0.0; elapsed_time_s < 10.0 * 86400.0; elapsed_time_s += step_s) {
+    CompareWithDirectCalculation(interpolated, direct, start_julian_date + elapsed_time_s / 86400.0, tolerance);
+  }
+
+  // Just before, on, and just after the grid points
+  const double grid_julian_date = 2460005.0;
+  for (const double offset_s : {-1.0e-3, 0.0, 1.0e-3, update_interval_s - 1.0e-3, update_interval_s, update_interval_s + 1.0e-3}) {
+    CompareWithDirectCalculation(interpolated, direct, grid_julian_date + offset_s / 86400.0, tolerance);
+  }
+
+  // Backward and forward jumps over several intervals
+  for (const double julian_date : {2460003.1, 2460008.7, 2460000.3}) {
+    CompareWithDirectCalculation(interpolated, direct, julian_date, tolerance);
+  }
+}
+
+/**
+ * @brief Test that the zero update interval gives the direct calculation
+ */
+TEST(EarthRotation, ZeroUpdateInterval) {
+  environment::EarthRotation interpolated(environment::EarthRotationMode::kFull);
+  environment::EarthRotation direct(environment::EarthRotationMode::kFull);
+  interpolated.SetPrecessionNutationUpdateInterval(3600.0);
+  interpolated.Update(2460000.3);
+  interpolated.SetPrecessionNutationUpdateInterval(0.0);
+
+  for (const double julian_date : {2460000.5, 2460001.25}) {
+    CompareWithDirectCalculation(interpolated, direct, julian_date, 0.0);
+  }
+}
@@ -0,0 +1,94 @@
+/**
+ * @file test_moon_rotation.cpp
+ * @brief Test codes for MoonRotation class in the ephemeris file mode with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <memory>
+
+#include "celestial_information.hpp"
+#include "moon_rotation.hpp"
+
+using namespace s2e;
+
+/**
+ * @brief Generate an ephemeris with the earth at the origin and the moon in an inclined circular orbit
+ */
+static std::shared_ptr<orbit::ChebyshevEphemeris> GenerateEphemeris() {
+  const double segment_length_s = 86400.0;
+  const size_t number_of_segments = 2;
+  auto ephemeris = std::make_shared<orbit::ChebyshevEphemeris>(0.0, segment_length_s, number_of_segments, 15, "J2000", "NONE", "EARTH");
+  const double radius_km = 384400.0;
+  const double angular_velocity_rad_s = 2.0 * M_PI / (27.321661 * 86400.0);
+  const double inclination_rad = 0.4;
+
+  const char* names[] = {"EARTH", "MOON"};
+  const int ids[] = {399, 301};
+  for (size_t body_index = 0; body_index < 2; body_index++) {
+    std::vector<std::vector<std::vector<double>>> orbits_km;
+    for (size_t segment_index = 0; segment_index < number_of_segments; segment_index++) {
+      std::vector<std::vector<double>> segment_orbits_km;
+      for (const double ephemeris_time_s : ephemeris->CalcSegmentNodes(segment_index)) {
+        std::vector<double> orbit_km(6, 0.0);
+        if (body_index == 1) {
+          const double angle_rad = angular_velocity_rad_s * ephemeris_time_s;
+          const double speed_km_s = radius_km * angular_velocity_rad_s;
+          orbit_km[0] = radius_km * cos(angle_rad);
+          orbit_km[1] = radius_km * sin(angle_rad) * cos(inclination_rad);
+          orbit_km[2] = radius_km * sin(angle_rad) * sin(inclination_rad);
+          orbit_km[3] = -speed_km_s * sin(angle_rad);
+          orbit_km[4] = speed_km_s * cos(angle_rad) * cos(inclination_rad);
+          orbit_km[5] = speed_km_s * cos(angle_rad) * sin(inclination_rad);
+        }
+        segment_orbits_km.push_back(orbit_km);
+      }
+      orbits_km.push_back(segment_orbits_km);
+    }
+    orbit::EphemerisBodyInformation body;
+    body.id = ids[body_index];
+    body.name = names[body_index];
+    body.gravity_constant_m3_s2 = body_index == 0 ? 3.986004418e14 : 4.9028e12;
+    for (size_t i = 0; i < 3; i++) body.radii_m[i] = body_index == 0 ? 6378137.0 : 1737.4e3;
+    EXPECT_TRUE(ephemeris->AddBody(body, orbits_km));
+  }
+  return ephemeris;
+}
+
+/**
+ * @brief Calculate the maximum difference of the DCMs with and without the interpolation over a day
+ */
+static double CalcMaxDifference(const double update_interval_s, const double step_s) {
+  std::shared_ptr<orbit::ChebyshevEphemeris> ephemeris = GenerateEphemeris();
+  environment::CelestialInformation interpolated(ephemeris, {"IDLE", "SIMPLE"});
+  environment::CelestialInformation direct(ephemeris, {"IDLE", "SIMPLE"});
+  interpolated.GetMoonRotation().SetUpdateInterval(update_interval_s);
+
+  double max_difference = 0.0;
+  for (double ephemeris_time_s = 1000.0; ephemeris_time_s < 87400.0; ephemeris_time_s += step_s) {
+    interpolated.UpdateAllObjectsInformation(ephemeris_time_s, 2451545.0);
+    direct.UpdateAllObjectsInformation(ephemeris_time_s, 2451545.0);
+    const math::Matrix<3, 3> dcm_interpolated = interpolated.GetMoonRotation().GetDcmJ2000ToMcmf();
+    const math::Matrix<3, 3> dcm_direct = direct.GetMoonRotation().GetDcmJ2000ToMcmf();
+    for (size_t i = 0; i < 3; i++) {
+      for (size_t j = 0; j < 3; j++) {
+        max_difference = std::max(max_difference, fabs(dcm_interpolated[i][j] - dcm_direct[i][j]));
+      }
+    }
+  }
+  return max_difference;
+}
+
+/**
+ * @brief Test of the interpolated moon fixed frame in the SIMPLE mode against the direct calculation
+ */
+TEST(MoonRotation, InterpolatedSimpleMode) {
+  // The frame rotates about 2.7e-6 rad/s, so the interpolation error must be far smaller than the rotation in an interval
+  EXPECT_LT(CalcMaxDifference(60.0, 7.0), 1.0e-10);
+  EXPECT_LT(CalcMaxDifference(600.0, 37.0), 1.0e-10);
+}
+
+/**
+ * @brief Test that the zero update interval gives the direct calculation
+ */
+TEST(MoonRotation, ZeroUpdateInterval) { EXPECT_DOUBLE_EQ(0.0, CalcMaxDifference(0.0, 600.0)); }
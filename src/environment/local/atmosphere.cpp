@@ -6,11 +6,10 @@
 #include "atmosphere.hpp"
 
 #include "logger/log_utility.hpp"
-#include "math_physics/atmosphere/harris_priester_model.hpp"
 #include "math_physics/atmosphere/simple_air_density_model.hpp"
+#include "math_physics/math/constants.hpp"
 #include "math_physics/math/vector.hpp"
 #include "math_physics/randomization/global_randomization.hpp"
-#include "math_physics/randomization/normal_randomization.hpp"
 #include "math_physics/randomization/random_walk.hpp"
 #include "setting_file_reader/initialize_file_access.hpp"
 
@@ -18,61 +17,75 @@ namespace s2e::environment {
 
 Atmosphere::Atmosphere(const std::string model, const std::string space_weather_file_name, const double gauss_standard_deviation_rate,
                        const bool is_manual_param, const double manual_f107, const double manual_f107a, const double manual_ap,
-                       const LocalCelestialInformation* local_celestial_information, const SimulationTime* simulation_time)
-    : model_(model),
+                       const LocalCelestialInformation* local_celestial_information, const SimulationTime* simulation_time,
+                       const atmosphere::Nrlmsise00DensityCache nrlmsise00_density_cache)
+    : model_(ConvertAtmosphereModel(model)),
       air_density_kg_m3_(0.0),
       is_manual_param_used_(is_manual_param),
       manual_daily_f107_(manual_f107),
       manual_average_f107_(manual_f107a),
       manual_ap_(manual_ap),
+      nrlmsise00_density_cache_(nrlmsise00_density_cache),
       gauss_standard_deviation_rate_(gauss_standard_deviation_rate),
+      noise_(0.0, 0.0, randomization::global_randomization.MakeSeed()),
       local_celestial_information_(local_celestial_information) {
-  if (model_ == "STANDARD") {
-    // Standard
-    std::cerr << "Air density model : STANDARD" << std::endl;
-  } else if (model_ == "NRLMSISE00") {
-    // NRLMSISE-00
-    std::cerr << "Air density model : NRLMSISE00" << std::endl;
-    if (!is_manual_param_used_) {
-      double decimal_year = simulation_time->GetCurrentDecimalYear();
-      double end_time_s = simulation_time->GetEndTime_s();
-      if (GetSpaceWeatherTable_(decimal_year, end_time_s, space_weather_file_name, space_weather_table_)) {
-      } else {
-        std::cerr << "Space Weather file read error!" << std::endl;
-        std::cerr << "Air density is switched to STANDARD model" << std::endl;
-        model_ = "STANDARD";
+  switch (model_) {
+    case AtmosphereModel::kStandard:
+      std::cerr << "Air density model : STANDARD" << std::endl;
+      break;
+    case AtmosphereModel::kNrlmsise00:
+      std::cerr << "Air density model : NRLMSISE00" << std::endl;
+      if (!is_manual_param_used_) {
+        double decimal_year = simulation_time->GetCurrentDecimalYear();
+        double end_time_s = simulation_time->GetEndTime_s();
+        if (!GetSpaceWeatherTable_(decimal_year, end_time_s, space_weather_file_name, space_weather_table_)) {
+          std::cerr << "Space Weather file read error!" << std::endl;
+          std::cerr << "Air density is switched to STANDARD model" << std::endl;
+          model_ = AtmosphereModel::kStandard;
+        }
       }
-    }
-  } else if (model_ == "HARRIS_PRIESTER") {
-    // Harris-Priester
-    std::cerr << "Air density model : Harris-Priester" << std::endl;
-  } else {
-    std::cerr << "Air density model : None" << std::endl;
-    std::cerr << "Air density is set as 0.0 kg/m3" << std::endl;
+      break;
+    case AtmosphereModel::kHarrisPriester:
+      std::cerr << "Air density model : Harris-Priester" << std::endl;
+      break;
+    default:
+      std::cerr << "Air density model : None" << std::endl;
+      std::cerr << "Air density is set as 0.0 kg/m3" << std::endl;
+      break;
   }
 }
 
 double Atmosphere::CalcAirDensity_kg_m3(const double decimal_year, const dynamics::orbit::Orbit& orbit) {
   if (!is_calc_enabled_) return 0;
 
-  if (model_ == "STANDARD") {
-    // Standard model
-    double altitude_m = orbit.GetGeodeticPosition().GetAltitude_m();
-    air_density_kg_m3_ = atmosphere::CalcAirDensityWithSimpleModel(altitude_m);
-  } else if (model_ == "NRLMSISE00") {
-    // NRLMSISE00 model
-    double lat_rad = orbit.GetGeodeticPosition().GetLatitude_rad();
-    double lon_rad = orbit.GetGeodeticPosition().GetLongitude_rad();
-    double alt_m = orbit.GetGeodeticPosition().GetAltitude_m();
-    air_density_kg_m3_ = CalcNRLMSISE00(decimal_year, lat_rad, lon_rad, alt_m, space_weather_table_, is_manual_param_used_, manual_daily_f107_,
-                                        manual_average_f107_, manual_ap_);
-  } else if (model_ == "HARRIS_PRIESTER") {
-    // Harris-Priester
-    math::Vector<3> sun_direction_eci = local_celestial_information_->GetGlobalInformation().GetPositionFromCenter_i_m("SUN").CalcNormalizedVector();
-    air_density_kg_m3_ = atmosphere::CalcAirDensityWithHarrisPriester_kg_m3(orbit.GetGeodeticPosition(), sun_direction_eci);
-  } else {
-    // No suitable model
-    return air_density_kg_m3_ = 0.0;
+  switch (model_) {
+    case AtmosphereModel::kStandard: {
+      double altitude_m = orbit.GetGeodeticPosition().GetAltitude_m();
+      air_density_kg_m3_ = atmosphere::CalcAirDensityWithSimpleModel(altitude_m);
+      break;
+    }
+    case AtmosphereModel::kNrlmsise00: {
+      double lat_rad = orbit.GetGeodeticPosition().GetLatitude_rad();
+      double lon_rad = orbit.GetGeodeticPosition().GetLongitude_rad();
+      double alt_m = orbit.GetGeodeticPosition().GetAltitude_m();
+      atmosphere::SpaceWeatherParameters space_weather;
+      if (!atmosphere::GetSpaceWeatherParameters(decimal_year, space_weather_table_, is_manual_param_used_, manual_daily_f107_, manual_average_f107_,
+                                                 manual_ap_, space_weather)) {
+        return air_density_kg_m3_ = 0.0;
+      }
+      air_density_kg_m3_ = nrlmsise00_density_cache_.CalcAirDensity_kg_m3(decimal_year, lat_rad, lon_rad, alt_m, space_weather);
+      break;
+    }
+    case AtmosphereModel::kHarrisPriester: {
+      const environment::CelestialInformation& celestial_information = local_celestial_information_->GetGlobalInformation();
+      math::Vector<3> sun_direction_eci = celestial_information.GetPositionFromCenter_i_m(celestial_information.GetSunId()).CalcNormalizedVector();
+      harris_priester_model_.SetSunDirection(sun_direction_eci);
+      air_density_kg_m3_ = harris_priester_model_.CalcAirDensity_kg_m3(orbit.GetGeodeticPosition());
+      break;
+    }
+    default:
+      // No suitable model
+      return air_density_kg_m3_ = 0.0;
   }
 
   return AddNoise(air_density_kg_m3_);
@@ -80,8 +93,9 @@ double Atmosphere::CalcAirDensity_kg_m3(const double decimal_year, const dynamic
 
 double Atmosphere::AddNoise(const double rho_kg_m3) {
   // RandomWalk rw(rho_kg_m3*rw_stepwidth_,rho_kg_m3*rw_stddev_,rho_kg_m3*rw_limit_);
-  randomization::NormalRand nr(0.0, rho_kg_m3 * gauss_standard_deviation_rate_, randomization::global_randomization.MakeSeed());
-  double nrd = nr;
+  // The noise is proportional to the density, so only the standard deviation is updated and the random sequence continues
+  noise_.SetStandardDeviation(rho_kg_m3 * gauss_standard_deviation_rate_);
+  double nrd = noise_;
 
   return rho_kg_m3 + nrd;
 }
@@ -101,6 +115,18 @@ std::string Atmosphere::GetLogHeader() const {
   return str_tmp;
 }
 
+AtmosphereModel ConvertAtmosphereModel(const std::string model) {
+  if (model == "STANDARD") {
+    return AtmosphereModel::kStandard;
+  } else if (model == "NRLMSISE00") {
+    return AtmosphereModel::kNrlmsise00;
+  } else if (model == "HARRIS_PRIESTER") {
+    return AtmosphereModel::kHarrisPriester;
+  } else {
+    return AtmosphereModel::kNone;
+  }
+}
+
 Atmosphere InitAtmosphere(const std::string initialize_file_path, const LocalCelestialInformation* local_celestial_information,
                           const SimulationTime* simulation_time) {
   auto conf = setting_file_reader::IniAccess(initialize_file_path);
@@ -128,8 +154,14 @@ Atmosphere InitAtmosphere(const std::string initialize_file_path, const LocalCel
   }
   double manual_ap = conf.ReadDouble(section, "manual_ap");
 
+  // The cache is disabled when the keys are not set
+  atmosphere::Nrlmsise00DensityCache nrlmsise00_density_cache(conf.ReadDouble(section, "nrlmsise00_cache_latitude_step_deg") * math::deg_to_rad,
+                                                              conf.ReadDouble(section, "nrlmsise00_cache_longitude_step_deg") * math::deg_to_rad,
+                                                              conf.ReadDouble(section, "nrlmsise00_cache_altitude_step_m"),
+                                                              conf.ReadDouble(section, "nrlmsise00_cache_time_validity_s"));
+
   Atmosphere atmosphere(model, table_path, rho_stddev, is_manual_param_used, manual_daily_f107, manual_average_f107, manual_ap,
-                        local_celestial_information, simulation_time);
+                        local_celestial_information, simulation_time, nrlmsise00_density_cache);
   atmosphere.SetCalcFlag(conf.ReadEnable(section, INI_CALC_LABEL));
   atmosphere.is_log_enabled_ = conf.ReadEnable(section, INI_LOG_LABEL);
 
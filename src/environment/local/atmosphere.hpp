@@ -12,11 +12,31 @@
 #include "environment/global/simulation_time.hpp"
 #include "environment/local/local_celestial_information.hpp"
 #include "logger/loggable.hpp"
+#include "math_physics/atmosphere/harris_priester_model.hpp"
+#include "math_physics/atmosphere/nrlmsise00_density_cache.hpp"
 #include "math_physics/atmosphere/wrapper_nrlmsise00.hpp"
 #include "math_physics/math/vector.hpp"
+#include "math_physics/randomization/normal_randomization.hpp"
 
 namespace s2e::environment {
 
+/**
+ * @enum AtmosphereModel
+ * @brief Atmospheric density model
+ */
+enum class AtmosphereModel {
+  kNone,            //!< No atmosphere (density is zero)
+  kStandard,        //!< Simple exponential model
+  kNrlmsise00,      //!< NRLMSISE-00 model
+  kHarrisPriester,  //!< Harris-Priester model
+};
+/**
+ * @fn ConvertAtmosphereModel
+ * @brief Convert string to AtmosphereModel
+ * @param[in] model: model name in string
+ */
+AtmosphereModel ConvertAtmosphereModel(const std::string model);
+
 /**
  * @class Atmosphere
  * @brief Class to calculate earth's atmospheric density
@@ -35,10 +55,12 @@ class Atmosphere : public logger::ILoggable {
    * @param [in] manual_ap: Manual value of ap value
    * @param [in] local_celestial_information: Local Celestial information
    * @param [in] simulation_time: Simulation Time information
+   * @param [in] nrlmsise00_density_cache: Density cache for the NRLMSISE-00 model (disabled by default)
    */
   Atmosphere(const std::string model, const std::string space_weather_file_name, const double gauss_standard_deviation_rate,
              const bool is_manual_param, const double manual_f107, const double manual_f107a, const double manual_ap,
-             const LocalCelestialInformation* local_celestial_information, const SimulationTime* simulation_time);
+             const LocalCelestialInformation* local_celestial_information, const SimulationTime* simulation_time,
+             const atmosphere::Nrlmsise00DensityCache nrlmsise00_density_cache = atmosphere::Nrlmsise00DensityCache());
   /**
    * @fn ~Atmosphere
    * @brief Destructor
@@ -78,19 +100,24 @@ class Atmosphere : public logger::ILoggable {
  private:
   // General information
   bool is_calc_enabled_ = true;  //!< Calculation enable flag
-  std::string model_;            //!< Atmospheric density model name
+  AtmosphereModel model_;        //!< Atmospheric density model
   double air_density_kg_m3_;     //!< Atmospheric density [kg/m^3]
 
   // NRLMSISE-00 model information
-  std::vector<atmosphere::nrlmsise_table> space_weather_table_;  //!< Space weather table
-  bool is_manual_param_used_;                                    //!< Flag to use manual parameters
+  atmosphere::SpaceWeatherTable space_weather_table_;  //!< Space weather table
+  bool is_manual_param_used_;                          //!< Flag to use manual parameters
   // Reference of the following setting parameters https://www.swpc.noaa.gov/phenomena/f107-cm-radio-emissions
   double manual_daily_f107_;    //!< Manual daily f10.7 value
   double manual_average_f107_;  //!< Manual 3-month averaged f10.7 value
   double manual_ap_;            //!< Manual ap value Ref: http://wdc.kugi.kyoto-u.ac.jp/kp/kpexp-j.html
+  atmosphere::Nrlmsise00DensityCache nrlmsise00_density_cache_;  //!< Density cache for the NRLMSISE-00 model
+
+  // Harris-Priester model information
+  atmosphere::HarrisPriesterModel harris_priester_model_;  //!< Harris-Priester model
 
   // Noise Information
   double gauss_standard_deviation_rate_;  //!< Standard deviation of density noise (defined as percentage)
+  randomization::NormalRand noise_;       //!< Density noise generator
   // TODO: Add random walk noise
   //  double rw_stepwidth_;
   //  double rw_stddev_;
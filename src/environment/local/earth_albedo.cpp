@@ -42,7 +42,8 @@ std::string EarthAlbedo::GetLogValue() const {
 }
 
 void EarthAlbedo::CalcEarthAlbedo(const LocalCelestialInformation* local_celestial_information) {
-  math::Vector<3> earth_position_b_m = local_celestial_information->GetPositionFromSpacecraft_b_m("EARTH");
+  const unsigned int earth_id = local_celestial_information->GetGlobalInformation().GetEarthId();
+  math::Vector<3> earth_position_b_m = local_celestial_information->GetPositionFromSpacecraft_b_m(earth_id);
   double earth_distance_m = earth_position_b_m.CalcNorm();
   earth_albedo_W_m2_ = srp_environment_->GetPowerDensity_W_m2() * GetEarthAlbedoFactor() *
                        pow((environment::astronomy::earth_equatorial_radius_m / earth_distance_m), 2.0) / 4.0;
@@ -5,53 +5,98 @@
 
 #include "geomagnetic_field.hpp"
 
-#include "math_physics/geomagnetic/igrf.h"
+#include <algorithm>
+#include <cmath>
+
 #include "math_physics/randomization/global_randomization.hpp"
-#include "math_physics/randomization/normal_randomization.hpp"
-#include "math_physics/randomization/random_walk.hpp"
 #include "setting_file_reader/initialize_file_access.hpp"
 
 namespace s2e::environment {
 
+static const double kSecondsPerYear = 365.25 * 86400.0;  //!< Seconds per Julian year used to convert the decimal year [s]
+static const double kMinimumFieldUpdateInterval_s = 1e-3;  //!< Lower limit of the adaptive IGRF evaluation interval [s]
+
 GeomagneticField::GeomagneticField(const std::string igrf_file_name, const double random_walk_srandard_deviation_nT,
-                                   const double random_walk_limit_nT, const double white_noise_standard_deviation_nT)
+                                   const double random_walk_limit_nT, const double white_noise_standard_deviation_nT,
+                                   const double coefficient_update_period_day, const double field_update_max_interval_s,
+                                   const double field_interpolation_tolerance_nT)
     : magnetic_field_i_nT_(0.0),
       magnetic_field_b_nT_(0.0),
       random_walk_standard_deviation_nT_(random_walk_srandard_deviation_nT),
       random_walk_limit_nT_(random_walk_limit_nT),
       white_noise_standard_deviation_nT_(white_noise_standard_deviation_nT),
-      igrf_file_name_(igrf_file_name) {
-  set_file_path(igrf_file_name_.c_str());
-}
+      igrf_file_name_(igrf_file_name),
+      coefficient_update_period_year_(coefficient_update_period_day / 365.25),
+      igrf_(std::make_shared<const geomagnetic::Igrf>(igrf_file_name)),
+      random_walk_(0.1, math::Vector<3>(random_walk_srandard_deviation_nT), math::Vector<3>(random_walk_limit_nT)),
+      white_noise_(0.0, white_noise_standard_deviation_nT, randomization::global_randomization.MakeSeed()),
+      field_update_max_interval_s_(field_update_max_interval_s),
+      field_interpolation_tolerance_nT_(field_interpolation_tolerance_nT),
+      field_update_interval_s_(kMinimumFieldUpdateInterval_s) {}
 
 void GeomagneticField::CalcMagneticField(const double decimal_year, const double sidereal_day, const geodesy::GeodeticPosition position,
                                          const math::Quaternion quaternion_i2b) {
   if (!IsCalcEnabled) return;
 
-  const double lat_rad = position.GetLatitude_rad();
-  const double lon_rad = position.GetLongitude_rad();
-  const double alt_m = position.GetAltitude_m();
-
-  double magnetic_field_array_i_nT[3];
-  IgrfCalc(decimal_year, lat_rad, lon_rad, alt_m, sidereal_day, magnetic_field_array_i_nT);
-  AddNoise(magnetic_field_array_i_nT);
-  for (int i = 0; i < 3; ++i) {
-    magnetic_field_i_nT_[i] = magnetic_field_array_i_nT[i];
-  }
+  magnetic_field_i_nT_ = CalcTrueMagneticField_i_nT(decimal_year, sidereal_day, position);
+  AddNoise(magnetic_field_i_nT_);
   magnetic_field_b_nT_ = quaternion_i2b.FrameConversion(magnetic_field_i_nT_);
 }
 
-void GeomagneticField::AddNoise(double* magnetic_field_array_i_nT) {
-  static math::Vector<3> standard_deviation(random_walk_standard_deviation_nT_);
-  static math::Vector<3> limit(random_walk_limit_nT_);
-  static randomization::RandomWalk<3> random_walk(0.1, standard_deviation, limit);
+math::Vector<3> GeomagneticField::CalcTrueMagneticField_i_nT(const double decimal_year, const double sidereal_day,
+                                                             const geodesy::GeodeticPosition& position) {
+  if (field_update_max_interval_s_ <= 0.0) return CalcIgrfMagneticField_i_nT(decimal_year, sidereal_day, position);
+
+  const double time_s = decimal_year * kSecondsPerYear;
+  const double elapsed_time_s = time_s - field_sample_time_s_[1];
+  // Linear extrapolation along the track from the latest two IGRF samples
+  auto estimate_field_i_nT = [&]() {
+    const double ratio = elapsed_time_s / (field_sample_time_s_[1] - field_sample_time_s_[0]);
+    return field_sample_i_nT_[1] + ratio * (field_sample_i_nT_[1] - field_sample_i_nT_[0]);
+  };
+
+  if (number_of_field_samples_ == 2 && elapsed_time_s > 0.0 && elapsed_time_s < field_update_interval_s_) {
+    return estimate_field_i_nT();
+  }
+
+  const math::Vector<3> igrf_field_i_nT = CalcIgrfMagneticField_i_nT(decimal_year, sidereal_day, position);
+  if (elapsed_time_s <= 0.0) {
+    // Restart the estimation when the time does not go forward (e.g. the decimal year at the new year)
+    number_of_field_samples_ = 0;
+    field_update_interval_s_ = kMinimumFieldUpdateInterval_s;
+  } else if (number_of_field_samples_ == 2) {
+    // The extrapolation error grows with the square of the interval
+    const double error_nT = (estimate_field_i_nT() - igrf_field_i_nT).CalcNorm();
+    if (error_nT > field_interpolation_tolerance_nT_) {
+      field_update_interval_s_ = std::max(0.5 * field_update_interval_s_, kMinimumFieldUpdateInterval_s);
+    } else if (error_nT < 0.25 * field_interpolation_tolerance_nT_) {
+      field_update_interval_s_ = std::min(2.0 * field_update_interval_s_, field_update_max_interval_s_);
+    }
+  }
+
+  field_sample_time_s_[0] = field_sample_time_s_[1];
+  field_sample_i_nT_[0] = field_sample_i_nT_[1];
+  field_sample_time_s_[1] = time_s;
+  field_sample_i_nT_[1] = igrf_field_i_nT;
+  if (number_of_field_samples_ < 2) number_of_field_samples_++;
 
-  static randomization::NormalRand white_noise(0.0, white_noise_standard_deviation_nT_, randomization::global_randomization.MakeSeed());
+  return igrf_field_i_nT;
+}
+
+math::Vector<3> GeomagneticField::CalcIgrfMagneticField_i_nT(const double decimal_year, const double sidereal_day,
+                                                             const geodesy::GeodeticPosition& position) {
+  // The secular variation is slow, so the time-interpolated coefficients are reused within the update period
+  if (igrf_coefficients_.g_nT.empty() || fabs(decimal_year - igrf_coefficients_.decimal_year) > coefficient_update_period_year_) {
+    igrf_coefficients_ = igrf_->CalcCoefficients(decimal_year);
+  }
+  return igrf_->CalcMagneticField_i_nT(igrf_coefficients_, position, sidereal_day);
+}
 
+void GeomagneticField::AddNoise(math::Vector<3>& magnetic_field_i_nT) {
   for (int i = 0; i < 3; ++i) {
-    magnetic_field_array_i_nT[i] += random_walk[i] + white_noise;
+    magnetic_field_i_nT[i] += random_walk_[i] + white_noise_;
   }
-  ++random_walk;  // Update random walk
+  ++random_walk_;  // Update random walk
 }
 
 std::string GeomagneticField::GetLogHeader() const {
@@ -80,8 +125,12 @@ GeomagneticField InitGeomagneticField(std::string initialize_file_path) {
   double mag_rwdev = conf.ReadDouble(section, "magnetic_field_random_walk_standard_deviation_nT");
   double mag_rwlimit = conf.ReadDouble(section, "magnetic_field_random_walk_limit_nT");
   double mag_wnvar = conf.ReadDouble(section, "magnetic_field_white_noise_standard_deviation_nT");
+  double coefficient_update_period_day = conf.ReadDouble(section, "coefficient_update_period_day");
+  double field_update_max_interval_s = conf.ReadDouble(section, "field_update_max_interval_s");
+  double field_interpolation_tolerance_nT = conf.ReadDouble(section, "field_interpolation_tolerance_nT");
 
-  GeomagneticField geomagnetic_field(fname, mag_rwdev, mag_rwlimit, mag_wnvar);
+  GeomagneticField geomagnetic_field(fname, mag_rwdev, mag_rwlimit, mag_wnvar, coefficient_update_period_day, field_update_max_interval_s,
+                                     field_interpolation_tolerance_nT);
   geomagnetic_field.IsCalcEnabled = conf.ReadEnable(section, INI_CALC_LABEL);
   geomagnetic_field.is_log_enabled_ = conf.ReadEnable(section, INI_LOG_LABEL);
 
@@ -6,10 +6,15 @@
 #ifndef S2E_ENVIRONMENT_LOCAL_GEOMAGNETIC_FIELD_HPP_
 #define S2E_ENVIRONMENT_LOCAL_GEOMAGNETIC_FIELD_HPP_
 
+#include <memory>
+
 #include "logger/loggable.hpp"
 #include "math_physics/geodesy/geodetic_position.hpp"
+#include "math_physics/geomagnetic/igrf.hpp"
 #include "math_physics/math/quaternion.hpp"
 #include "math_physics/math/vector.hpp"
+#include "math_physics/randomization/normal_randomization.hpp"
+#include "math_physics/randomization/random_walk.hpp"
 
 namespace s2e::environment {
 
@@ -28,9 +33,13 @@ class GeomagneticField : public logger::ILoggable {
    * @param [in] random_walk_srandard_deviation_nT: Standard deviation of Random Walk [nT]
    * @param [in] random_walk_limit_nT: Limit of Random Walk [nT]
    * @param [in] white_noise_standard_deviation_nT: Standard deviation of white noise [nT]
+   * @param [in] coefficient_update_period_day: Update period of the time-interpolated IGRF coefficients [day]. Zero means every call.
+   * @param [in] field_update_max_interval_s: Maximum interval of the full IGRF evaluation [s]. Zero means every call.
+   * @param [in] field_interpolation_tolerance_nT: Tolerance of the field estimated between the IGRF evaluations [nT]
    */
   GeomagneticField(const std::string igrf_file_name, const double random_walk_srandard_deviation_nT, const double random_walk_limit_nT,
-                   const double white_noise_standard_deviation_nT);
+                   const double white_noise_standard_deviation_nT, const double coefficient_update_period_day = 0.0,
+                   const double field_update_max_interval_s = 0.0, const double field_interpolation_tolerance_nT = 0.0);
   /**
    * @fn ~GeomagneticField
    * @brief Destructor
@@ -58,6 +67,11 @@ class GeomagneticField : public logger::ILoggable {
    * @brief Return magnetic field vector in the body fixed frame [nT]
    */
   inline math::Vector<3> GetGeomagneticField_b_nT() const { return magnetic_field_b_nT_; }
+  /**
+   * @fn GetFieldUpdateInterval_s
+   * @brief Return current interval of the full IGRF evaluation [s]
+   */
+  inline double GetFieldUpdateInterval_s() const { return field_update_interval_s_; }
 
   // Override logger::ILoggable
   /**
@@ -78,13 +92,45 @@ class GeomagneticField : public logger::ILoggable {
   double random_walk_limit_nT_;               //!< Limit of Random Walk [nT]
   double white_noise_standard_deviation_nT_;  //!< Standard deviation of white noise [nT]
   std::string igrf_file_name_;                //!< Path to the initialize file
+  double coefficient_update_period_year_;     //!< Update period of the IGRF coefficients [year]
+
+  std::shared_ptr<const geomagnetic::Igrf> igrf_;     //!< IGRF model (read only, shared between copies)
+  geomagnetic::IgrfCoefficients igrf_coefficients_;  //!< Cached time-interpolated IGRF coefficients
+  randomization::RandomWalk<3> random_walk_;          //!< Random walk noise
+  randomization::NormalRand white_noise_;             //!< White noise
 
+  // Along-track estimation of the field between the full IGRF evaluations
+  double field_update_max_interval_s_;       //!< Maximum interval of the full IGRF evaluation [s]
+  double field_interpolation_tolerance_nT_;  //!< Tolerance of the estimated field [nT]
+  double field_update_interval_s_;           //!< Current interval of the full IGRF evaluation [s]
+  size_t number_of_field_samples_ = 0;       //!< Number of valid IGRF samples (up to 2)
+  double field_sample_time_s_[2] = {};       //!< Time of the IGRF samples (older, latest) [s]
+  math::Vector<3> field_sample_i_nT_[2];     //!< IGRF samples in the inertial frame (older, latest) [nT]
+
+  /**
+   * @fn CalcTrueMagneticField_i_nT
+   * @brief Calculate the true magnetic field with the IGRF model or with the along-track estimation
+   * @param [in] decimal_year: Decimal year [year]
+   * @param [in] sidereal_day: Sidereal day [day]
+   * @param [in] position: Position of target point to calculate the magnetic field
+   * @return Magnetic field vector in the inertial frame [nT]
+   */
+  math::Vector<3> CalcTrueMagneticField_i_nT(const double decimal_year, const double sidereal_day, const geodesy::GeodeticPosition& position);
+  /**
+   * @fn CalcIgrfMagneticField_i_nT
+   * @brief Calculate the magnetic field with the IGRF model and the cached coefficients
+   * @param [in] decimal_year: Decimal year [year]
+   * @param [in] sidereal_day: Sidereal day [day]
+   * @param [in] position: Position of target point to calculate the magnetic field
+   * @return Magnetic field vector in the inertial frame [nT]
+   */
+  math::Vector<3> CalcIgrfMagneticField_i_nT(const double decimal_year, const double sidereal_day, const geodesy::GeodeticPosition& position);
   /**
    * @fn AddNoise
    * @brief Add magnetic field noise
-   * @param [in/out] magnetic_field_array_i_nT: input true magnetic field, output magnetic field with noise
+   * @param [in/out] magnetic_field_i_nT: input true magnetic field, output magnetic field with noise
    */
-  void AddNoise(double* magnetic_field_array_i_nT);
+  void AddNoise(math::Vector<3>& magnetic_field_i_nT);
 };
 
 /**
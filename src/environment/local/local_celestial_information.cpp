@@ -5,8 +5,6 @@
 
 #include "local_celestial_information.hpp"
 
-#include <SpiceUsr.h>
-
 #include <algorithm>
 #include <iostream>
 #include <locale>
@@ -17,164 +15,83 @@
 namespace s2e::environment {
 
 LocalCelestialInformation::LocalCelestialInformation(const CelestialInformation* global_celestial_information)
-    : global_celestial_information_(global_celestial_information) {
-  int num_of_state = global_celestial_information_->GetNumberOfSelectedBodies() * 3;
-  celestial_body_position_from_center_b_m_ = new double[num_of_state];
-  celestial_body_velocity_from_center_b_m_s_ = new double[num_of_state];
-  celestial_body_position_from_spacecraft_i_m_ = new double[num_of_state];
-  celestial_body_velocity_from_spacecraft_i_m_s_ = new double[num_of_state];
-  celestial_body_position_from_spacecraft_b_m_ = new double[num_of_state];
-  celestial_body_velocity_from_spacecraft_b_m_s_ = new double[num_of_state];
-
-  for (int i = 0; i < num_of_state; i++) {
-    celestial_body_position_from_center_b_m_[i] = 0.0;
-    celestial_body_velocity_from_center_b_m_s_[i] = 0.0;
-    celestial_body_position_from_spacecraft_i_m_[i] = 0.0;
-    celestial_body_velocity_from_spacecraft_i_m_s_[i] = 0.0;
-    celestial_body_position_from_spacecraft_b_m_[i] = 0.0;
-    celestial_body_velocity_from_spacecraft_b_m_s_[i] = 0.0;
-  }
-}
-
-LocalCelestialInformation::~LocalCelestialInformation() {
-  delete[] celestial_body_position_from_center_b_m_;
-  delete[] celestial_body_velocity_from_center_b_m_s_;
-  delete[] celestial_body_position_from_spacecraft_i_m_;
-  delete[] celestial_body_velocity_from_spacecraft_i_m_s_;
-  delete[] celestial_body_position_from_spacecraft_b_m_;
-  delete[] celestial_body_velocity_from_spacecraft_b_m_s_;
+    : global_celestial_information_(global_celestial_information), spacecraft_angular_velocity_rad_s_(0.0) {
+  const size_t number_of_bodies = global_celestial_information_->GetNumberOfSelectedBodies();
+  celestial_body_position_from_spacecraft_i_m_.assign(number_of_bodies, math::Vector<3>(0.0));
+  celestial_body_velocity_from_spacecraft_i_m_s_.assign(number_of_bodies, math::Vector<3>(0.0));
+  celestial_body_position_from_spacecraft_b_m_.assign(number_of_bodies, math::Vector<3>(0.0));
+  celestial_body_velocity_from_spacecraft_b_m_s_.assign(number_of_bodies, math::Vector<3>(0.0));
+  is_position_b_calculated_.assign(number_of_bodies, true);
+  is_velocity_b_calculated_.assign(number_of_bodies, true);
 }
 
 void LocalCelestialInformation::UpdateAllObjectsInformation(const math::Vector<3> spacecraft_position_from_center_i_m,
                                                             const math::Vector<3> spacecraft_velocity_from_center_i_m_s,
                                                             const math::Quaternion quaternion_i2b,
                                                             const math::Vector<3> spacecraft_angular_velocity_rad_s) {
-  math::Vector<3> celestial_body_position_i_m, celestial_body_velocity_i_m_s;
-  for (int i = 0; i < global_celestial_information_->GetNumberOfSelectedBodies(); i++) {
-    celestial_body_position_i_m = global_celestial_information_->GetPositionFromCenter_i_m(i);
-    celestial_body_velocity_i_m_s = global_celestial_information_->GetVelocityFromCenter_i_m_s(i);
-    // Change origin of frame
-    for (int j = 0; j < 3; j++) {
-      celestial_body_position_from_spacecraft_i_m_[i * 3 + j] = celestial_body_position_i_m[j] - spacecraft_position_from_center_i_m[j];
-      celestial_body_velocity_from_spacecraft_i_m_s_[i * 3 + j] = celestial_body_velocity_i_m_s[j] - spacecraft_velocity_from_center_i_m_s[j];
-    }
+  // Change origin of frame
+  for (size_t i = 0; i < celestial_body_position_from_spacecraft_i_m_.size(); i++) {
+    celestial_body_position_from_spacecraft_i_m_[i] =
+        global_celestial_information_->GetPositionFromCenter_i_m(i) - spacecraft_position_from_center_i_m;
+    celestial_body_velocity_from_spacecraft_i_m_s_[i] =
+        global_celestial_information_->GetVelocityFromCenter_i_m_s(i) - spacecraft_velocity_from_center_i_m_s;
   }
-  CalcAllPosVel_b(quaternion_i2b, spacecraft_angular_velocity_rad_s);
+  quaternion_i2b_ = quaternion_i2b;
+  spacecraft_angular_velocity_rad_s_ = spacecraft_angular_velocity_rad_s;
 
-  return;
+  // Invalidate the body frame information
+  std::fill(is_position_b_calculated_.begin(), is_position_b_calculated_.end(), false);
+  std::fill(is_velocity_b_calculated_.begin(), is_velocity_b_calculated_.end(), false);
 }
 
-void LocalCelestialInformation::CalcAllPosVel_b(const math::Quaternion quaternion_i2b, const math::Vector<3> spacecraft_angular_velocity_rad_s) {
-  math::Vector<3> celestial_body_position_i_m, celestial_body_velocity_i_m_s;
-  double r_buf1_i[3], velocity_buf1_i[3], r_buf1_b[3], velocity_buf1_b[3];
-  double r_buf2_i[3], velocity_buf2_i[3], r_buf2_b[3], velocity_buf2_b[3];
-  for (int i = 0; i < global_celestial_information_->GetNumberOfSelectedBodies(); i++) {
-    celestial_body_position_i_m = global_celestial_information_->GetPositionFromCenter_i_m(i);
-    celestial_body_velocity_i_m_s = global_celestial_information_->GetVelocityFromCenter_i_m_s(i);
-    for (int j = 0; j < 3; j++) {
-      r_buf1_i[j] = celestial_body_position_i_m[j];
-      r_buf2_i[j] = celestial_body_position_from_spacecraft_i_m_[i * 3 + j];
-      velocity_buf1_i[j] = celestial_body_velocity_i_m_s[j];
-      velocity_buf2_i[j] = celestial_body_velocity_from_spacecraft_i_m_s_[i * 3 + j];
-    }
-    ConvertInertialToBody(r_buf1_i, r_buf1_b, quaternion_i2b);
-    ConvertInertialToBody(r_buf2_i, r_buf2_b, quaternion_i2b);
-    ConvertVelocityInertialToBody(r_buf1_i, velocity_buf1_i, velocity_buf1_b, quaternion_i2b, spacecraft_angular_velocity_rad_s);
-    ConvertVelocityInertialToBody(r_buf2_i, velocity_buf2_i, velocity_buf2_b, quaternion_i2b, spacecraft_angular_velocity_rad_s);
-
-    for (int j = 0; j < 3; j++) {
-      celestial_body_position_from_center_b_m_[i * 3 + j] = r_buf1_b[j];
-      celestial_body_position_from_spacecraft_b_m_[i * 3 + j] = r_buf2_b[j];
-      celestial_body_velocity_from_center_b_m_s_[i * 3 + j] = velocity_buf1_b[j];
-      celestial_body_velocity_from_spacecraft_b_m_s_[i * 3 + j] = velocity_buf2_b[j];
-    }
-  }
+math::Vector<3> LocalCelestialInformation::GetPositionFromSpacecraft_i_m(const char* body_name) const {
+  return GetPositionFromSpacecraft_i_m(global_celestial_information_->CalcBodyIdFromName(body_name));
 }
 
-void LocalCelestialInformation::ConvertInertialToBody(const double* input_i, double* output_b, math::Quaternion quaternion_i2b) {
-  math::Vector<3> temp_i;
-  for (int i = 0; i < 3; i++) {
-    temp_i[i] = input_i[i];
-  }
-  math::Vector<3> temp_b = quaternion_i2b.FrameConversion(temp_i);
-  for (int i = 0; i < 3; i++) {
-    output_b[i] = temp_b[i];
-  }
+math::Vector<3> LocalCelestialInformation::GetPositionFromSpacecraft_i_m(const unsigned int id) const {
+  return celestial_body_position_from_spacecraft_i_m_[id];
 }
 
-void LocalCelestialInformation::ConvertVelocityInertialToBody(const double* position_i, const double* velocity_i, double* velocity_b,
-                                                              const math::Quaternion quaternion_i2b, const math::Vector<3> angular_velocity_b) {
-  // copy input vector
-  math::Vector<3> vi;
-  for (int i = 0; i < 3; i++) {
-    vi[i] = velocity_i[i];
-  }
-  math::Vector<3> ri;
-  for (int i = 0; i < 3; i++) {
-    ri[i] = position_i[i];
-  }
-
-  // convert body rate vector into that in inertial coordinate
-  math::Vector<3> wb;
-  for (int i = 0; i < 3; i++) {
-    wb[i] = angular_velocity_b[i];
-  }
+math::Vector<3> LocalCelestialInformation::GetVelocityFromSpacecraft_i_m_s(const unsigned int id) const {
+  return celestial_body_velocity_from_spacecraft_i_m_s_[id];
+}
 
-  // compute cross term wxr
-  math::Vector<3> wxposition_i = OuterProduct(wb, ri);
-  // compute dr/dt + wxr
-  for (int i = 0; i < 3; i++) {
-    vi[i] = vi[i] - wxposition_i[i];
-  }
-  // convert vector in inertial coordinate into that in body coordinate
-  math::Vector<3> temp_b = quaternion_i2b.FrameConversion(vi);
-  for (int i = 0; i < 3; i++) {
-    velocity_b[i] = temp_b[i];
-  }
+math::Vector<3> LocalCelestialInformation::GetCenterBodyPositionFromSpacecraft_i_m() const {
+  return GetPositionFromSpacecraft_i_m(global_celestial_information_->GetCenterBodyId());
 }
 
-math::Vector<3> LocalCelestialInformation::GetPositionFromSpacecraft_i_m(const char* body_name) const {
-  math::Vector<3> position;
-  int index = 0;
-  index = global_celestial_information_->CalcBodyIdFromName(body_name);
-  for (int i = 0; i < 3; i++) {
-    position[i] = celestial_body_position_from_spacecraft_i_m_[index * 3 + i];
-  }
-  return position;
+math::Vector<3> LocalCelestialInformation::GetPositionFromSpacecraft_b_m(const char* body_name) const {
+  return GetPositionFromSpacecraft_b_m(global_celestial_information_->CalcBodyIdFromName(body_name));
 }
 
-math::Vector<3> LocalCelestialInformation::GetCenterBodyPositionFromSpacecraft_i_m() const {
-  std::string body_name = global_celestial_information_->GetCenterBodyName();
-  math::Vector<3> position = GetPositionFromSpacecraft_i_m(body_name.c_str());
-  return position;
+math::Vector<3> LocalCelestialInformation::GetPositionFromSpacecraft_b_m(const unsigned int id) const {
+  if (!is_position_b_calculated_[id]) {
+    celestial_body_position_from_spacecraft_b_m_[id] = quaternion_i2b_.FrameConversion(celestial_body_position_from_spacecraft_i_m_[id]);
+    is_position_b_calculated_[id] = true;
+  }
+  return celestial_body_position_from_spacecraft_b_m_[id];
 }
 
-math::Vector<3> LocalCelestialInformation::GetPositionFromSpacecraft_b_m(const char* body_name) const {
-  math::Vector<3> position;
-  int index = 0;
-  index = global_celestial_information_->CalcBodyIdFromName(body_name);
-  for (int i = 0; i < 3; i++) {
-    position[i] = celestial_body_position_from_spacecraft_b_m_[index * 3 + i];
+math::Vector<3> LocalCelestialInformation::GetVelocityFromSpacecraft_b_m_s(const unsigned int id) const {
+  if (!is_velocity_b_calculated_[id]) {
+    // Remove the rotation of the frame: dr/dt - w x r
+    const math::Vector<3> velocity_i_m_s = celestial_body_velocity_from_spacecraft_i_m_s_[id] -
+                                           OuterProduct(spacecraft_angular_velocity_rad_s_, celestial_body_position_from_spacecraft_i_m_[id]);
+    celestial_body_velocity_from_spacecraft_b_m_s_[id] = quaternion_i2b_.FrameConversion(velocity_i_m_s);
+    is_velocity_b_calculated_[id] = true;
   }
-  return position;
+  return celestial_body_velocity_from_spacecraft_b_m_s_[id];
 }
 
 math::Vector<3> LocalCelestialInformation::GetCenterBodyPositionFromSpacecraft_b_m(void) const {
-  std::string body_name = global_celestial_information_->GetCenterBodyName();
-  math::Vector<3> position = GetPositionFromSpacecraft_b_m(body_name.c_str());
-  return position;
+  return GetPositionFromSpacecraft_b_m(global_celestial_information_->GetCenterBodyId());
 }
 
 std::string LocalCelestialInformation::GetLogHeader() const {
-  SpiceBoolean found;
-  const int maxlen = 100;
-  char namebuf[maxlen];
   std::string str_tmp = "";
   for (int i = 0; i < global_celestial_information_->GetNumberOfSelectedBodies(); i++) {
-    SpiceInt planet_id = global_celestial_information_->GetSelectedBodyIds()[i];
-    // Acquisition of body name from id
-    bodc2n_c(planet_id, maxlen, namebuf, (SpiceBoolean*)&found);
-    std::string name = namebuf;
+    // The names are held by the global information so that SPICE is not needed in the ephemeris file mode
+    std::string name = global_celestial_information_->GetSelectedBodyName(i);
 
     std::locale loc = std::locale::classic();
     std::transform(name.begin(), name.end(), name.begin(), [loc](char c) { return std::tolower(c, loc); });
@@ -189,13 +106,9 @@ std::string LocalCelestialInformation::GetLogHeader() const {
 
 std::string LocalCelestialInformation::GetLogValue() const {
   std::string str_tmp = "";
-  for (int i = 0; i < global_celestial_information_->GetNumberOfSelectedBodies(); i++) {
-    for (int j = 0; j < 3; j++) {
-      str_tmp += logger::WriteScalar(celestial_body_position_from_spacecraft_b_m_[i * 3 + j]);
-    }
-    for (int j = 0; j < 3; j++) {
-      str_tmp += logger::WriteScalar(celestial_body_velocity_from_spacecraft_b_m_s_[i * 3 + j]);
-    }
+  for (size_t i = 0; i < celestial_body_position_from_spacecraft_i_m_.size(); i++) {
+    str_tmp += logger::WriteVector(GetPositionFromSpacecraft_b_m(i));
+    str_tmp += logger::WriteVector(GetVelocityFromSpacecraft_b_m_s(i));
   }
   return str_tmp;
 }
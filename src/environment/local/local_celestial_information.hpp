@@ -6,6 +6,8 @@
 #ifndef S2E_ENVIRONMENT_LOCAL_LOCAL_CELESTIAL_INFORMATION_HPP_
 #define S2E_ENVIRONMENT_LOCAL_LOCAL_CELESTIAL_INFORMATION_HPP_
 
+#include <vector>
+
 #include "../global/celestial_information.hpp"
 
 namespace s2e::environment {
@@ -26,11 +28,13 @@ class LocalCelestialInformation : public logger::ILoggable {
    * @fn ~LocalCelestialInformation
    * @brief Destructor
    */
-  virtual ~LocalCelestialInformation();
+  virtual ~LocalCelestialInformation() {}
 
   /**
    * @fn UpdateAllObjectsInformation
    * @brief Update the all selected celestial object local information
+   * @note Only the inertial frame information is calculated here. The body fixed frame information is calculated when it is requested
+   *       and memoized until the next update.
    * @param [in] spacecraft_position_from_center_i_m: Spacecraft position from the center body in the inertial frame [m]
    * @param [in] spacecraft_velocity_from_center_i_m_s: Spacecraft velocity from the center body in the inertial frame [m/s]
    * @param [in] quaternion_i2b: Spacecraft attitude quaternion from the inertial frame to the body fixed frame
@@ -46,6 +50,18 @@ class LocalCelestialInformation : public logger::ILoggable {
    * @param [in] body_name Celestial body name
    */
   math::Vector<3> GetPositionFromSpacecraft_i_m(const char* body_name) const;
+  /**
+   * @fn GetPositionFromSpacecraft_i_m
+   * @brief Return position of a selected body (Origin: Spacecraft, Frame: Inertial frame)
+   * @param [in] id: ID of CelestialInformation list
+   */
+  math::Vector<3> GetPositionFromSpacecraft_i_m(const unsigned int id) const;
+  /**
+   * @fn GetVelocityFromSpacecraft_i_m_s
+   * @brief Return velocity of a selected body (Origin: Spacecraft, Frame: Inertial frame)
+   * @param [in] id: ID of CelestialInformation list
+   */
+  math::Vector<3> GetVelocityFromSpacecraft_i_m_s(const unsigned int id) const;
   /**
    * @fn GetCenterBodyPositionFromSpacecraft_i_m
    * @brief Return position of the center body (Origin: Spacecraft, Frame: Inertial frame)
@@ -58,6 +74,18 @@ class LocalCelestialInformation : public logger::ILoggable {
    * @param [in] body_name Celestial body name
    */
   math::Vector<3> GetPositionFromSpacecraft_b_m(const char* body_name) const;
+  /**
+   * @fn GetPositionFromSpacecraft_b_m
+   * @brief Return position of a selected body (Origin: Spacecraft, Frame: Body fixed frame)
+   * @param [in] id: ID of CelestialInformation list
+   */
+  math::Vector<3> GetPositionFromSpacecraft_b_m(const unsigned int id) const;
+  /**
+   * @fn GetVelocityFromSpacecraft_b_m_s
+   * @brief Return velocity of a selected body (Origin: Spacecraft, Frame: Body fixed frame)
+   * @param [in] id: ID of CelestialInformation list
+   */
+  math::Vector<3> GetVelocityFromSpacecraft_b_m_s(const unsigned int id) const;
   /**
    * @fn GetCenterBodyPositionFromSpacecraft_b_m
    * @brief Return position of the center body (Origin: Spacecraft, Frame: Body fixed frame)
@@ -85,41 +113,15 @@ class LocalCelestialInformation : public logger::ILoggable {
  private:
   const CelestialInformation* global_celestial_information_;  //!< Global celestial information
   // Local Information
-  double* celestial_body_position_from_spacecraft_i_m_;    //!< Celestial body position from spacecraft in the inertial frame [m]
-  double* celestial_body_velocity_from_spacecraft_i_m_s_;  //!< Celestial body velocity from spacecraft in the inertial frame [m/s]
-  double* celestial_body_position_from_center_b_m_;        //!< Celestial body position from the center body in the spacecraft body fixed frame [m]
-  double* celestial_body_position_from_spacecraft_b_m_;    //!< Celestial body position from the spacecraft in the spacecraft body fixed frame [m]
-  double* celestial_body_velocity_from_center_b_m_s_;      //!< Celestial body velocity from the center body in the spacecraft body fixed frame [m/s]
-  double* celestial_body_velocity_from_spacecraft_b_m_s_;  //!< Celestial body velocity from the spacecraft in the spacecraft body fixed frame [m/s]
-
-  /**
-   * @fn CalcAllPosVel_b
-   * @brief Frame conversion to the body frame for all selected celestial bodies
-   * @param [in] quaternion_i2b: Spacecraft attitude quaternion from the inertial frame to the body fixed frame
-   * @param [in] spacecraft_angular_velocity_rad_s: Spacecraft angular velocity with respect to the inertial frame [rad/s]
-   */
-  void CalcAllPosVel_b(const math::Quaternion quaternion_i2b, const math::Vector<3> spacecraft_angular_velocity_rad_s);
-
-  /**
-   * @fn ConvertInertialToBody
-   * @brief Convert position vector in the inertial frame to the body fixed frame
-   * @param [in] input_i: Source vector in the inertial frame
-   * @param [out] output_b: Output vector in the body fixed frame
-   * @param [in] quaternion_i2b: Spacecraft attitude quaternion from the inertial frame to the body fixed frame
-   */
-  void ConvertInertialToBody(const double* input_i, double* output_b, const math::Quaternion quaternion_i2b);
-
-  /**
-   * @fn ConvertVelocityInertialToBody
-   * @brief Convert velocity vector in the inertial frame to the body fixed frame
-   * @param [in] position_i: Position vector in the inertial frame
-   * @param [in] velocity_i: Velocity vector in the inertial frame
-   * @param [out] velocity_b: Output Velocity vector in the body fixed frame
-   * @param [in] quaternion_i2b: Spacecraft attitude quaternion from the inertial frame to the body fixed frame
-   * @param [in] angular_velocity_b: Spacecraft angular velocity with respect to the inertial frame [rad/s]
-   */
-  void ConvertVelocityInertialToBody(const double* position_i, const double* velocity_i, double* velocity_b, const math::Quaternion quaternion_i2b,
-                                     const math::Vector<3> angular_velocity_b);
+  std::vector<math::Vector<3>> celestial_body_position_from_spacecraft_i_m_;    //!< Celestial body position in the inertial frame [m]
+  std::vector<math::Vector<3>> celestial_body_velocity_from_spacecraft_i_m_s_;  //!< Celestial body velocity in the inertial frame [m/s]
+  math::Quaternion quaternion_i2b_;                                             //!< Spacecraft attitude quaternion at the last update
+  math::Vector<3> spacecraft_angular_velocity_rad_s_;                           //!< Spacecraft angular velocity at the last update [rad/s]
+  // Body fixed frame information memoized until the next update
+  mutable std::vector<math::Vector<3>> celestial_body_position_from_spacecraft_b_m_;    //!< Celestial body position in the body frame [m]
+  mutable std::vector<math::Vector<3>> celestial_body_velocity_from_spacecraft_b_m_s_;  //!< Celestial body velocity in the body frame [m/s]
+  mutable std::vector<bool> is_position_b_calculated_;                                  //!< Body frame position is up to date
+  mutable std::vector<bool> is_velocity_b_calculated_;                                  //!< Body frame velocity is up to date
 };
 
 }  // namespace s2e::environment
@@ -18,22 +18,31 @@ namespace s2e::environment {
 SolarRadiationPressureEnvironment::SolarRadiationPressureEnvironment(LocalCelestialInformation* local_celestial_information)
     : local_celestial_information_(local_celestial_information) {
   solar_radiation_pressure_N_m2_ = solar_constant_W_m2_ / environment::speed_of_light_m_s;
-  shadow_source_name_list_.push_back(local_celestial_information_->GetGlobalInformation().GetCenterBodyName());
-  sun_radius_m_ = local_celestial_information_->GetGlobalInformation().GetMeanRadiusFromName_m("SUN");
+  const CelestialInformation& celestial_information = local_celestial_information_->GetGlobalInformation();
+  sun_id_ = celestial_information.GetSunId();
+  sun_radius_m_ = celestial_information.GetMeanRadius_m(sun_id_);
+  AddShadowSource(celestial_information.GetCenterBodyName());
 }
 
 void SolarRadiationPressureEnvironment::UpdateAllStates() {
   if (!IsCalcEnabled) return;
 
   UpdatePressure();
-  shadow_coefficient_ = 1.0;  // Initialize for multiple shadow source
-  for (auto shadow_source_name : shadow_source_name_list_) {
-    CalcShadowCoefficient(shadow_source_name);
-  }
+  CalcShadowCoefficient();
+}
+
+void SolarRadiationPressureEnvironment::AddShadowSource(const std::string shadow_source_name) {
+  const CelestialInformation& celestial_information = local_celestial_information_->GetGlobalInformation();
+  const unsigned int shadow_source_id = celestial_information.CalcBodyIdFromName(shadow_source_name.c_str());
+  // The sun does not make shadow
+  if (shadow_source_id == sun_id_) return;
+  shadow_source_id_list_.push_back(shadow_source_id);
+  shadow_source_positions_m_.push_back(math::Vector<3>(0.0));
+  shadow_source_radii_m_.push_back(celestial_information.GetMeanRadius_m(shadow_source_id));
 }
 
 void SolarRadiationPressureEnvironment::UpdatePressure() {
-  const math::Vector<3> r_sc2sun_eci = local_celestial_information_->GetPositionFromSpacecraft_i_m("SUN");
+  const math::Vector<3> r_sc2sun_eci = local_celestial_information_->GetPositionFromSpacecraft_i_m(sun_id_);
   const double distance_sat_to_sun = r_sc2sun_eci.CalcNorm();
   solar_radiation_pressure_N_m2_ =
       solar_constant_W_m2_ / environment::speed_of_light_m_s / pow(distance_sat_to_sun / environment::astronomical_unit_m, 2.0);
@@ -57,51 +66,25 @@ std::string SolarRadiationPressureEnvironment::GetLogValue() const {
   return str_tmp;
 }
 
-void SolarRadiationPressureEnvironment::CalcShadowCoefficient(std::string shadow_source_name) {
-  if (shadow_source_name == "SUN") {
-    shadow_coefficient_ *= 1.0;
-    return;
+void SolarRadiationPressureEnvironment::CalcShadowCoefficient() {
+  const math::Vector<3> r_sc2sun_eci = local_celestial_information_->GetPositionFromSpacecraft_i_m(sun_id_);
+  for (size_t i = 0; i < shadow_source_id_list_.size(); i++) {
+    shadow_source_positions_m_[i] = local_celestial_information_->GetPositionFromSpacecraft_i_m(shadow_source_id_list_[i]);
   }
+  shadow_coefficient_ = orbit::CalcShadowFunction(r_sc2sun_eci, sun_radius_m_, shadow_source_positions_m_, shadow_source_radii_m_);
+}
 
-  const math::Vector<3> r_sc2sun_eci = local_celestial_information_->GetPositionFromSpacecraft_i_m("SUN");
-  const math::Vector<3> r_sc2source_eci = local_celestial_information_->GetPositionFromSpacecraft_i_m(shadow_source_name.c_str());
-
-  const double shadow_source_radius_m = local_celestial_information_->GetGlobalInformation().GetMeanRadiusFromName_m(shadow_source_name.c_str());
-
-  const double distance_sat_to_sun = r_sc2sun_eci.CalcNorm();
-  const double sd_sun = asin(sun_radius_m_ / distance_sat_to_sun);                     // Apparent radius of the sun
-  const double sd_source = asin(shadow_source_radius_m / r_sc2source_eci.CalcNorm());  // Apparent radius of the shadow source
-
-  // Angle of deviation from shadow source center to sun center
-  math::Vector<3> r_source2sun_eci = r_sc2sun_eci - r_sc2source_eci;
-  const double delta = acos(InnerProduct(r_sc2source_eci, r_sc2sun_eci - r_sc2source_eci) / r_sc2source_eci.CalcNorm() / r_source2sun_eci.CalcNorm());
-  // The angle between the center of the sun and the common chord
-  const double x = (delta * delta + sd_sun * sd_sun - sd_source * sd_source) / (2.0 * delta);
-  // The length of the common chord of the apparent solar disk and apparent telestial disk
-  const double y = sqrt(std::max(sd_sun * sd_sun - x * x, 0.0));
-
-  const double a = sd_sun;
-  const double b = sd_source;
-  const double c = delta;
-
-  if (c < fabs(a - b) && a <= b)  // The occultation is total (spacecraft is in umbra)
-  {
-    shadow_coefficient_ *= 0.0;
-  } else if (c < fabs(a - b) && a > b)  // The occultation is partial but maximum
-  {
-    shadow_coefficient_ = 1.0 - (b * b) / (a * a);
-  } else if (fabs(a - b) <= c && c <= (a + b))  // spacecraft is in penumbra
-  {
-    double A = a * a * acos(x / a) + b * b * acos((c - x) / b) - c * y;  // The area of the occulted segment of the apparent solar disk
-    shadow_coefficient_ *= 1.0 - A / (math::pi * a * a);
-  } else {  // no occultation takes place
-    if (c < (a + b)) {
-      std::cout << "[Error SRP Environment]: The calculation error was occurred at the shadow calculation." << std::endl;
-      std::cout << "                         The orbit setting may have something wrong." << std::endl;
-      std::exit(1);
-    }
-    shadow_coefficient_ *= 1.0;
+double SolarRadiationPressureEnvironment::CalcTimeToShadowEvent_s(orbit::ShadowEvent& shadow_event) const {
+  const math::Vector<3> r_sc2sun_eci = local_celestial_information_->GetPositionFromSpacecraft_i_m(sun_id_);
+  const math::Vector<3> v_sc2sun_eci = local_celestial_information_->GetVelocityFromSpacecraft_i_m_s(sun_id_);
+  std::vector<math::Vector<3>> r_sc2source_eci;
+  std::vector<math::Vector<3>> v_sc2source_eci;
+  for (const unsigned int id : shadow_source_id_list_) {
+    r_sc2source_eci.push_back(local_celestial_information_->GetPositionFromSpacecraft_i_m(id));
+    v_sc2source_eci.push_back(local_celestial_information_->GetVelocityFromSpacecraft_i_m_s(id));
   }
+  return orbit::CalcTimeToShadowEvent_s(r_sc2sun_eci, v_sc2sun_eci, sun_radius_m_, r_sc2source_eci, v_sc2source_eci, shadow_source_radii_m_,
+                                        shadow_event);
 }
 
 SolarRadiationPressureEnvironment InitSolarRadiationPressureEnvironment(std::string initialize_file_path,
@@ -116,7 +99,7 @@ SolarRadiationPressureEnvironment InitSolarRadiationPressureEnvironment(std::str
   size_t number_of_third_shadow_source = conf.ReadInt(section, "number_of_third_shadow_source");
   std::vector<std::string> list = conf.ReadVectorString(section, "third_shadow_source_name", number_of_third_shadow_source);
   for (size_t i = 0; i < number_of_third_shadow_source; i++) {
-    srp_env.AddShadowSource(list[0]);
+    srp_env.AddShadowSource(list[i]);
   }
 
   return srp_env;
@@ -8,6 +8,7 @@
 
 #include "environment/global/physical_constants.hpp"
 #include "environment/local/local_celestial_information.hpp"
+#include "math_physics/orbit/shadow_function.hpp"
 
 namespace s2e::environment {
 
@@ -40,13 +41,21 @@ class SolarRadiationPressureEnvironment : public logger::ILoggable {
 
   /**
    * @fn AddShadowSource
-   * @brief Update pressure and shadow coefficients
+   * @brief Add a shadow source. The sun is ignored.
    * @param [in] shadow_source_name: Shadow source name
    */
-  void AddShadowSource(const std::string shadow_source_name) {
-    // TODO: Add assertion
-    shadow_source_name_list_.push_back(shadow_source_name);
-  }
+  void AddShadowSource(const std::string shadow_source_name);
+
+  /**
+   * @fn CalcTimeToShadowEvent_s
+   * @brief Predict the next transition of the shadow condition with the current relative positions and velocities
+   * @note The prediction assumes linear change of the angular margins to the shadow boundaries and holds only near the boundary (see
+   *       orbit::CalcTimeToShadowEvent_s). Users can update shadow dependent calculations at a coarse rate and refine them when the predicted
+   *       time becomes short.
+   * @param [out] shadow_event: Predicted transition
+   * @return Time to the transition [s]. Infinity when no transition is predicted.
+   */
+  double CalcTimeToShadowEvent_s(orbit::ShadowEvent& shadow_event) const;
 
   // Getter
   /**
@@ -93,11 +102,14 @@ class SolarRadiationPressureEnvironment : public logger::ILoggable {
   virtual std::string GetLogValue() const;
 
  private:
-  double solar_radiation_pressure_N_m2_;              //!< Solar radiation pressure [N/m^2]
-  double solar_constant_W_m2_ = 1366.0;               //!< Solar constant [W/m^2] TODO: We need to change the value depends on sun activity.
-  double shadow_coefficient_ = 1.0;                   //!< Shadow function
-  double sun_radius_m_;                               //!< Sun radius [m]
-  std::vector<std::string> shadow_source_name_list_;  //!< Shadow source name list
+  double solar_radiation_pressure_N_m2_;                    //!< Solar radiation pressure [N/m^2]
+  double solar_constant_W_m2_ = 1366.0;                     //!< Solar constant [W/m^2] TODO: We need to change the value depends on sun activity.
+  double shadow_coefficient_ = 1.0;                         //!< Shadow function
+  double sun_radius_m_;                                     //!< Sun radius [m]
+  unsigned int sun_id_;                                     //!< ID of CelestialInformation list for the sun
+  std::vector<unsigned int> shadow_source_id_list_;         //!< ID list of CelestialInformation list for the shadow sources
+  std::vector<math::Vector<3>> shadow_source_positions_m_;  //!< Buffer of the shadow source positions from the spacecraft [m]
+  std::vector<double> shadow_source_radii_m_;               //!< Mean radii of the shadow sources [m]
 
   LocalCelestialInformation* local_celestial_information_;  //!< Local celestial information
 
@@ -109,10 +121,9 @@ class SolarRadiationPressureEnvironment : public logger::ILoggable {
 
   /**
    * @fn CalcShadowCoefficient
-   * @brief Calculate shadow coefficient
-   * @param [in] shadow_source_name_: Shadow source name
+   * @brief Calculate shadow coefficient for all shadow sources
    */
-  void CalcShadowCoefficient(std::string shadow_source_name);
+  void CalcShadowCoefficient();
 };
 
 /**
@@ -0,0 +1,133 @@
+/**
+ * @file test_geomagnetic_field.cpp
+ * @brief Test codes for GeomagneticField class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include "geomagnetic_field.hpp"
+
+using namespace s2e;
+
+static const std::string kIgrfFileName = CORE_DIR_FROM_EXE + std::string("/settings/environment/magnetic_field/igrf13.coef");
+static const double kSecondsPerYear = 365.25 * 86400.0;
+static const double kStartDecimalYear = 2022.0;
+
+/**
+ * @brief Calculate the input of the field at a time on an inclined circular orbit at 500 km altitude
+ */
+static void CalcOrbitInput(const double elapsed_time_s, double& decimal_year, double& gmst_rad, geodesy::GeodeticPosition& position) {
+  const double mean_motion_rad_s = 2.0 * M_PI / 5677.0;
+  const double inclination_rad = 1.7;
+  const double argument_of_latitude_rad = mean_motion_rad_s * elapsed_time_s;
+  const double x = cos(argument_of_latitude_rad);
+  const double y = sin(argument_of_latitude_rad) * cos(inclination_rad);
+  const double z = sin(argument_of_latitude_rad) * sin(inclination_rad);
+
+  decimal_year = kStartDecimalYear + elapsed_time_s / kSecondsPerYear;
+  gmst_rad = 7.2921159e-5 * elapsed_time_s;
+  position = geodesy::GeodeticPosition(asin(z), atan2(y, x) - gmst_rad, 500e3);
+}
+
+/**
+ * @brief Calculate the magnetic field without noise
+ */
+static math::Vector<3> CalcField(environment::GeomagneticField& geomagnetic_field, const double elapsed_time_s) {
+  double decimal_year, gmst_rad;
+  geodesy::GeodeticPosition position;
+  CalcOrbitInput(elapsed_time_s, decimal_year, gmst_rad, position);
+  geomagnetic_field.CalcMagneticField(decimal_year, gmst_rad, position, math::Quaternion(0.0, 0.0, 0.0, 1.0));
+  return geomagnetic_field.GetGeomagneticField_i_nT();
+}
+
+/**
+ * @brief Calculate the magnetic field with the IGRF model directly
+ */
+static math::Vector<3> CalcIgrfField(const geomagnetic::Igrf& igrf, const double elapsed_time_s) {
+  double decimal_year, gmst_rad;
+  geodesy::GeodeticPosition position;
+  CalcOrbitInput(elapsed_time_s, decimal_year, gmst_rad, position);
+  return igrf.CalcMagneticField_i_nT(igrf.CalcCoefficients(decimal_year), position, gmst_rad);
+}
+
+/**
+ * @brief Test that the disabled estimation gives the IGRF field at every call
+ */
+TEST(GeomagneticField, DisabledEstimation) {
+  environment::GeomagneticField geomagnetic_field(kIgrfFileName, 0.0, 0.0, 0.0);
+  const geomagnetic::Igrf igrf(kIgrfFileName);
+
+  for (double elapsed_time_s = 0.0; elapsed_time_s < 600.0; elapsed_time_s += 0.7) {
+    const math::Vector<3> field_i_nT = CalcField(geomagnetic_field, elapsed_time_s);
+    const math::Vector<3> igrf_field_i_nT = CalcIgrfField(igrf, elapsed_time_s);
+    for (size_t i = 0; i < 3; i++) EXPECT_DOUBLE_EQ(igrf_field_i_nT[i], field_i_nT[i]);
+  }
+}
+
+/**
+ * @brief Test the growth and the shrink of the IGRF evaluation interval, and the error of the estimated field along the orbit
+ */
+TEST(GeomagneticField, AdaptiveEstimation) {
+  const double max_interval_s = 60.0;
+  const double tolerance_nT = 1.0;
+  environment::GeomagneticField geomagnetic_field(kIgrfFileName, 0.0, 0.0, 0.0, 0.0, max_interval_s, tolerance_nT);
+  const geomagnetic::Igrf igrf(kIgrfFileName);
+
+  double previous_interval_s = geomagnetic_field.GetFieldUpdateInterval_s();
+  double max_used_interval_s = 0.0;
+  double max_error_nT = 0.0;
+  bool is_grown = false;
+  bool is_shrunk = false;
+  for (double elapsed_time_s = 0.0; elapsed_time_s < 2.0 * 5677.0; elapsed_time_s += 0.5) {
+    const math::Vector<3> field_i_nT = CalcField(geomagnetic_field, elapsed_time_s);
+    max_error_nT = std::max(max_error_nT, (field_i_nT - CalcIgrfField(igrf, elapsed_time_s)).CalcNorm());
+
+    const double interval_s = geomagnetic_field.GetFieldUpdateInterval_s();
+    if (interval_s > previous_interval_s) is_grown = true;
+    if (interval_s < previous_interval_s) is_shrunk = true;
+    max_used_interval_s = std::max(max_used_interval_s, interval_s);
+    previous_interval_s = interval_s;
+  }
+
+  EXPECT_TRUE(is_grown);
+  EXPECT_TRUE(is_shrunk);
+  EXPECT_GT(max_used_interval_s, 1.0);
+  EXPECT_LE(max_used_interval_s, max_interval_s);
+  // The interval is doubled only when the error is below a quarter of the tolerance, and the error grows with the square of the interval
+  EXPECT_LT(max_error_nT, tolerance_nT);
+}
+
+/**
+ * @brief Test that the interval grows up to the maximum interval in a slowly varying field
+ */
+TEST(GeomagneticField, MaxInterval) {
+  const double max_interval_s = 4.0;
+  environment::GeomagneticField geomagnetic_field(kIgrfFileName, 0.0, 0.0, 0.0, 0.0, max_interval_s, 100.0);
+
+  for (double elapsed_time_s = 0.0; elapsed_time_s < 600.0; elapsed_time_s += 0.5) {
+    CalcField(geomagnetic_field, elapsed_time_s);
+    EXPECT_LE(geomagnetic_field.GetFieldUpdateInterval_s(), max_interval_s);
+  }
+  EXPECT_DOUBLE_EQ(max_interval_s, geomagnetic_field.GetFieldUpdateInterval_s());
+}
+
+/**
+ * @brief Test that the estimation restarts with the IGRF field when the time goes backward
+ */
+TEST(GeomagneticField, RestartWithBackwardTime) {
+  environment::GeomagneticField geomagnetic_field(kIgrfFileName, 0.0, 0.0, 0.0, 0.0, 60.0, 1.0);
+  const geomagnetic::Igrf igrf(kIgrfFileName);
+
+  for (double elapsed_time_s = 0.0; elapsed_time_s < 600.0; elapsed_time_s += 0.5) CalcField(geomagnetic_field, elapsed_time_s);
+  EXPECT_GT(geomagnetic_field.GetFieldUpdateInterval_s(), 1.0);
+
+  // The IGRF field is used at the backward time and the next time within the minimum interval since the samples are discarded
+  for (const double elapsed_time_s : {100.0, 100.0005}) {
+    const math::Vector<3> field_i_nT = CalcField(geomagnetic_field, elapsed_time_s);
+    const math::Vector<3> igrf_field_i_nT = CalcIgrfField(igrf, elapsed_time_s);
+    for (size_t i = 0; i < 3; i++) EXPECT_DOUBLE_EQ(igrf_field_i_nT[i], field_i_nT[i]);
+    EXPECT_DOUBLE_EQ(1e-3, geomagnetic_field.GetFieldUpdateInterval_s());
+  }
+}
@@ -0,0 +1,87 @@
+/**
+ * @file test_local_celestial_information.cpp
+ * @brief Test codes for LocalCelestialInformation class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "local_celestial_information.hpp"
+
+using namespace s2e;
+
+/**
+ * @brief Generate celestial information with the earth and the sun without SPICE
+ */
+static environment::CelestialInformation GenerateCelestialInformation() {
+  auto ephemeris = std::make_shared<orbit::ChebyshevEphemeris>(0.0, 1.0e6, 1, 1, "J2000", "NONE", "EARTH");
+  const char* names[] = {"EARTH", "SUN"};
+  const int ids[] = {399, 10};
+  for (size_t body_index = 0; body_index < 2; body_index++) {
+    std::vector<std::vector<std::vector<double>>> orbits_km(1, std::vector<std::vector<double>>(2, std::vector<double>(6, 0.0)));
+    for (auto& orbit_km : orbits_km[0]) orbit_km[0] = body_index == 0 ? 0.0 : 1.496e8;
+    orbit::EphemerisBodyInformation body;
+    body.id = ids[body_index];
+    body.name = names[body_index];
+    body.gravity_constant_m3_s2 = body_index == 0 ? 3.986004418e14 : 1.32712e20;
+    for (size_t i = 0; i < 3; i++) body.radii_m[i] = body_index == 0 ? 6378137.0 : 696000e3;
+    EXPECT_TRUE(ephemeris->AddBody(body, orbits_km));
+  }
+  return environment::CelestialInformation(ephemeris, {"IDLE", "IDLE"});
+}
+
+/**
+ * @brief Test for the log header with the body names held by the global information
+ */
+TEST(LocalCelestialInformation, LogHeader) {
+  const environment::CelestialInformation celestial_information = GenerateCelestialInformation();
+  const environment::LocalCelestialInformation local_celestial_information(&celestial_information);
+  const std::string header = local_celestial_information.GetLogHeader();
+  EXPECT_NE(std::string::npos, header.find("earth_position_from_spacecraft"));
+  EXPECT_NE(std::string::npos, header.find("sun_velocity_from_spacecraft"));
+}
+
+/**
+ * @brief Test for the body frame information calculated on request and invalidated at each update
+ */
+TEST(LocalCelestialInformation, BodyFrameInformation) {
+  environment::CelestialInformation celestial_information = GenerateCelestialInformation();
+  celestial_information.UpdateAllObjectsInformation(0.0, 2451545.0);
+  environment::LocalCelestialInformation local_celestial_information(&celestial_information);
+  const unsigned int earth_id = celestial_information.GetEarthId();
+  const unsigned int sun_id = celestial_information.GetSunId();
+
+  math::Vector<3> spacecraft_position_i_m(0.0);
+  spacecraft_position_i_m[0] = 7.0e6;
+  math::Vector<3> spacecraft_velocity_i_m_s(0.0);
+  spacecraft_velocity_i_m_s[1] = 7.5e3;
+  math::Vector<3> angular_velocity_rad_s(0.0);
+  math::Vector<3> axis(0.0);
+  axis[2] = 1.0;
+  const math::Quaternion attitudes[] = {math::Quaternion(0.0, 0.0, 0.0, 1.0), math::Quaternion(axis, 0.5), math::Quaternion(axis, -1.2)};
+
+  for (size_t update = 0; update < 3; update++) {
+    angular_velocity_rad_s[2] = 0.01 * (double)update;
+    local_celestial_information.UpdateAllObjectsInformation(spacecraft_position_i_m, spacecraft_velocity_i_m_s, attitudes[update],
+                                                            angular_velocity_rad_s);
+    // The earth is not requested after the first update, so its body frame information stays invalidated until the last update
+    for (const unsigned int id : {sun_id, earth_id}) {
+      if (id == earth_id && update == 1) continue;
+      const math::Vector<3> position_i_m = local_celestial_information.GetPositionFromSpacecraft_i_m(id);
+      const math::Vector<3> velocity_i_m_s = local_celestial_information.GetVelocityFromSpacecraft_i_m_s(id);
+      const math::Vector<3> expected_position_b_m = attitudes[update].FrameConversion(position_i_m);
+      const math::Vector<3> expected_velocity_b_m_s =
+          attitudes[update].FrameConversion(velocity_i_m_s - OuterProduct(angular_velocity_rad_s, position_i_m));
+      // The second request returns the memoized value
+      for (size_t request = 0; request < 2; request++) {
+        const math::Vector<3> position_b_m = local_celestial_information.GetPositionFromSpacecraft_b_m(id);
+        const math::Vector<3> velocity_b_m_s = local_celestial_information.GetVelocityFromSpacecraft_b_m_s(id);
+        for (size_t i = 0; i < 3; i++) {
+          EXPECT_DOUBLE_EQ(expected_position_b_m[i], position_b_m[i]);
+          EXPECT_DOUBLE_EQ(expected_velocity_b_m_s[i], velocity_b_m_s[i]);
+        }
+      }
+    }
+  }
+  EXPECT_DOUBLE_EQ(-7.0e6, local_celestial_information.GetCenterBodyPositionFromSpacecraft_i_m()[0]);
+}
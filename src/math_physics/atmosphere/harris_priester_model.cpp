@@ -4,6 +4,7 @@
  */
 #include "harris_priester_model.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <math_physics/math/constants.hpp>
 #include <utilities/macros.hpp>
@@ -13,30 +14,48 @@
 namespace s2e::atmosphere {
 
 /**
- * @fn CalcScaleHeight_km
- * @brief Calculate scale height
- * @param [in] density_itr: Iterator for density map table
- * @return Scale height [km]
+ * @struct HarrisPriesterBands
+ * @brief Altitude bands of the Harris-Priester table with precomputed exponential interpolation slopes
  */
-double CalcScaleHeight_km(const std::map<double, double>::const_iterator density_itr);
+struct HarrisPriesterBands {
+  std::vector<double> altitude_km;                    //!< Lower altitude of each band [km]
+  std::vector<double> min_density_g_km3;              //!< Antapex density at the lower altitude [g/km3]
+  std::vector<double> max_density_g_km3;              //!< Apex density at the lower altitude [g/km3]
+  std::vector<double> min_inverse_scale_height_1_km;  //!< Inverse of the antapex scale height [1/km]
+  std::vector<double> max_inverse_scale_height_1_km;  //!< Inverse of the apex scale height [1/km]
+};
+
 /**
- * @fn CalcApexDensity_g_km3
- * @brief Calculate Apex or Antapex density
- * @param [in] density_itr: Iterator for density map table
- * @param [in] altitude_km: Altitude [km]
- * @return Apex or Antapex density
+ * @fn GetHarrisPriesterBands
+ * @brief Return the altitude bands which are created at the first call
  */
-double CalcApexDensity_g_km3(const std::map<double, double>::const_iterator density_itr, const double altitude_km);
-
-double CalcAirDensityWithHarrisPriester_kg_m3(const geodesy::GeodeticPosition geodetic_position, const math::Vector<3> sun_direction_eci,
-                                              const double f10_7, const double exponent_parameter) {
-  // Altitude
-  double altitude_km = geodetic_position.GetAltitude_m() / 1000.0;
-
-  // Position
-  math::Vector<3> position_ecef_m = geodetic_position.CalcEcefPosition();
+static const HarrisPriesterBands& GetHarrisPriesterBands() {
+  static const HarrisPriesterBands bands = [] {
+    HarrisPriesterBands table;
+    auto min_itr = harris_priester_min_density_table.begin();
+    auto max_itr = harris_priester_max_density_table.begin();
+    for (; std::next(min_itr) != harris_priester_min_density_table.end(); ++min_itr, ++max_itr) {
+      const double band_width_km = std::next(min_itr)->first - min_itr->first;
+      table.altitude_km.push_back(min_itr->first);
+      table.min_density_g_km3.push_back(min_itr->second);
+      table.max_density_g_km3.push_back(max_itr->second);
+      table.min_inverse_scale_height_1_km.push_back(log(min_itr->second / std::next(min_itr)->second) / band_width_km);
+      table.max_inverse_scale_height_1_km.push_back(log(max_itr->second / std::next(max_itr)->second) / band_width_km);
+    }
+    // Upper limit of the table
+    table.altitude_km.push_back(min_itr->first);
+    return table;
+  }();
+  return bands;
+}
 
-  // Phi: angle between the satellite position and apex of the diurnal bulge
+/**
+ * @fn CalcApexDirection
+ * @brief Calculate apex direction of the diurnal bulge
+ * @param [in] sun_direction_eci: Sun direction unit vector in ECI frame
+ * @return Apex direction
+ */
+static math::Vector<3> CalcApexDirection(const math::Vector<3>& sun_direction_eci) {
   double sun_ra_rad;   //!< Right ascension of the sun phi
   double sun_dec_rad;  //!< Declination of the sun theta
   sun_ra_rad = atan2(sun_direction_eci[1], sun_direction_eci[0]);
@@ -47,45 +66,66 @@ double CalcAirDensityWithHarrisPriester_kg_m3(const geodesy::GeodeticPosition ge
   apex_direction[0] = cos(sun_dec_rad) * cos(apex_ra_rad);
   apex_direction[1] = cos(sun_dec_rad) * sin(apex_ra_rad);
   apex_direction[2] = sin(sun_dec_rad);
+  return apex_direction;
+}
 
-  double beta_rad = math::InnerProduct(position_ecef_m.CalcNormalizedVector(), apex_direction);
-  double cos_phi = pow(0.5 + beta_rad / 2.0, exponent_parameter / 2.0);
+/**
+ * @fn CalcAirDensityWithBands_kg_m3
+ * @brief Calculate atmospheric density with the precomputed altitude bands
+ * @param [in] geodetic_position: Spacecraft geodetic position
+ * @param [in] apex_direction: Apex direction of the diurnal bulge
+ * @param [in] exponent_parameter: n in the equation
+ * @return Atmospheric density [kg/m^3]
+ */
+static double CalcAirDensityWithBands_kg_m3(const geodesy::GeodeticPosition& geodetic_position, const math::Vector<3>& apex_direction,
+                                            const double exponent_parameter) {
+  const HarrisPriesterBands& bands = GetHarrisPriesterBands();
+  const double altitude_km = geodetic_position.GetAltitude_m() / 1000.0;
 
   // Find density coefficients from altitude
-  UNUSED(f10_7);  // TODO: Use F10.7 value to search coefficients
-  auto min_density_itr = harris_priester_min_density_table.upper_bound(altitude_km);
-  auto max_density_itr = harris_priester_max_density_table.upper_bound(altitude_km);
-  if (min_density_itr == harris_priester_min_density_table.begin()) return min_density_itr->second;
-  if (min_density_itr == harris_priester_min_density_table.end()) return (min_density_itr->second + max_density_itr->second) / 2.0;
-  min_density_itr = prev(min_density_itr);
-  max_density_itr = prev(max_density_itr);
+  if (altitude_km < bands.altitude_km.front()) return bands.min_density_g_km3.front() * 1e-12;
+  // Above the table, the density is extrapolated exponentially with the scale height of the last band
+  const size_t last_band = bands.min_density_g_km3.size() - 1;
+  const size_t upper_band = std::upper_bound(bands.altitude_km.begin(), bands.altitude_km.end(), altitude_km) - bands.altitude_km.begin() - 1;
+  const size_t band = std::min(upper_band, last_band);
+
+  // Phi: angle between the satellite position and apex of the diurnal bulge
+  math::Vector<3> position_ecef_m = geodetic_position.CalcEcefPosition();
+  double beta_rad = math::InnerProduct(position_ecef_m.CalcNormalizedVector(), apex_direction);
+  double cos_phi = pow(0.5 + beta_rad / 2.0, exponent_parameter / 2.0);
 
   // Calculate density
-  double antapex_density_g_km3 = CalcApexDensity_g_km3(min_density_itr, altitude_km);
-  double apex_density_g_km3 = CalcApexDensity_g_km3(max_density_itr, altitude_km);
+  const double height_from_band_km = altitude_km - bands.altitude_km[band];
+  double antapex_density_g_km3 = bands.min_density_g_km3[band] * exp(-height_from_band_km * bands.min_inverse_scale_height_1_km[band]);
+  double apex_density_g_km3 = bands.max_density_g_km3[band] * exp(-height_from_band_km * bands.max_inverse_scale_height_1_km[band]);
 
   double density_g_km3 = antapex_density_g_km3 + (apex_density_g_km3 - antapex_density_g_km3) * cos_phi;
 
   return density_g_km3 * 1e-12;  // Unit conversion g/km3 -> kg/m^3
 }
 
-double CalcScaleHeight_km(const std::map<double, double>::const_iterator density_itr) {
-  const double height_1_km = density_itr->first;
-  const double density_1_g_km3 = density_itr->second;
-  const double height_2_km = next(density_itr)->first;
-  const double density_2_g_km3 = next(density_itr)->second;
+double CalcAirDensityWithHarrisPriester_kg_m3(const geodesy::GeodeticPosition geodetic_position, const math::Vector<3> sun_direction_eci,
+                                              const double f10_7, const double exponent_parameter) {
+  UNUSED(f10_7);  // TODO: Use F10.7 value to search coefficients
+  return CalcAirDensityWithBands_kg_m3(geodetic_position, CalcApexDirection(sun_direction_eci), exponent_parameter);
+}
 
-  double scale_height_km = (height_1_km - height_2_km) / log(density_2_g_km3 / density_1_g_km3);
-  return scale_height_km;
+HarrisPriesterModel::HarrisPriesterModel(const double exponent_parameter) : exponent_parameter_(exponent_parameter), apex_direction_(0.0) {
+  apex_direction_[0] = 1.0;
 }
 
-double CalcApexDensity_g_km3(const std::map<double, double>::const_iterator density_itr, const double altitude_km) {
-  const double scale_height_km = CalcScaleHeight_km(density_itr);
-  const double height_km = density_itr->first;
-  const double density_g_km3 = density_itr->second;
+void HarrisPriesterModel::SetSunDirection(const math::Vector<3>& sun_direction_eci) { apex_direction_ = CalcApexDirection(sun_direction_eci); }
+
+double HarrisPriesterModel::CalcAirDensity_kg_m3(const geodesy::GeodeticPosition& geodetic_position) const {
+  return CalcAirDensityWithBands_kg_m3(geodetic_position, apex_direction_, exponent_parameter_);
+}
 
-  double apex_density_g_km3 = density_g_km3 * exp((height_km - altitude_km) / scale_height_km);
-  return apex_density_g_km3;
+std::vector<double> HarrisPriesterModel::CalcAirDensity_kg_m3(const std::vector<geodesy::GeodeticPosition>& geodetic_positions) const {
+  std::vector<double> air_densities_kg_m3(geodetic_positions.size());
+  for (size_t i = 0; i < geodetic_positions.size(); i++) {
+    air_densities_kg_m3[i] = CalcAirDensityWithBands_kg_m3(geodetic_positions[i], apex_direction_, exponent_parameter_);
+  }
+  return air_densities_kg_m3;
 }
 
 }  // namespace s2e::atmosphere
@@ -8,9 +8,52 @@
 
 #include <math_physics/geodesy/geodetic_position.hpp>
 #include <math_physics/math/vector.hpp>
+#include <vector>
 
 namespace s2e::atmosphere {
 
+/**
+ * @class HarrisPriesterModel
+ * @brief Harris-Priester model with precomputed altitude bands and a cached apex direction
+ * @note The apex direction is updated once per step by SetSunDirection, and then the density can be evaluated for many positions.
+ *       Above the top altitude of the table (1000 km), the density is extrapolated with the scale height of the last band.
+ */
+class HarrisPriesterModel {
+ public:
+  /**
+   * @fn HarrisPriesterModel
+   * @brief Constructor
+   * @param [in] exponent_parameter: n in the equation. n=2 for low inclination orbit and n=6 for polar orbit.
+   */
+  explicit HarrisPriesterModel(const double exponent_parameter = 4);
+
+  /**
+   * @fn SetSunDirection
+   * @brief Update the apex direction of the diurnal bulge
+   * @param [in] sun_direction_eci: Sun direction unit vector in ECI frame
+   */
+  void SetSunDirection(const math::Vector<3>& sun_direction_eci);
+
+  /**
+   * @fn CalcAirDensity_kg_m3
+   * @brief Calculate atmospheric density
+   * @param [in] geodetic_position: Spacecraft geodetic position
+   * @return Atmospheric density [kg/m^3]
+   */
+  double CalcAirDensity_kg_m3(const geodesy::GeodeticPosition& geodetic_position) const;
+  /**
+   * @fn CalcAirDensity_kg_m3
+   * @brief Calculate atmospheric density for multiple positions with the same apex direction
+   * @param [in] geodetic_positions: Spacecraft geodetic positions
+   * @return Atmospheric densities [kg/m^3]
+   */
+  std::vector<double> CalcAirDensity_kg_m3(const std::vector<geodesy::GeodeticPosition>& geodetic_positions) const;
+
+ private:
+  double exponent_parameter_;       //!< n in the equation
+  math::Vector<3> apex_direction_;  //!< Apex direction of the diurnal bulge
+};
+
 /**
  * @fn CalcAirDensityWithHarrisPriester
  * @brief Calculate atmospheric density with Harris-Priester method
@@ -0,0 +1,89 @@
+/**
+ * @file nrlmsise00_density_cache.cpp
+ * @brief Cache of the NRLMSISE-00 atmospheric density on a sparse grid around the current position
+ */
+
+#include "nrlmsise00_density_cache.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <math_physics/math/constants.hpp>
+
+namespace s2e::atmosphere {
+
+Nrlmsise00DensityCache::Nrlmsise00DensityCache(const double latitude_step_rad, const double longitude_step_rad, const double altitude_step_m,
+                                               const double time_validity_s)
+    : latitude_step_rad_(latitude_step_rad),
+      longitude_step_rad_(longitude_step_rad),
+      altitude_step_m_(altitude_step_m),
+      time_validity_year_(time_validity_s / (365.25 * 86400.0)) {
+  is_enabled_ = latitude_step_rad > 0.0 && longitude_step_rad > 0.0 && altitude_step_m > 0.0 && time_validity_s > 0.0;
+}
+
+double Nrlmsise00DensityCache::CalcAirDensity_kg_m3(const double decimal_year, const double latitude_rad, const double longitude_rad,
+                                                    const double altitude_m, const SpaceWeatherParameters& space_weather) {
+  if (!is_enabled_) return CalcNRLMSISE00(decimal_year, latitude_rad, longitude_rad, altitude_m, space_weather);
+
+  const double position[3] = {latitude_rad, longitude_rad, altitude_m};
+  const double step[3] = {latitude_step_rad_, longitude_step_rad_, altitude_step_m_};
+  long cell_index[3];
+  for (size_t i = 0; i < 3; i++) {
+    cell_index[i] = (long)std::floor(position[i] / step[i]);
+  }
+
+  bool is_update_needed = !is_cell_valid_ || std::fabs(decimal_year - cell_decimal_year_) > time_validity_year_;
+  is_update_needed |= space_weather.f107 != cell_space_weather_.f107 || space_weather.f107_average != cell_space_weather_.f107_average ||
+                      space_weather.ap != cell_space_weather_.ap;
+  for (size_t i = 0; i < 3; i++) {
+    is_update_needed |= cell_index[i] != cell_index_[i];
+  }
+  if (is_update_needed) UpdateCell(decimal_year, cell_index, space_weather);
+
+  // Trilinear interpolation of the logarithm of the density
+  double ratio[3];
+  for (size_t i = 0; i < 3; i++) {
+    ratio[i] = (position[i] - cell_lower_bound_[i]) / (cell_upper_bound_[i] - cell_lower_bound_[i]);
+    ratio[i] = std::min(std::max(ratio[i], 0.0), 1.0);
+  }
+  double log_density = 0.0;
+  for (size_t corner = 0; corner < 8; corner++) {
+    double weight = 1.0;
+    for (size_t i = 0; i < 3; i++) {
+      const bool is_upper = (corner >> (2 - i)) & 1;
+      weight *= is_upper ? ratio[i] : 1.0 - ratio[i];
+    }
+    log_density += weight * cell_log_density_[corner];
+  }
+
+  return std::exp(log_density);
+}
+
+void Nrlmsise00DensityCache::UpdateCell(const double decimal_year, const long cell_index[3], const SpaceWeatherParameters& space_weather) {
+  const double step[3] = {latitude_step_rad_, longitude_step_rad_, altitude_step_m_};
+  for (size_t i = 0; i < 3; i++) {
+    cell_index_[i] = cell_index[i];
+    cell_lower_bound_[i] = cell_index[i] * step[i];
+    cell_upper_bound_[i] = (cell_index[i] + 1) * step[i];
+  }
+  // Keep the latitude of the corners inside the valid range
+  cell_lower_bound_[0] = std::max(cell_lower_bound_[0], -math::pi_2);
+  cell_upper_bound_[0] = std::min(cell_upper_bound_[0], math::pi_2);
+
+  for (size_t corner = 0; corner < 8; corner++) {
+    double corner_position[3];
+    for (size_t i = 0; i < 3; i++) {
+      const bool is_upper = (corner >> (2 - i)) & 1;
+      corner_position[i] = is_upper ? cell_upper_bound_[i] : cell_lower_bound_[i];
+    }
+    const double density_kg_m3 = CalcNRLMSISE00(decimal_year, corner_position[0], corner_position[1], corner_position[2], space_weather);
+    cell_log_density_[corner] = std::log(std::max(density_kg_m3, std::numeric_limits<double>::min()));
+  }
+
+  cell_decimal_year_ = decimal_year;
+  cell_space_weather_ = space_weather;
+  is_cell_valid_ = true;
+  number_of_cell_updates_++;
+}
+
+}  // namespace s2e::atmosphere
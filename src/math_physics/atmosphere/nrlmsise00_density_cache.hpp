@@ -0,0 +1,90 @@
+/**
+ * @file nrlmsise00_density_cache.hpp
+ * @brief Cache of the NRLMSISE-00 atmospheric density on a sparse grid around the current position
+ */
+
+#ifndef S2E_LIBRARY_ATMOSPHERE_NRLMSISE00_DENSITY_CACHE_HPP_
+#define S2E_LIBRARY_ATMOSPHERE_NRLMSISE00_DENSITY_CACHE_HPP_
+
+#include "wrapper_nrlmsise00.hpp"
+
+namespace s2e::atmosphere {
+
+/**
+ * @class Nrlmsise00DensityCache
+ * @brief Cache of the NRLMSISE-00 atmospheric density
+ * @details The model is evaluated at the eight corners of the latitude-longitude-altitude grid cell which contains the target point,
+ *          and the logarithm of the density is interpolated trilinearly inside the cell. The cell is re-evaluated when the target point
+ *          leaves it, when the time validity expires, or when the space weather indices change.
+ */
+class Nrlmsise00DensityCache {
+ public:
+  /**
+   * @fn Nrlmsise00DensityCache
+   * @brief Default constructor. The cache is disabled and the model is evaluated at every call.
+   */
+  Nrlmsise00DensityCache() {}
+  /**
+   * @fn Nrlmsise00DensityCache
+   * @brief Constructor. The cache is disabled when any of the parameters is not positive.
+   * @param [in] latitude_step_rad: Latitude width of the grid cell [rad]
+   * @param [in] longitude_step_rad: Longitude width of the grid cell [rad]
+   * @param [in] altitude_step_m: Altitude width of the grid cell [m]
+   * @param [in] time_validity_s: Time validity of the evaluated grid cell [s]
+   */
+  Nrlmsise00DensityCache(const double latitude_step_rad, const double longitude_step_rad, const double altitude_step_m, const double time_validity_s);
+
+  /**
+   * @fn CalcAirDensity_kg_m3
+   * @brief Calculate atmospheric density
+   * @param [in] decimal_year: Decimal year [year]
+   * @param [in] latitude_rad: Latitude [rad]
+   * @param [in] longitude_rad: Longitude [rad]
+   * @param [in] altitude_m: Altitude [m]
+   * @param [in] space_weather: Space weather indices
+   * @return Atmospheric density [kg/m3]
+   */
+  double CalcAirDensity_kg_m3(const double decimal_year, const double latitude_rad, const double longitude_rad, const double altitude_m,
+                              const SpaceWeatherParameters& space_weather);
+
+  /**
+   * @fn IsEnabled
+   * @brief Return true when the cache is enabled
+   */
+  inline bool IsEnabled() const { return is_enabled_; }
+  /**
+   * @fn GetNumberOfCellUpdates
+   * @brief Return number of the grid cell evaluations
+   */
+  inline size_t GetNumberOfCellUpdates() const { return number_of_cell_updates_; }
+
+ private:
+  bool is_enabled_ = false;          //!< Cache enable flag
+  double latitude_step_rad_ = 0.0;   //!< Latitude width of the grid cell [rad]
+  double longitude_step_rad_ = 0.0;  //!< Longitude width of the grid cell [rad]
+  double altitude_step_m_ = 0.0;     //!< Altitude width of the grid cell [m]
+  double time_validity_year_ = 0.0;  //!< Time validity of the evaluated grid cell [year]
+
+  // Current grid cell
+  bool is_cell_valid_ = false;                 //!< Flag to show the cell has been evaluated
+  size_t number_of_cell_updates_ = 0;          //!< Number of the grid cell evaluations
+  double cell_decimal_year_ = 0.0;             //!< Decimal year used to evaluate the cell [year]
+  long cell_index_[3] = {};                    //!< Grid index of the cell (latitude, longitude, altitude)
+  SpaceWeatherParameters cell_space_weather_;  //!< Space weather indices used to evaluate the cell
+  double cell_lower_bound_[3] = {};            //!< Lower bound of the cell (latitude [rad], longitude [rad], altitude [m])
+  double cell_upper_bound_[3] = {};            //!< Upper bound of the cell (latitude [rad], longitude [rad], altitude [m])
+  double cell_log_density_[8] = {};            //!< Logarithm of the density at the corners stored as [4 * i_lat + 2 * i_lon + i_alt]
+
+  /**
+   * @fn UpdateCell
+   * @brief Evaluate the model at the corners of the cell
+   * @param [in] decimal_year: Decimal year [year]
+   * @param [in] cell_index: Grid index of the cell (latitude, longitude, altitude)
+   * @param [in] space_weather: Space weather indices
+   */
+  void UpdateCell(const double decimal_year, const long cell_index[3], const SpaceWeatherParameters& space_weather);
+};
+
+}  // namespace s2e::atmosphere
+
+#endif  // S2E_LIBRARY_ATMOSPHERE_NRLMSISE00_DENSITY_CACHE_HPP_
@@ -0,0 +1,58 @@
+/**
+ * @file test_harris_priester_model.cpp
+ * @brief Test codes for Harris-Priester model with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "harris_priester_model.hpp"
+
+using namespace s2e::atmosphere;
+
+/**
+ * @brief Test density calculation
+ */
+TEST(HarrisPriesterModel, CalcAirDensity) {
+  s2e::math::Vector<3> sun_direction_eci;
+  sun_direction_eci[0] = 0.6;
+  sun_direction_eci[1] = -0.7;
+  sun_direction_eci[2] = 0.38;
+  sun_direction_eci = sun_direction_eci.CalcNormalizedVector();
+
+  HarrisPriesterModel model;
+  model.SetSunDirection(sun_direction_eci);
+  HarrisPriesterModel polar_model(6);
+  polar_model.SetSunDirection(sun_direction_eci);
+
+  // Reference values are calculated with the original implementation
+  const std::vector<s2e::geodesy::GeodeticPosition> positions = {
+      s2e::geodesy::GeodeticPosition(0.3, 1.2, 400e3), s2e::geodesy::GeodeticPosition(-0.8, -2.0, 250e3),
+      s2e::geodesy::GeodeticPosition(1.2, 0.1, 705e3), s2e::geodesy::GeodeticPosition(-0.1, 0.5, 999e3)};
+  const double expected_kg_m3[] = {3.953763010318678e-12, 6.111697584408261e-11, 1.489378450664465e-13, 1.176935486841672e-14};
+  const double expected_polar_kg_m3[] = {3.221089140392182e-12, 5.843703107102676e-11, 1.268758718060094e-13, 9.526314288034279e-15};
+
+  const std::vector<double> densities_kg_m3 = model.CalcAirDensity_kg_m3(positions);
+  ASSERT_EQ(positions.size(), densities_kg_m3.size());
+  for (size_t i = 0; i < positions.size(); i++) {
+    EXPECT_NEAR(expected_kg_m3[i], model.CalcAirDensity_kg_m3(positions[i]), expected_kg_m3[i] * 1e-12);
+    EXPECT_NEAR(expected_polar_kg_m3[i], polar_model.CalcAirDensity_kg_m3(positions[i]), expected_polar_kg_m3[i] * 1e-12);
+    EXPECT_DOUBLE_EQ(model.CalcAirDensity_kg_m3(positions[i]), densities_kg_m3[i]);
+    EXPECT_DOUBLE_EQ(model.CalcAirDensity_kg_m3(positions[i]), CalcAirDensityWithHarrisPriester_kg_m3(positions[i], sun_direction_eci));
+  }
+}
+
+/**
+ * @brief Test density outside the altitude range of the table
+ */
+TEST(HarrisPriesterModel, OutOfRange) {
+  HarrisPriesterModel model;
+
+  EXPECT_DOUBLE_EQ(497400.0e-12, model.CalcAirDensity_kg_m3(s2e::geodesy::GeodeticPosition(0.0, 0.0, 50e3)));
+  // The apex density is extrapolated with the scale height of the band between 960 km and 1000 km
+  const double top_density_kg_m3 = 0.01810e-12;
+  EXPECT_NEAR(top_density_kg_m3, model.CalcAirDensity_kg_m3(s2e::geodesy::GeodeticPosition(0.0, 0.0, 1000e3)), top_density_kg_m3 * 1e-12);
+  const double extrapolated_density_kg_m3 = top_density_kg_m3 * pow(0.01810 / 0.02360, 5.0);
+  EXPECT_NEAR(extrapolated_density_kg_m3, model.CalcAirDensity_kg_m3(s2e::geodesy::GeodeticPosition(0.0, 0.0, 1200e3)),
+              extrapolated_density_kg_m3 * 1e-12);
+}
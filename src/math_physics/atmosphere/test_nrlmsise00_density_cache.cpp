@@ -0,0 +1,76 @@
+/**
+ * @file test_nrlmsise00_density_cache.cpp
+ * @brief Test codes for Nrlmsise00DensityCache class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include "../math/constants.hpp"
+#include "nrlmsise00_density_cache.hpp"
+
+using namespace s2e::atmosphere;
+
+/**
+ * @brief Test disabled cache
+ */
+TEST(Nrlmsise00DensityCache, Disabled) {
+  SpaceWeatherParameters space_weather{150.0, 150.0, 3.0};
+  Nrlmsise00DensityCache cache(1.0 * s2e::math::deg_to_rad, 0.0, 1000.0, 60.0);
+  EXPECT_FALSE(cache.IsEnabled());
+
+  const double expected_kg_m3 = CalcNRLMSISE00(2020.5, 0.3, 1.2, 400e3, space_weather);
+  EXPECT_DOUBLE_EQ(expected_kg_m3, cache.CalcAirDensity_kg_m3(2020.5, 0.3, 1.2, 400e3, space_weather));
+  EXPECT_EQ(0, cache.GetNumberOfCellUpdates());
+}
+
+/**
+ * @brief Test density on the grid and inside the grid cell
+ */
+TEST(Nrlmsise00DensityCache, Interpolation) {
+  SpaceWeatherParameters space_weather{150.0, 150.0, 3.0};
+  const double step_rad = 1.0 * s2e::math::deg_to_rad;
+  Nrlmsise00DensityCache cache(step_rad, step_rad, 1000.0, 60.0);
+  EXPECT_TRUE(cache.IsEnabled());
+
+  // Grid point
+  double expected_kg_m3 = CalcNRLMSISE00(2020.5, 20.0 * step_rad, 70.0 * step_rad, 400e3, space_weather);
+  EXPECT_NEAR(expected_kg_m3, cache.CalcAirDensity_kg_m3(2020.5, 20.0 * step_rad, 70.0 * step_rad, 400e3, space_weather), expected_kg_m3 * 1e-10);
+  EXPECT_EQ(1, cache.GetNumberOfCellUpdates());
+
+  // Inside the same cell
+  expected_kg_m3 = CalcNRLMSISE00(2020.5, 20.4 * step_rad, 70.7 * step_rad, 400.3e3, space_weather);
+  EXPECT_NEAR(expected_kg_m3, cache.CalcAirDensity_kg_m3(2020.5, 20.4 * step_rad, 70.7 * step_rad, 400.3e3, space_weather), expected_kg_m3 * 1e-2);
+  EXPECT_EQ(1, cache.GetNumberOfCellUpdates());
+
+  // Next cell
+  expected_kg_m3 = CalcNRLMSISE00(2020.5, -10.5 * step_rad, -100.5 * step_rad, 350.5e3, space_weather);
+  EXPECT_NEAR(expected_kg_m3, cache.CalcAirDensity_kg_m3(2020.5, -10.5 * step_rad, -100.5 * step_rad, 350.5e3, space_weather),
+              expected_kg_m3 * 1e-2);
+  EXPECT_EQ(2, cache.GetNumberOfCellUpdates());
+}
+
+/**
+ * @brief Test update conditions of the grid cell
+ */
+TEST(Nrlmsise00DensityCache, Update) {
+  SpaceWeatherParameters space_weather{150.0, 150.0, 3.0};
+  const double step_rad = 1.0 * s2e::math::deg_to_rad;
+  Nrlmsise00DensityCache cache(step_rad, step_rad, 1000.0, 60.0);
+  const double second_year = 1.0 / (365.25 * 86400.0);
+
+  cache.CalcAirDensity_kg_m3(2020.5, 0.1 * step_rad, 0.1 * step_rad, 400.1e3, space_weather);
+  EXPECT_EQ(1, cache.GetNumberOfCellUpdates());
+
+  // Within the time validity
+  cache.CalcAirDensity_kg_m3(2020.5 + 30.0 * second_year, 0.1 * step_rad, 0.1 * step_rad, 400.1e3, space_weather);
+  EXPECT_EQ(1, cache.GetNumberOfCellUpdates());
+
+  // Time validity expired
+  cache.CalcAirDensity_kg_m3(2020.5 + 61.0 * second_year, 0.1 * step_rad, 0.1 * step_rad, 400.1e3, space_weather);
+  EXPECT_EQ(2, cache.GetNumberOfCellUpdates());
+
+  // Space weather change
+  space_weather.f107 = 160.0;
+  const double expected_kg_m3 = CalcNRLMSISE00(2020.5 + 61.0 * second_year, 0.0, 0.0, 400e3, space_weather);
+  EXPECT_NEAR(expected_kg_m3, cache.CalcAirDensity_kg_m3(2020.5 + 61.0 * second_year, 0.0, 0.0, 400e3, space_weather), expected_kg_m3 * 1e-10);
+  EXPECT_EQ(3, cache.GetNumberOfCellUpdates());
+}
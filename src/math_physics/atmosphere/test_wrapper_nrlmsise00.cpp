@@ -0,0 +1,78 @@
+/**
+ * @file test_wrapper_nrlmsise00.cpp
+ * @brief Test codes for the space weather table of NRLMSISE-00 with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include "wrapper_nrlmsise00.hpp"
+
+using namespace s2e::atmosphere;
+
+/**
+ * @brief Make a record which is identified by the F10.7 value
+ */
+nrlmsise_table MakeRecord(const int year, const int month, const int day, const double f107) {
+  nrlmsise_table record{};
+  record.year = year;
+  record.month = month;
+  record.day = day;
+  record.F107_adj = f107;
+  return record;
+}
+
+/**
+ * @brief Test daily and monthly lookup of the space weather table
+ */
+TEST(SpaceWeatherTable, GetRecord) {
+  // Daily records from 2019/12/01 to 2020/03/31 and monthly records after that
+  const int days_month[] = {31, 31, 29, 31};
+  const int months[] = {12, 1, 2, 3};
+  std::vector<nrlmsise_table> records;
+  for (size_t i = 0; i < 4; i++) {
+    const int year = months[i] == 12 ? 2019 : 2020;
+    for (int day = 1; day <= days_month[i]; day++) {
+      records.push_back(MakeRecord(year, months[i], day, months[i] * 100.0 + day));
+    }
+  }
+  records.push_back(MakeRecord(2020, 4, 1, 400.0));
+  records.push_back(MakeRecord(2020, 5, 1, 500.0));
+  const double decyear_monthly = 2020.0 + 91.0 / 366.0;
+  const SpaceWeatherTable table(records, decyear_monthly);
+  EXPECT_EQ(records.size(), table.GetSize());
+
+  // Daily part. The day of the year is the integer part of the elapsed days in the year (same as the original search).
+  EXPECT_DOUBLE_EQ(109.0, table.GetRecord(2020.0 + 9.2 / 366.0).F107_adj);
+  EXPECT_DOUBLE_EQ(229.0, table.GetRecord(2020.0 + 60.5 / 366.0).F107_adj);
+  EXPECT_DOUBLE_EQ(1230.0, table.GetRecord(2019.0 + 364.5 / 365.0).F107_adj);
+
+  // Monthly part
+  EXPECT_DOUBLE_EQ(400.0, table.GetRecord(2020.0 + 100.2 / 366.0).F107_adj);
+  EXPECT_DOUBLE_EQ(500.0, table.GetRecord(2020.0 + 130.2 / 366.0).F107_adj);
+
+  // Out of the table range returns the first record
+  EXPECT_DOUBLE_EQ(1201.0, table.GetRecord(2019.0 + 100.2 / 365.0).F107_adj);
+  EXPECT_DOUBLE_EQ(1201.0, table.GetRecord(2021.5).F107_adj);
+}
+
+/**
+ * @brief Test space weather parameters
+ */
+TEST(SpaceWeatherTable, GetSpaceWeatherParameters) {
+  SpaceWeatherParameters space_weather;
+  const SpaceWeatherTable empty_table;
+  EXPECT_FALSE(GetSpaceWeatherParameters(2020.5, empty_table, false, 150.0, 140.0, 3.0, space_weather));
+
+  EXPECT_TRUE(GetSpaceWeatherParameters(2020.5, empty_table, true, 150.0, 140.0, 3.0, space_weather));
+  EXPECT_DOUBLE_EQ(150.0, space_weather.f107);
+  EXPECT_DOUBLE_EQ(140.0, space_weather.f107_average);
+  EXPECT_DOUBLE_EQ(3.0, space_weather.ap);
+
+  nrlmsise_table record = MakeRecord(2020, 7, 1, 120.0);
+  record.Ctr81_adj = 110.0;
+  record.Ap_avg = 5.0;
+  const SpaceWeatherTable table({record}, 2020.0);
+  EXPECT_TRUE(GetSpaceWeatherParameters(2020.5, table, false, 150.0, 140.0, 3.0, space_weather));
+  EXPECT_DOUBLE_EQ(120.0, space_weather.f107);
+  EXPECT_DOUBLE_EQ(110.0, space_weather.f107_average);
+  EXPECT_DOUBLE_EQ(5.0, space_weather.ap);
+}
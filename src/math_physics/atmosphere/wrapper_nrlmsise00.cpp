@@ -29,8 +29,6 @@ namespace s2e::atmosphere {
 /* ------------------------------ DEFINES ---------------------------- */
 /* ------------------------------------------------------------------- */
 
-static double decyear_monthly;
-
 int LeapYear(int year) { return ((year % 4 == 0) && (year % 100 != 0)) || (year % 400 == 0); }
 
 void ConvertDaysToMonthDay(int days, int is_leap_year, int* month_day) {
@@ -40,45 +38,35 @@ void ConvertDaysToMonthDay(int days, int is_leap_year, int* month_day) {
     days_month[1] = 29;
   }
 
-  if (days <= days_month[0]) {
-    month_day[0] = 1;
-    month_day[1] = days;
-  } else if (days > days_month[0] && days <= accumulate(days_month, days_month + 2, 0)) {
-    month_day[0] = 2;
-    month_day[1] = days - days_month[0];
-  } else if (days > accumulate(days_month, days_month + 2, 0) && days <= accumulate(days_month, days_month + 3, 0)) {
-    month_day[0] = 3;
-    month_day[1] = days - accumulate(days_month, days_month + 2, 0);
-  } else if (days > accumulate(days_month, days_month + 3, 0) && days <= accumulate(days_month, days_month + 4, 0)) {
-    month_day[0] = 4;
-    month_day[1] = days - accumulate(days_month, days_month + 3, 0);
-  } else if (days > accumulate(days_month, days_month + 4, 0) && days <= accumulate(days_month, days_month + 5, 0)) {
-    month_day[0] = 5;
-    month_day[1] = days - accumulate(days_month, days_month + 4, 0);
-  } else if (days > accumulate(days_month, days_month + 5, 0) && days <= accumulate(days_month, days_month + 6, 0)) {
-    month_day[0] = 6;
-    month_day[1] = days - accumulate(days_month, days_month + 5, 0);
-  } else if (days > accumulate(days_month, days_month + 6, 0) && days <= accumulate(days_month, days_month + 7, 0)) {
-    month_day[0] = 7;
-    month_day[1] = days - accumulate(days_month, days_month + 6, 0);
-  } else if (days > accumulate(days_month, days_month + 7, 0) && days <= accumulate(days_month, days_month + 8, 0)) {
-    month_day[0] = 8;
-    month_day[1] = days - accumulate(days_month, days_month + 7, 0);
-  } else if (days > accumulate(days_month, days_month + 8, 0) && days <= accumulate(days_month, days_month + 9, 0)) {
-    month_day[0] = 9;
-    month_day[1] = days - accumulate(days_month, days_month + 8, 0);
-  } else if (days > accumulate(days_month, days_month + 9, 0) && days <= accumulate(days_month, days_month + 10, 0)) {
-    month_day[0] = 10;
-    month_day[1] = days - accumulate(days_month, days_month + 9, 0);
-  } else if (days > accumulate(days_month, days_month + 10, 0) && days <= accumulate(days_month, days_month + 11, 0)) {
-    month_day[0] = 11;
-    month_day[1] = days - accumulate(days_month, days_month + 10, 0);
-  } else if (days > accumulate(days_month, days_month + 11, 0) && days <= accumulate(days_month, days_month + 12, 0)) {
-    month_day[0] = 12;
-    month_day[1] = days - accumulate(days_month, days_month + 11, 0);
+  int days_in_month = days;
+  for (int month = 1; month <= 12; month++) {
+    if (days_in_month <= days_month[month - 1]) {
+      month_day[0] = month;
+      month_day[1] = days_in_month;
+      return;
+    }
+    days_in_month -= days_month[month - 1];
   }
 }
 
+/**
+ * @fn CalcDayNumber
+ * @brief Calculate serial day number of the date (days from 1970/01/01)
+ * @param [in] year: Year
+ * @param [in] month: Month
+ * @param [in] day: Day
+ * @return Day number
+ */
+static long CalcDayNumber(int year, int month, int day) {
+  // Ref: H. Hinnant, chrono-Compatible Low-Level Date Algorithms (days_from_civil)
+  const long y = month <= 2 ? year - 1 : year;
+  const long era = (y >= 0 ? y : y - 399) / 400;
+  const long year_of_era = y - era * 400;
+  const long day_of_year = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+  const long day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+  return era * 146097 + day_of_era - 719468;
+}
+
 void ConvertDecyearToDate(double decyear, int* date) {
   // year
   int year = (int)(decyear);
@@ -167,8 +155,17 @@ int ConvertMonthStrToMonthNum(string month_str) {
 /* ------------------------------------------------------------------- */
 /* --------------------------CalcNRLMSISE00--------------------------- */
 /* ------------------------------------------------------------------- */
-double CalcNRLMSISE00(double decyear, double latrad, double lonrad, double alt, const vector<nrlmsise_table>& table, bool is_manual_param,
+double CalcNRLMSISE00(double decyear, double latrad, double lonrad, double alt, const SpaceWeatherTable& table, bool is_manual_param,
                       double manual_f107, double manual_f107a, double manual_ap) {
+  SpaceWeatherParameters space_weather;
+  // If the table size is zero, return 0
+  if (!GetSpaceWeatherParameters(decyear, table, is_manual_param, manual_f107, manual_f107a, manual_ap, space_weather)) {
+    return 0.0;
+  }
+  return CalcNRLMSISE00(decyear, latrad, lonrad, alt, space_weather);
+}
+
+double CalcNRLMSISE00(double decyear, double latrad, double lonrad, double alt, const SpaceWeatherParameters& space_weather) {
   struct nrlmsise_output output;
   struct nrlmsise_input input;
   struct nrlmsise_flags flags;
@@ -176,7 +173,6 @@ double CalcNRLMSISE00(double decyear, double latrad, double lonrad, double alt,
 
   size_t i;
   int date[6];
-  size_t idx = 0;
 
   /* input values */
   for (i = 0; i < 24; i++) {
@@ -193,38 +189,9 @@ double CalcNRLMSISE00(double decyear, double latrad, double lonrad, double alt,
   input.g_long = lonrad * math::rad_to_deg;
   input.lst = input.sec / 3600.0 + lonrad * math::rad_to_deg / 15.0;
 
-  if (is_manual_param) {
-    input.f107 = manual_f107;
-    input.f107A = manual_f107a;
-    input.ap = manual_ap;
-  } else {
-    // f10.7 and ap from table
-    // If the table size is zero, return 0
-    if (table.size() == 0) {
-      return 0.0;
-    }
-
-    // search table index
-    for (i = 0; i < table.size(); i++) {
-      if (decyear < decyear_monthly) {
-        // Match year, month, date
-        if ((date[0] == table[i].year) && (date[1] == table[i].month) && (date[2] == table[i].day)) {
-          idx = i;
-          break;
-        }
-      } else {
-        // Match year, month
-        if ((date[0] == table[i].year) && (date[1] == table[i].month)) {
-          idx = i;
-          break;
-        }
-      }
-    }
-
-    input.f107A = table[idx].Ctr81_adj;
-    input.f107 = table[idx].F107_adj;
-    input.ap = table[idx].Ap_avg;
-  }
+  input.f107A = space_weather.f107_average;
+  input.f107 = space_weather.f107;
+  input.ap = space_weather.ap;
 
   for (i = 0; i < 7; i++) {
     aph.a[i] = input.ap;
@@ -235,10 +202,83 @@ double CalcNRLMSISE00(double decyear, double latrad, double lonrad, double alt,
   return output.d[5];
 }
 
+bool GetSpaceWeatherParameters(double decyear, const SpaceWeatherTable& table, bool is_manual_param, double manual_f107, double manual_f107a,
+                               double manual_ap, SpaceWeatherParameters& space_weather) {
+  if (is_manual_param) {
+    space_weather.f107 = manual_f107;
+    space_weather.f107_average = manual_f107a;
+    space_weather.ap = manual_ap;
+    return true;
+  }
+
+  // f10.7 and ap from table
+  if (table.GetSize() == 0) {
+    return false;
+  }
+
+  const nrlmsise_table& record = table.GetRecord(decyear);
+  space_weather.f107_average = record.Ctr81_adj;
+  space_weather.f107 = record.F107_adj;
+  space_weather.ap = record.Ap_avg;
+  return true;
+}
+
+/* ------------------------------------------------------------------- */
+/* -------------------------SpaceWeatherTable------------------------- */
+/* ------------------------------------------------------------------- */
+SpaceWeatherTable::SpaceWeatherTable(const vector<nrlmsise_table>& records, const double decyear_monthly)
+    : records_(records), decyear_monthly_(decyear_monthly) {
+  if (records_.empty()) return;
+
+  long last_day = first_day_ = CalcDayNumber(records_[0].year, records_[0].month, records_[0].day);
+  long last_month = first_month_ = records_[0].year * 12L + records_[0].month - 1;
+  for (const auto& record : records_) {
+    const long day = CalcDayNumber(record.year, record.month, record.day);
+    const long month = record.year * 12L + record.month - 1;
+    first_day_ = std::min(first_day_, day);
+    last_day = std::max(last_day, day);
+    first_month_ = std::min(first_month_, month);
+    last_month = std::max(last_month, month);
+  }
+
+  // The first matched record is used for each day and month. Days and months without records use the first record.
+  day_index_.assign(last_day - first_day_ + 1, 0);
+  month_index_.assign(last_month - first_month_ + 1, 0);
+  for (size_t i = records_.size(); i-- > 0;) {
+    const nrlmsise_table& record = records_[i];
+    day_index_[CalcDayNumber(record.year, record.month, record.day) - first_day_] = i;
+    month_index_[record.year * 12L + record.month - 1 - first_month_] = i;
+  }
+}
+
+const nrlmsise_table& SpaceWeatherTable::GetRecord(const double decyear) const {
+  // Same date conversion with ConvertDecyearToDate
+  const int year = (int)decyear;
+  const int is_leap_year = LeapYear(year);
+  const int days_per_year = is_leap_year ? 366 : 365;
+  int days = (int)((decyear - year) * days_per_year);
+  if (days == 0) {
+    days = 1;
+  }
+
+  if (decyear < decyear_monthly_) {
+    // Match year, month, date
+    const long offset = CalcDayNumber(year, 1, 1) + days - 1 - first_day_;
+    if (offset >= 0 && offset < (long)day_index_.size()) return records_[day_index_[offset]];
+  } else {
+    // Match year, month
+    int month_day[2];
+    ConvertDaysToMonthDay(days, is_leap_year, month_day);
+    const long offset = year * 12L + month_day[0] - 1 - first_month_;
+    if (offset >= 0 && offset < (long)month_index_.size()) return records_[month_index_[offset]];
+  }
+  return records_[0];
+}
+
 /* ------------------------------------------------------------------- */
 /* -----------------------ReadSpaceWeatherTable----------------------- */
 /* ------------------------------------------------------------------- */
-size_t GetSpaceWeatherTable_(double decyear, double endsec, const string& filename, vector<nrlmsise_table>& table) {
+size_t GetSpaceWeatherTable_(double decyear, double endsec, const string& filename, SpaceWeatherTable& table) {
   ifstream ifs(filename);
 
   if (!ifs.is_open()) {
@@ -258,6 +298,12 @@ size_t GetSpaceWeatherTable_(double decyear, double endsec, const string& filena
     cerr << "Year must be between 2015 and 2043 for NRLMSISE00 atmosphere model" << endl;
   }
 
+  // To get 1 month data, read the data before a month from the simulation starting date
+  double decyear_ini_ymd = ConvertDateToDecyear(date_ini[0], date_ini[1], date_ini[2]) - 31.0 / 365.0;  // Subtract one month
+  double decyear_end_ymd = ConvertDateToDecyear(date_end[0], date_end[1], date_end[2]);
+  double decyear_monthly = 0.0;
+  vector<nrlmsise_table> records;
+
   string line;
   while (getline(ifs, line)) {
     nrlmsise_table line_data;
@@ -284,9 +330,6 @@ size_t GetSpaceWeatherTable_(double decyear, double endsec, const string& filena
     int month = atoi(line.substr(5, 2).c_str());
     int day = atoi(line.substr(8, 2).c_str());
     double decyear_line = ConvertDateToDecyear(year, month, day);
-    // To get 1 month data, read the data before a month from the simulation starting date
-    double decyear_ini_ymd = ConvertDateToDecyear(date_ini[0], date_ini[1], date_ini[2]) - 31.0 / 365.0;  // Subtract one month
-    double decyear_end_ymd = ConvertDateToDecyear(date_end[0], date_end[1], date_end[2]);
 
     if (decyear_line < decyear_ini_ymd || decyear_line > decyear_end_ymd) continue;
 
@@ -302,10 +345,11 @@ size_t GetSpaceWeatherTable_(double decyear, double endsec, const string& filena
     line_data.Ctr81_obs = atof(line.substr(119, 5).c_str());
     line_data.Lst81_obs = atof(line.substr(125, 5).c_str());
 
-    table.push_back(line_data);
+    records.push_back(line_data);
   }
 
-  return table.size();
+  table = SpaceWeatherTable(records, decyear_monthly);
+  return table.GetSize();
 }
 
 }  // namespace s2e::atmosphere
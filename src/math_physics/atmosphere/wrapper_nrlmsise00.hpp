@@ -32,9 +32,94 @@ struct nrlmsise_table {
   double Lst81_obs;  //!< Last 81-day arithmetic average of F10.7 (observed).
 };
 
+/**
+ * @class SpaceWeatherTable
+ * @brief Space weather table with a day-indexed lookup
+ * @note The table has daily records until 1.5 months after the update date of the file and monthly records after that.
+ */
+class SpaceWeatherTable {
+ public:
+  /**
+   * @fn SpaceWeatherTable
+   * @brief Default constructor for an empty table
+   */
+  SpaceWeatherTable() {}
+  /**
+   * @fn SpaceWeatherTable
+   * @brief Constructor
+   * @param [in] records: Records of the table in chronological order
+   * @param [in] decyear_monthly: Decimal year after which the records are monthly
+   */
+  SpaceWeatherTable(const std::vector<nrlmsise_table>& records, const double decyear_monthly);
+
+  /**
+   * @fn GetRecord
+   * @brief Return the record of the day (or the month for the monthly part) including the decimal year
+   * @note The first record is returned when no record matches. The table must not be empty.
+   * @param [in] decyear: Decimal year
+   */
+  const nrlmsise_table& GetRecord(const double decyear) const;
+
+  /**
+   * @fn GetSize
+   * @brief Return number of records
+   */
+  inline size_t GetSize() const { return records_.size(); }
+  /**
+   * @fn GetRecords
+   * @brief Return records of the table
+   */
+  inline const std::vector<nrlmsise_table>& GetRecords() const { return records_; }
+
+ private:
+  std::vector<nrlmsise_table> records_;  //!< Records of the table
+  double decyear_monthly_ = 0.0;         //!< Decimal year after which the records are monthly
+  long first_day_ = 0;                   //!< Day number of the first record
+  long first_month_ = 0;                 //!< Month number of the first record
+  std::vector<size_t> day_index_;        //!< Record index for each day from the first record
+  std::vector<size_t> month_index_;      //!< Record index for each month from the first record
+};
+
+/**
+ * @struct SpaceWeatherParameters
+ * @brief Space weather indices used as the input of the NRLMSISE-00 model
+ */
+struct SpaceWeatherParameters {
+  double f107 = 0.0;          //!< Daily F10.7
+  double f107_average = 0.0;  //!< 81-day averaged F10.7
+  double ap = 0.0;            //!< Ap-index
+};
+
+/**
+ * @fn GetSpaceWeatherParameters
+ * @brief Get the space weather indices at the decimal year
+ * @param [in] decyear: Decimal year
+ * @param [in] table: Space Weather table
+ * @param [in] is_manual_param: Flag to use manual parameters
+ * @param [in] manual_f107: Manual setting F10.7
+ * @param [in] manual_f107a: Manual setting averaged F10.7
+ * @param [in] manual_ap: Manual setting Ap-index
+ * @param [out] space_weather: Space weather indices
+ * @return false when the table is empty
+ */
+bool GetSpaceWeatherParameters(double decyear, const SpaceWeatherTable& table, bool is_manual_param, double manual_f107, double manual_f107a,
+                               double manual_ap, SpaceWeatherParameters& space_weather);
+
 /**
  * @fn CalcNRLMSISE00
- * @brief Read the space weather table file
+ * @brief Calculate atmospheric density with the NRLMSISE-00 model
+ * @param [in] decyear: Decimal year
+ * @param [in] latrad: Latitude [rad]
+ * @param [in] lonrad: Longitude [rad]
+ * @param [in] alt: Altitude [m]
+ * @param [in] space_weather: Space weather indices
+ * @return Atmospheric density [kg/m3]
+ */
+double CalcNRLMSISE00(double decyear, double latrad, double lonrad, double alt, const SpaceWeatherParameters& space_weather);
+
+/**
+ * @fn CalcNRLMSISE00
+ * @brief Calculate atmospheric density with the NRLMSISE-00 model and the space weather table
  * @param [in] decyear: Decimal year of the simulation start time
  * @param [in] latrad: Latitude [rad]
  * @param [in] lonrad: Longitude [rad]
@@ -46,7 +131,7 @@ struct nrlmsise_table {
  * @param [in] manual_ap: Manual setting Ap-index
  * @return Atmospheric density [kg/m3]
  */
-double CalcNRLMSISE00(double decyear, double latrad, double lonrad, double alt, const std::vector<nrlmsise_table>& table, bool is_manual_param,
+double CalcNRLMSISE00(double decyear, double latrad, double lonrad, double alt, const SpaceWeatherTable& table, bool is_manual_param,
                       double manual_f107, double manual_f107a, double manual_ap);
 
 /**
@@ -58,7 +143,7 @@ double CalcNRLMSISE00(double decyear, double latrad, double lonrad, double alt,
  * @param [out] table: Space weather table
  * @return Size of table
  */
-size_t GetSpaceWeatherTable_(double decyear, double endsec, const std::string& filename, std::vector<nrlmsise_table>& table);
+size_t GetSpaceWeatherTable_(double decyear, double endsec, const std::string& filename, SpaceWeatherTable& table);
 
 /* ------------------------------------------------------------------- */
 /* ----------------------- COMPILATION TWEAKS ------------------------ */
@@ -1,472 +1,281 @@
-/**********************/
-/***     igrf.c     ***/
-/****************************************************************************/
-/* Usage from FORTRAN :     ( All variables are in single precision )       */
-/*      First specify the Generation Number with the Year of Calc.          */
-/*          by  CALL gigrf(NGEN, YEAR),                                     */
-/*        or specify the Model Type (IGRF/DGRF/PGRF) with the Year of Calc. */
-/*          by  CALL sigrf(YEAR), CALL sdgrf(YEAR) or CALL spgrf(YEAR) .    */
-/*      Then, CALL igrfc(FI, FK, H, F) gives TotalForce (F) of that model   */
-/*          at the point of Lat.=FI, Long.=FK, Alt.=H                       */
-/*      If other components are desired, CALL igrfm(FM) .                   */
-/*          Here FM is an array with 6 elements, which correspond to        */
-/*              North(X), East(Y), Downward(Z), Horizontal(H) components,   */
-/*              Inclination(I) and Declination(D).                          */
-/*  Unit Convention:  Lat.(FI), Long.(FK), Inc.(I), Dec.(D) are in degrees, */
-/*                    Mag.Fields(F,X,Y,Z,H) in nT, and Alt.(H) in meters.   */
-/****************************************************************************/
-/* Prototype definition for C :                                             */
-/*--------------------------------------------------------------------------*/
-/*   < Conventional Functions and their FORTRAN Interfaces >                */
-/*--------------------------------------------------------------------------*/
-/*  void sigrf(double year);         |  void sigrf_(float *year);           */
-/*   / void sdgrf(double year);      |   / void sdgrf_(float *year);        */
-/*   / void spgrf(double year);      |   / void spgrf_(float *year);        */
-/*  void gigrf(int gen, double year);|  void gigrf_(int *gen, float *year); */
-/*  void igrfc(double fi, double fk, |  void igrfc_(float *fi, float *fk,   */
-/*             double h, double *f); |              float *h, float *f);    */
-/*  void igrfm(double fm[6]);        |  void igrfm_(float fm[6]);           */
-/*--------------------------------------------------------------------------*/
-/*   < Substantial Calculation Functions >                                  */
-/*--------------------------------------------------------------------------*/
-/*  void field(double are, double aflat, double ara, int maxoda);           */
-/*  void tcoef(double agh[MxOD+1][MxOD+1], double aght[MxOD+1][MxOD+1],     */
-/*             double atzero, int kexta, double aext[3]);                   */
-/*  void tyear(double ayear);                                               */
-/*  void mfldg(double alat, double alon, double ahi,                        */
-/*             double *ax, double *ay, double *az, double *af);             */
-/*  void mfldc(double athe, double alon, double ar,                         */
-/*             double *ax, double *ay, double *az, double *af);             */
-/*  void gcomp(double *axg, double *ayg, double *azg);                      */
-/****************************************************************************/
+/**
+ * @file igrf.cpp
+ * @brief IGRF (International Geomagnetic Reference Field) model
+ * @note The calculation algorithm is based on the code distributed at https://www.gsj.jp/data/openfile/no0423/index.html
+ */
 
-#include <math.h>
-#include <stdio.h>
-#include <string.h>
+#include "igrf.hpp"
 
-#include <cstdlib>
+#include <cmath>
+#include <fstream>
 #include <iostream>
-using namespace std;
+#include <sstream>
 
-#include "../../math_physics/orbit/sgp4/sgp4ext.h"
-#include "igrf.h"
+#include "../math/constants.hpp"
+#include "../orbit/sgp4/sgp4ext.h"
 
-double testglobal[3];
+namespace s2e::geomagnetic {
 
-#ifdef WIN32
-#pragma warning(disable : 4996)  // fopenなど回避
-#pragma warning(disable : 4305)  // double->float回避
-#endif
+// Earth shape used in the geodetic to geocentric conversion
+static const double kEquatorialRadius_km = 6378.137;  //!< Equatorial radius [km]
+static const double kFlattening = 298.25722;          //!< Inverse flattening
+static const double kReferenceRadius_km = 6371.2;     //!< Reference radius of the IGRF model [km]
 
-/*--------------------*/
-/*   Basic Routines   */
-/*--------------------*/
-
-// TODO: Consider how to fix the following constant values in this library copied from outside
-
-#define MxOD 19
-#define URAD (180. / 3.14159265359)
-
-#define PI 3.14159265358979323846
-#define DEG2RAD 0.017453292519943295769236907684886  // PI/180
-#define RAD2DEG (180 / PI)
-
-static double ra, rpre, re, re2, re4, rp, rp2, rp4, tzero;
-static int maxod, kg, kgc, kr, kth, kph, kext;
-static double blat, blon, bhi, br, bthe;
-static double rlat, slat, slat2, clat2;
-static double r, the, phi, cth, sth, cph, sph;
-static double x, y, z, f, ext0, ext1, ext2;
-static double gh[MxOD + 1][MxOD + 1], ght[MxOD + 1][MxOD + 1], g[MxOD + 1][MxOD + 1];
-static double rar[MxOD + 1], csp[MxOD + 1], snp[MxOD + 1], p[MxOD + 2][MxOD + 1];
-
-static double vgh[MxOD + 1][MxOD + 1], vght[MxOD + 1][MxOD + 1];
-
-// coeff file path
-static char coeff_file[256];
+Igrf::Igrf(const std::string coefficient_file_path) {
+  is_file_read_succeeded_ = ReadFile(coefficient_file_path);
+  if (is_file_read_succeeded_) InitializeLegendreCoefficients();
+}
 
-static void fcalc(void);
+bool Igrf::ReadFile(const std::string file_path) {
+  std::ifstream coefficient_file(file_path);
+  if (!coefficient_file.is_open()) {
+    std::cout << "[Warning] IGRF coefficient file not found: " << file_path << std::endl;
+    return false;
+  }
 
-void set_file_path(const char *fname) { strcpy(coeff_file, fname); }
+  // Line 1: Generation, number of columns, valid period
+  std::string line;
+  std::getline(coefficient_file, line);
+  std::istringstream header(line);
+  int generation;
+  size_t number_of_columns;
+  double valid_start_year, valid_end_year;
+  header >> generation >> number_of_columns >> valid_start_year >> valid_end_year;
+  if (header.fail() || number_of_columns < 2) {
+    std::cout << "[Warning] IGRF coefficient file has invalid header: " << file_path << std::endl;
+    return false;
+  }
 
-static void fcalc(void) /* This is an internal function */
-{
-  double t, pn1m, tx, ty, tz;
-  int n, m;
-  if (kr != 0) {
-    kr = 0;
-    t = ra / r;
-    rar[0] = t * t;
-    for (n = 0; n < maxod; n++) rar[n + 1] = rar[n] * t;
+  // Line 2: Epochs. The last column is the secular variation
+  const size_t number_of_epochs = number_of_columns - 1;
+  std::getline(coefficient_file, line);
+  std::istringstream epoch_line(line);
+  std::string label;
+  size_t n, m;
+  epoch_line >> label >> n >> m;
+  epochs_year_.assign(number_of_epochs, 0.0);
+  for (size_t i = 0; i < number_of_epochs; i++) {
+    epoch_line >> epochs_year_[i];
   }
-  if (kth != 0) {
-    kth = 0;
-    p[0][0] = 1.;
-    p[1][0] = 0.;
-    p[0][1] = cth;
-    p[1][1] = sth;
-    p[2][0] = -sth;
-    p[2][1] = cth;
-    for (n = 1; n < maxod; n++) {
-      p[0][n + 1] = (p[0][n] * cth * (n + n + 1) - p[0][n - 1] * n) / (n + 1);
-      p[n + 2][0] = (p[0][n + 1] * cth - p[0][n]) * (n + 1) / sth;
-      for (m = 0; m <= n; m++) {
-        pn1m = p[m][n + 1];
-        p[m + 1][n + 1] = (p[m][n] * (n + m + 1) - pn1m * cth * (n - m + 1)) / sth;
-        p[n + 2][m + 1] = pn1m * (n + m + 2) * (n - m + 1) - p[m + 1][n + 1] * cth * (m + 1) / sth;
-      }
-    }
+  if (epoch_line.fail()) {
+    std::cout << "[Warning] IGRF coefficient file has invalid epoch line: " << file_path << std::endl;
+    return false;
   }
-  if (kph != 0) {
-    kph = 0;
-    csp[0] = 1.;
-    snp[0] = 0.;
-    for (m = 0; m < maxod; m++) {
-      csp[m + 1] = csp[m] * cph - snp[m] * sph;
-      snp[m + 1] = snp[m] * cph + csp[m] * sph;
+
+  // Coefficient lines
+  struct CoefficientLine {
+    bool is_cosine;
+    size_t n, m;
+    std::vector<double> values;
+  };
+  std::vector<CoefficientLine> coefficient_lines;
+  while (std::getline(coefficient_file, line)) {
+    std::istringstream streamline(line);
+    CoefficientLine coefficient_line;
+    if (!(streamline >> label >> coefficient_line.n >> coefficient_line.m)) continue;
+    coefficient_line.is_cosine = (label == "g");
+    coefficient_line.values.assign(number_of_columns, 0.0);
+    for (size_t i = 0; i < number_of_columns; i++) {
+      streamline >> coefficient_line.values[i];
     }
-  }
-  x = 0.;
-  y = 0.;
-  z = 0.;
-  for (n = 0; n < maxod; n++) {
-    tx = g[0][n + 1] * p[n + 2][0];
-    ty = 0.;
-    tz = g[0][n + 1] * p[0][n + 1];
-    for (m = 0; m <= n; m++) {
-      tx += (g[m + 1][n + 1] * csp[m + 1] + g[n + 1][m] * snp[m + 1]) * p[n + 2][m + 1];
-      ty += (g[m + 1][n + 1] * snp[m + 1] - g[n + 1][m] * csp[m + 1]) * p[m + 1][n + 1] * (m + 1);
-      tz += (g[m + 1][n + 1] * csp[m + 1] + g[n + 1][m] * snp[m + 1]) * p[m + 1][n + 1];
+    if (streamline.fail() || coefficient_line.m > coefficient_line.n) {
+      std::cout << "[Warning] IGRF coefficient file has invalid coefficient line: " << line << std::endl;
+      return false;
     }
-    x += rar[n + 1] * tx;
-    y += rar[n + 1] * ty;
-    z -= rar[n + 1] * tz * (n + 2);
+    if (coefficient_line.n > max_degree_) max_degree_ = coefficient_line.n;
+    coefficient_lines.push_back(coefficient_line);
   }
-  y /= sth;
-  if (kext != 0) {
-    t = ext1 * cph + ext2 * sph;
-    x -= (ext0 * cth + t * sth);
-    y += (ext1 * sph - ext2 * cph);
-    z += (ext0 * sth - t * cth);
+  if (max_degree_ == 0 || max_degree_ > kMaxDegree) {
+    std::cout << "[Warning] IGRF coefficient file has invalid degree: " << max_degree_ << std::endl;
+    max_degree_ = 0;
+    return false;
   }
-  f = sqrt(x * x + y * y + z * z);
-}
 
-void field(double are, double aflat, double ara, int maxoda) {
-  ra = ara;
-  maxod = maxoda;
-  rpre = 1. - 1. / aflat;
-  re = are;
-  re2 = re * re;
-  re4 = re2 * re2;
-  rp = re * rpre;
-  rp2 = rp * rp;
-  rp4 = rp2 * rp2;
-  kg = 2;
-  kgc = 0;
-  kph = 1;
-}
-
-void tcoef(double agh[MxOD + 1][MxOD + 1], double aght[MxOD + 1][MxOD + 1], double atzero, int kexta, double aext[3]) {
-  int nn, mm;
-  double fac;
-  tzero = atzero;
-  kext = kexta;
-  gh[0][0] = 0.;
-  ght[0][0] = 0.;
-  for (nn = 1; nn <= maxod; nn++) {
-    gh[0][nn] = agh[0][nn];
-    ght[0][nn] = aght[0][nn];
-    fac = sqrt(2.);
-    for (mm = 1; mm <= nn; mm++) {
-      fac /= sqrt((double)((nn + mm) * (nn - mm + 1)));
-      gh[mm][nn] = agh[mm][nn] * fac;
-      gh[nn][mm - 1] = agh[nn][mm - 1] * fac;
-      ght[mm][nn] = aght[mm][nn] * fac;
-      ght[nn][mm - 1] = aght[nn][mm - 1] * fac;
+  // Store coefficients and rates for each epoch
+  const size_t size = (max_degree_ + 1) * (max_degree_ + 1);
+  g_nT_.assign(number_of_epochs, std::vector<double>(size, 0.0));
+  h_nT_.assign(number_of_epochs, std::vector<double>(size, 0.0));
+  g_rate_nT_.assign(number_of_epochs, std::vector<double>(size, 0.0));
+  h_rate_nT_.assign(number_of_epochs, std::vector<double>(size, 0.0));
+  for (const auto &coefficient_line : coefficient_lines) {
+    const size_t index = coefficient_line.n * (max_degree_ + 1) + coefficient_line.m;
+    auto &coefficients = coefficient_line.is_cosine ? g_nT_ : h_nT_;
+    auto &rates = coefficient_line.is_cosine ? g_rate_nT_ : h_rate_nT_;
+    for (size_t i = 0; i < number_of_epochs; i++) {
+      coefficients[i][index] = coefficient_line.values[i];
+      if (i + 1 < number_of_epochs) {
+        rates[i][index] = (coefficient_line.values[i + 1] - coefficient_line.values[i]) / (epochs_year_[i + 1] - epochs_year_[i]);
+      } else {
+        rates[i][index] = coefficient_line.values[number_of_columns - 1];
+      }
     }
   }
-  if (kext == 0) {
-    ext0 = 0.;
-    ext1 = 0.;
-    ext2 = 0.;
-  } else {
-    ext0 = aext[0];
-    ext1 = aext[1];
-    ext2 = aext[2];
-  }
+
+  return true;
 }
 
-void tyear(double ayear) {
-  double dyear;
-  int nn, mm;
-  dyear = ayear - tzero;
-  for (nn = 0; nn <= maxod; nn++) {
-    for (mm = 0; mm <= maxod; mm++) {
-      g[mm][nn] = gh[mm][nn] + ght[mm][nn] * dyear;
+void Igrf::InitializeLegendreCoefficients() {
+  const size_t stride = max_degree_ + 1;
+  legendre_coefficient_1_.assign(stride * stride, 0.0);
+  legendre_coefficient_2_.assign(stride * stride, 0.0);
+  legendre_sectoral_coefficient_.assign(stride, 1.0);
+  for (size_t n = 1; n <= max_degree_; n++) {
+    const double n_d = (double)n;
+    if (n >= 2) legendre_sectoral_coefficient_[n] = sqrt((2.0 * n_d - 1.0) / (2.0 * n_d));
+    for (size_t m = 0; m < n; m++) {
+      const double m_d = (double)m;
+      const double denominator = sqrt(n_d * n_d - m_d * m_d);
+      legendre_coefficient_1_[n * stride + m] = (2.0 * n_d - 1.0) / denominator;
+      legendre_coefficient_2_[n * stride + m] = sqrt((n_d - 1.0) * (n_d - 1.0) - m_d * m_d) / denominator;
     }
   }
 }
 
-void mfldg(double alat, double alon, double ahi, double *ax, double *ay, double *az, double *af) {
-  double hi, rm2, rm, rrm;
-  if ((kg != 1) || (blat != alat) || (bhi != ahi)) {
-    kg = 1;
-    kr = 1;
-    kth = 1;
-    blat = alat;
-    bhi = ahi;
-    rlat = alat / URAD;
-    hi = ahi;
-    slat = sin(rlat);
-    slat2 = slat * slat;
-    clat2 = 1. - slat2;
-    rm2 = re2 * clat2 + rp2 * slat2;
-    rm = sqrt(rm2);
-    rrm = (re4 * clat2 + rp4 * slat2) / rm2;
-    r = sqrt(rrm + 2. * hi * rm + hi * hi);
-    cth = slat * (hi + rp2 / rm) / r;
-    sth = sqrt(1. - cth * cth);
-  }
-  if (blon != alon) kph = 1;
-  if (kph != 0) {
-    blon = alon;
-    phi = alon / URAD;
-    cph = cos(phi);
-    sph = sin(phi);
+size_t Igrf::CalcEpochIndex(const double decimal_year) const {
+  for (size_t i = 1; i < epochs_year_.size(); i++) {
+    if (decimal_year < epochs_year_[i]) return i - 1;
   }
-  fcalc();
-  *ax = x;
-  *ay = y;
-  *az = z;
-  *af = f;
+  // Use the secular variation after the last epoch
+  return epochs_year_.size() - 1;
 }
 
-void mfldc(double athe, double alon, double ar, double *ax, double *ay, double *az, double *af) {
-  if (kg == 0) {
-    if (bthe != athe) kth = 1;
-    if (br != ar) kr = 1;
-  } else {
-    kg = 0;
-    kr = 1;
-    kth = 1;
-  }
-  if (kr != 0) {
-    br = ar;
-    r = ar;
+IgrfCoefficients Igrf::CalcCoefficients(const double decimal_year) const {
+  IgrfCoefficients coefficients;
+  coefficients.decimal_year = decimal_year;
+  if (!is_file_read_succeeded_) return coefficients;
+
+  const size_t epoch_index = CalcEpochIndex(decimal_year);
+  const double elapsed_year = decimal_year - epochs_year_[epoch_index];
+  const size_t size = g_nT_[epoch_index].size();
+  coefficients.max_degree = max_degree_;
+  coefficients.g_nT.resize(size);
+  coefficients.h_nT.resize(size);
+  for (size_t i = 0; i < size; i++) {
+    coefficients.g_nT[i] = g_nT_[epoch_index][i] + g_rate_nT_[epoch_index][i] * elapsed_year;
+    coefficients.h_nT[i] = h_nT_[epoch_index][i] + h_rate_nT_[epoch_index][i] * elapsed_year;
   }
-  if (kth != 0) {
-    bthe = athe;
-    the = athe / URAD;
-    cth = cos(the);
-    sth = sin(the);
-  }
-  if (blon != alon) kph = 1;
-  if (kph != 0) {
-    blon = alon;
-    phi = alon / URAD;
-    cph = cos(phi);
-    sph = sin(phi);
-  }
-  fcalc();
-  *ax = x;
-  *ay = y;
-  *az = z;
-  *af = f;
+  return coefficients;
 }
 
-/*---------------------------*/
-/*   Conventional Routines   */
-/*---------------------------*/
-
-#define MxGEN 13  // 12//11//10
-#define RAD (180. / 3.14159265359)
-#define MxMOD 19
-#define MxELM ((MxMOD + 1) * (MxMOD + 1) - 1)
-#define MxCOL 50
-#define LLINE (MxCOL * 9 + 10)
+math::Vector<3> Igrf::CalcMagneticField_i_nT(const double decimal_year, const geodesy::GeodeticPosition &position, const double gmst_rad) const {
+  return CalcMagneticField_i_nT(CalcCoefficients(decimal_year), position, gmst_rad);
+}
 
-// GIGRFの計算（G,D,P-GRFの区別なく計算）
-// WGS84モデルで計算
-void gigrf(int gen, double year) {
-  int i, n, m, l, k, ncol, nlin;
-  double y1, y2, yr1 = 0.0, yr2 = 0.0;
-  double dmy[3], cb[MxELM], cv[MxELM];
-  // 係数表指定
-  //  char path[]="igrf10.coef";
-  //  char file[]="igrf10.coef";
-  //  char path[] = "igrf11.coef";
-  //  char file[] = "igrf11.coef";
-  //  char path[] = "src/external_libraries/igrf/igrf11.coef";
-  //  char file[] = "src/external_libraries/igrf/igrf11.coef";
-  //  char path[] = "../SatAttSim/src/external_libraries/igrf/igrf12.coef";
-  //  char file[] = "../SatAttSim/src/external_libraries/igrf/igrf12.coef";
-  //  char path[] = "../../SatAttSim/src/external_libraries/igrf/igrf13.coef"; //from 2020
-  //  char file[] = "../../SatAttSim/src/external_libraries/igrf/igrf13.coef"; //from 2020
+math::Vector<3> Igrf::CalcMagneticField_i_nT(const IgrfCoefficients &coefficients, const geodesy::GeodeticPosition &position,
+                                             const double gmst_rad) const {
+  math::Vector<3> magnetic_field_i_nT(0.0);
+  if (!is_file_read_succeeded_ || coefficients.max_degree != max_degree_) return magnetic_field_i_nT;
+
+  // Geodetic to geocentric
+  const double polar_radius_km = kEquatorialRadius_km * (1.0 - 1.0 / kFlattening);
+  const double equatorial_radius2_km2 = kEquatorialRadius_km * kEquatorialRadius_km;
+  const double polar_radius2_km2 = polar_radius_km * polar_radius_km;
+  const double altitude_km = position.GetAltitude_m() / 1000.0;
+  const double sin_latitude = sin(position.GetLatitude_rad());
+  const double sin_latitude2 = sin_latitude * sin_latitude;
+  const double cos_latitude2 = 1.0 - sin_latitude2;
+  const double rm2_km2 = equatorial_radius2_km2 * cos_latitude2 + polar_radius2_km2 * sin_latitude2;
+  const double rm_km = sqrt(rm2_km2);
+  const double rrm_km2 =
+      (equatorial_radius2_km2 * equatorial_radius2_km2 * cos_latitude2 + polar_radius2_km2 * polar_radius2_km2 * sin_latitude2) / rm2_km2;
+  const double radius_km = sqrt(rrm_km2 + 2.0 * altitude_km * rm_km + altitude_km * altitude_km);
+  const double cos_theta = sin_latitude * (altitude_km + polar_radius2_km2 / rm_km) / radius_km;
+  const double sin_theta = sqrt(1.0 - cos_theta * cos_theta);
+  const double longitude_rad = position.GetLongitude_rad();
+
+  math::Vector<3> magnetic_field_ned_nT = CalcMagneticFieldSpherical_nT(coefficients, radius_km, cos_theta, sin_theta, longitude_rad);
+
+  // North-East-Down to inertial frame
+  double magnetic_field[3] = {magnetic_field_ned_nT[0], magnetic_field_ned_nT[1], magnetic_field_ned_nT[2]};
+  RotationY(magnetic_field, magnetic_field, math::pi - acos(cos_theta));
+  RotationZ(magnetic_field, magnetic_field, -longitude_rad);
+  RotationZ(magnetic_field, magnetic_field, -gmst_rad);
+  for (size_t i = 0; i < 3; i++) {
+    magnetic_field_i_nT[i] = magnetic_field[i];
+  }
 
-  char file[256];
+  return magnetic_field_i_nT;
+}
 
-  char *pstr, *line, buf[LLINE];
-  FILE *fp;
-  if ((gen < 1) || (MxGEN < gen)) {
-    fprintf(stderr, "gigrf: unknown  NGEN = %d\n", gen);
-    exit(1);
-  }
-  strcpy(file, coeff_file);
-  // strstr(const char *s1, const char *s2)=>文字列s1から文字列s2を検索
-  // if ((pstr=strstr(file,"10")) == NULL)
-  // if ((pstr = strstr(file, "11")) == NULL)
-  // if ((pstr = strstr(file, "12")) == NULL)
-  if ((pstr = strstr(file, "13")) == NULL) {
-    fprintf(stderr, "gigrf: filename invalid\n");
-    exit(1);
-  }
-  // sprintf(char *str, const char *format,  ．．．
-  // )=printf関数と同様の変換を行った出力を、文字列strに格納 char *strncpy(char
-  // *s1, const char *s2, size_t n);= *s1 に文字列 *s2 を先頭から n 文字コピー
-  snprintf(buf, LLINE, "%02d", gen);
-  strncpy(pstr, buf, 2);
-  if ((fp = fopen(file, "r")) == NULL) {
-    fprintf(stderr, "gigrf: file not found\n");
-    exit(1);
-  }
-  if (fgets(buf, LLINE, fp) == NULL) {
-    fprintf(stderr, "gigrf: file empty\n");
-    exit(1);
-  }
-  // int sscanf(const char *str, const char *format,  ．．．
-  // );=strから書式formatにしたがって、scanf関数と同様の変換を行った入力を、指定されたアドレスに格納
-  if (sscanf(buf, "%d%d%lf%lf", &maxod, &ncol, &y1, &y2) != 4) {
-    fprintf(stderr, "gigrf: Line-1 format error\n");
-    exit(1);
-  }
-  // for debug
-  else {
-    // fprintf(stderr, "coeff-matrix:%dby%d,valid period:%lfto%lf\n", maxod,
-    // ncol, y1, y2);
-  }
-  if ((maxod < 8) || (maxod > MxMOD) || (ncol < 2) || (ncol > MxCOL)) {
-    fprintf(stderr, "gigrf: Line-1 invalid\n");
-    exit(1);
-  }
-  nlin = (maxod + 1) * (maxod + 1) - 1;
-  if ((year < y1) || (year > y2)) fprintf(stderr, "gigrf: IGRF-%02d not defined for %9.3lf\n", gen, year);
-  if (fgets(buf, LLINE, fp) == NULL) {
-    fprintf(stderr, "gigrf: EOF before Line-2\n");
-    exit(1);
-  }
-  line = &buf[1];
-  if (sscanf(line, "%*c%*d%*d%lf%n", &yr2, &n) == EOF) {
-    fprintf(stderr, "gigrf: Line-2 invalid\n");
-    exit(1);
-  }
-  for (l = 2; l < ncol; l++) {
-    line += n;
-    yr1 = yr2;
-    if (sscanf(line, "%lf%n", &yr2, &n) == EOF) {
-      fprintf(stderr, "gigrf: Line-2 short\n");
-      exit(1);
-    }
-    if (year < yr2) break;
-  }
-  for (i = 0; i < nlin; i++) {
-    if (fgets(buf, LLINE, fp) == NULL) {
-      fprintf(stderr, "gigrf: EOF before Line-%d\n", i + 3);
-      exit(1);
-    }
-    line = &buf[0];
-    if (sscanf(line, "%*c%*d%*d%n", &n) == EOF) {
-      fprintf(stderr, "gigrf: Line-%d invalid\n", i + 3);
-      exit(1);
-    }
-    for (m = 2; m < l; m++) {
-      line += n;
-      if (sscanf(line, "%*f%n", &n) == EOF) {
-        fprintf(stderr, "gigrf: Line-%d short\n", i + 3);
-        exit(1);
+math::Vector<3> Igrf::CalcMagneticFieldSpherical_nT(const IgrfCoefficients &coefficients, const double radius_km, const double cos_theta,
+                                                    const double sin_theta, const double longitude_rad) const {
+  const size_t n_max = max_degree_;
+  const size_t stride = n_max + 1;
+  const double *g_nT = coefficients.g_nT.data();
+  const double *h_nT = coefficients.h_nT.data();
+
+  // Power of the radius ratio
+  double radius_ratio_power[kMaxDegree + 1];
+  const double radius_ratio = kReferenceRadius_km / radius_km;
+  radius_ratio_power[0] = radius_ratio * radius_ratio;
+  for (size_t n = 0; n < n_max; n++) radius_ratio_power[n + 1] = radius_ratio_power[n] * radius_ratio;
+
+  // Schmidt semi-normalized associated Legendre functions and their derivatives with respect to the colatitude
+  // Each degree depends only on the previous two degrees, so the inner loop over the order can be vectorized.
+  double legendre[(kMaxDegree + 1) * (kMaxDegree + 1)] = {};
+  double d_legendre[(kMaxDegree + 1) * (kMaxDegree + 1)] = {};
+  legendre[0] = 1.0;
+  for (size_t n = 1; n <= n_max; n++) {
+    double *p_n = &legendre[n * stride];
+    double *dp_n = &d_legendre[n * stride];
+    const double *p_n1 = &legendre[(n - 1) * stride];
+    const double *dp_n1 = &d_legendre[(n - 1) * stride];
+    const double *k1 = &legendre_coefficient_1_[n * stride];
+    if (n >= 2) {
+      const double *p_n2 = &legendre[(n - 2) * stride];
+      const double *dp_n2 = &d_legendre[(n - 2) * stride];
+      const double *k2 = &legendre_coefficient_2_[n * stride];
+      for (size_t m = 0; m < n; m++) {
+        p_n[m] = k1[m] * cos_theta * p_n1[m] - k2[m] * p_n2[m];
+        dp_n[m] = k1[m] * (cos_theta * dp_n1[m] - sin_theta * p_n1[m]) - k2[m] * dp_n2[m];
+      }
+    } else {
+      for (size_t m = 0; m < n; m++) {
+        p_n[m] = k1[m] * cos_theta * p_n1[m];
+        dp_n[m] = k1[m] * (cos_theta * dp_n1[m] - sin_theta * p_n1[m]);
       }
     }
-    line += n;
-    if (sscanf(line, "%lf%lf", &cb[i], &cv[i]) != 2) {
-      fprintf(stderr, "gigrf: Line-%d short\n", i + 3);
-      exit(1);
-    }
+    // Sectoral terms
+    const double k_sectoral = legendre_sectoral_coefficient_[n];
+    p_n[n] = k_sectoral * sin_theta * p_n1[n - 1];
+    dp_n[n] = k_sectoral * (cos_theta * p_n1[n - 1] + sin_theta * dp_n1[n - 1]);
   }
-  if (l == ncol)
-    tzero = yr2;
-  else {
-    tzero = yr1;
-    yr2 -= yr1;
-    for (i = 0; i < nlin; i++) cv[i] = (cv[i] - cb[i]) / yr2;
+
+  // Sine and cosine of the multiple longitude
+  double cos_m_phi[kMaxDegree + 1];
+  double sin_m_phi[kMaxDegree + 1];
+  const double cos_phi = cos(longitude_rad);
+  const double sin_phi = sin(longitude_rad);
+  cos_m_phi[0] = 1.0;
+  sin_m_phi[0] = 0.0;
+  for (size_t m = 0; m < n_max; m++) {
+    cos_m_phi[m + 1] = cos_m_phi[m] * cos_phi - sin_m_phi[m] * sin_phi;
+    sin_m_phi[m + 1] = sin_m_phi[m] * cos_phi + cos_m_phi[m] * sin_phi;
   }
-  k = 0;
-  for (i = 0, n = 1; n <= maxod; n++) {
-    vgh[0][n] = cb[i];
-    vght[0][n] = cv[i];
-    i++;
-    if ((cb[i] != 0.) || (cv[i] != 0.)) k = n;
-    for (m = 1; m <= n; m++) {
-      vgh[m][n] = cb[i];
-      vght[m][n] = cv[i];
-      i++;
-      if ((cb[i] != 0.) || (cv[i] != 0.)) k = n;
-      vgh[n][m - 1] = cb[i];
-      vght[n][m - 1] = cv[i];
-      i++;
-      if ((cb[i] != 0.) || (cv[i] != 0.)) k = n;
+
+  // Sum up
+  double x = 0.0, y = 0.0, z = 0.0;
+  for (size_t n = 1; n <= n_max; n++) {
+    const size_t head = n * stride;
+    double tx = 0.0, ty = 0.0, tz = 0.0;
+    for (size_t m = 0; m <= n; m++) {
+      const double g_cos_h_sin = g_nT[head + m] * cos_m_phi[m] + h_nT[head + m] * sin_m_phi[m];
+      const double g_sin_h_cos = g_nT[head + m] * sin_m_phi[m] - h_nT[head + m] * cos_m_phi[m];
+      tx += g_cos_h_sin * d_legendre[head + m];
+      ty += g_sin_h_cos * legendre[head + m] * (double)m;
+      tz += g_cos_h_sin * legendre[head + m];
     }
+    x += radius_ratio_power[n] * tx;
+    y += radius_ratio_power[n] * ty;
+    z -= radius_ratio_power[n] * tz * (n + 1);
   }
-  maxod = k;
-  // ジオイドに関わる定数?? field(double are, double aflat, double ara, int
-  //  maxoda)
-  field(6378.137, 298.25722, 6371.2, maxod);
-  tcoef(vgh, vght, tzero, 0, dmy);
-  tyear(year);
-}
+  y /= sin_theta;
 
-void igrfc(double fido, double fkeido, double hght, double *tf) {
-  double fx, fy, fz;
-  mfldg(fido, fkeido, hght / 1000., &fx, &fy, &fz, tf);
+  math::Vector<3> magnetic_field_ned_nT;
+  magnetic_field_ned_nT[0] = x;
+  magnetic_field_ned_nT[1] = y;
+  magnetic_field_ned_nT[2] = z;
+  return magnetic_field_ned_nT;
 }
 
-// 地磁気要素（地心表現）をECI座標へ
-int TransMagaxisToECI(const double *mag, double *pos, double lonrad, double thetarad, double gmst) {
-  RotationY(mag, pos, 180 * DEG2RAD - thetarad);
-  RotationZ(pos, pos, -lonrad);
-  RotationZ(pos, pos, -gmst);
-
-  return 0;
-}
-
-// IGRFの計算を実行するメインルーチン
-// Output	:	mag[3]	ECI座標での磁界の値[nT]
-void IgrfCalc(double decyear, double latrad, double lonrad, double alt, double side, double *mag) {
-  static bool first_flg = true;
-
-  if (first_flg == true) {
-    // gigrf(10,decyear);	//ファイル読み込み
-    // gigrf(11, decyear);
-    // gigrf(12, decyear);
-    gigrf(13, decyear);
-    first_flg = false;
-  }
-  tyear(decyear);  // 実行年の設定
-  igrfc(latrad * RAD2DEG, lonrad * RAD2DEG, alt,
-        &f);  // 実行位置の設定&Executeはこの中に含む
-
-  mag[0] = x;  // x,y,zはigrf.cppグローバル変数
-  mag[1] = y;
-  mag[2] = z;
-
-  // cout <<"mag_ned:["<< mag[0]<<","<<mag[1]<<","<<mag[2]<<"]\n";
-
-  double thetarad = acos(cth);  //[0<=theta<=pi?]
-
-  // cout << "Theta:"<< thetarad<<"\n";
-
-  testglobal[0] = mag[0];
-  testglobal[1] = mag[1];
-  testglobal[2] = mag[2];
-
-  TransMagaxisToECI(mag, mag, lonrad, thetarad, side);
-}
\ No newline at end of file
+}  // namespace s2e::geomagnetic
@@ -0,0 +1,131 @@
+/**
+ * @file igrf.hpp
+ * @brief IGRF (International Geomagnetic Reference Field) model
+ * @note The calculation algorithm is based on the code distributed at https://www.gsj.jp/data/openfile/no0423/index.html
+ */
+
+#ifndef S2E_LIBRARY_GEOMAGNETIC_IGRF_HPP_
+#define S2E_LIBRARY_GEOMAGNETIC_IGRF_HPP_
+
+#include <math_physics/geodesy/geodetic_position.hpp>
+#include <math_physics/math/vector.hpp>
+#include <string>
+#include <vector>
+
+namespace s2e::geomagnetic {
+
+/**
+ * @struct IgrfCoefficients
+ * @brief Gauss coefficients of the IGRF model interpolated to a specific time
+ * @note The secular variation is slow, so users can calculate this once and reuse it for many evaluations around the decimal year.
+ */
+struct IgrfCoefficients {
+  double decimal_year = 0.0;  //!< Decimal year of the coefficients [year]
+  size_t max_degree = 0;      //!< Maximum degree
+  std::vector<double> g_nT;   //!< Schmidt semi-normalized cosine coefficients stored as [n * (max_degree + 1) + m] [nT]
+  std::vector<double> h_nT;   //!< Schmidt semi-normalized sine coefficients stored as [n * (max_degree + 1) + m] [nT]
+};
+
+/**
+ * @class Igrf
+ * @brief IGRF model which owns its coefficient table
+ * @note Calculation functions are const and use only local buffers, so a single instance can be shared between spacecraft and threads.
+ */
+class Igrf {
+ public:
+  static const size_t kMaxDegree = 19;  //!< Maximum degree supported by the local calculation buffers
+
+  /**
+   * @fn Igrf
+   * @brief Constructor
+   * @param [in] coefficient_file_path: Path to the IGRF coefficient file (e.g. igrf13.coef)
+   */
+  explicit Igrf(const std::string coefficient_file_path);
+
+  /**
+   * @fn CalcMagneticField_i_nT
+   * @brief Calculate the magnetic field vector in the inertial frame
+   * @param [in] decimal_year: Decimal year [year]
+   * @param [in] position: Geodetic position of the target point
+   * @param [in] gmst_rad: Greenwich mean sidereal time [rad]
+   * @return Magnetic field vector in the inertial frame [nT]
+   */
+  math::Vector<3> CalcMagneticField_i_nT(const double decimal_year, const geodesy::GeodeticPosition &position, const double gmst_rad) const;
+  /**
+   * @fn CalcMagneticField_i_nT
+   * @brief Calculate the magnetic field vector in the inertial frame with pre-calculated coefficients
+   * @param [in] coefficients: Coefficients calculated by CalcCoefficients
+   * @param [in] position: Geodetic position of the target point
+   * @param [in] gmst_rad: Greenwich mean sidereal time [rad]
+   * @return Magnetic field vector in the inertial frame [nT]
+   */
+  math::Vector<3> CalcMagneticField_i_nT(const IgrfCoefficients &coefficients, const geodesy::GeodeticPosition &position,
+                                         const double gmst_rad) const;
+  /**
+   * @fn CalcCoefficients
+   * @brief Calculate the Gauss coefficients at the decimal year with the secular variation
+   * @param [in] decimal_year: Decimal year [year]
+   * @return Coefficients at the decimal year
+   */
+  IgrfCoefficients CalcCoefficients(const double decimal_year) const;
+
+  /**
+   * @fn GetFileReadSuccessFlag
+   * @brief Return true when the coefficient file is read correctly
+   */
+  inline bool GetFileReadSuccessFlag() const { return is_file_read_succeeded_; }
+  /**
+   * @fn GetMaxDegree
+   * @brief Return maximum degree of the model
+   */
+  inline size_t GetMaxDegree() const { return max_degree_; }
+
+ private:
+  bool is_file_read_succeeded_ = false;  //!< File read success flag
+  size_t max_degree_ = 0;                //!< Maximum degree of the model
+  std::vector<double> epochs_year_;      //!< Epochs of the coefficient table [year]
+  // Coefficients are stored as [epoch index][n * (max_degree_ + 1) + m]
+  std::vector<std::vector<double>> g_nT_;       //!< Cosine coefficients at each epoch [nT]
+  std::vector<std::vector<double>> h_nT_;       //!< Sine coefficients at each epoch [nT]
+  std::vector<std::vector<double>> g_rate_nT_;  //!< Rate of the cosine coefficients from each epoch [nT/year]
+  std::vector<std::vector<double>> h_rate_nT_;  //!< Rate of the sine coefficients from each epoch [nT/year]
+  // Recursion coefficients of the Schmidt semi-normalized associated Legendre functions stored as [n * (max_degree_ + 1) + m]
+  std::vector<double> legendre_coefficient_1_;         //!< (2n - 1) / sqrt(n^2 - m^2)
+  std::vector<double> legendre_coefficient_2_;         //!< sqrt((n - 1)^2 - m^2) / sqrt(n^2 - m^2)
+  std::vector<double> legendre_sectoral_coefficient_;  //!< sqrt((2n - 1) / 2n) for the sectoral (n = m) terms, stored as [n]
+
+  /**
+   * @fn ReadFile
+   * @brief Read the coefficient file
+   * @param [in] file_path: Path to the coefficient file
+   * @return true when the file is read correctly
+   */
+  bool ReadFile(const std::string file_path);
+  /**
+   * @fn CalcEpochIndex
+   * @brief Return the index of the epoch used as the base of the time interpolation
+   * @param [in] decimal_year: Decimal year [year]
+   */
+  size_t CalcEpochIndex(const double decimal_year) const;
+  /**
+   * @fn InitializeLegendreCoefficients
+   * @brief Initialize the recursion coefficients of the associated Legendre functions
+   */
+  void InitializeLegendreCoefficients();
+  /**
+   * @fn CalcMagneticFieldSpherical_nT
+   * @brief Calculate the magnetic field vector in the local geocentric North-East-Down frame
+   * @param [in] coefficients: Coefficients calculated by CalcCoefficients
+   * @param [in] radius_km: Geocentric radius [km]
+   * @param [in] cos_theta: Cosine of the geocentric colatitude
+   * @param [in] sin_theta: Sine of the geocentric colatitude
+   * @param [in] longitude_rad: Longitude [rad]
+   * @return Magnetic field vector in the local geocentric North-East-Down frame [nT]
+   */
+  math::Vector<3> CalcMagneticFieldSpherical_nT(const IgrfCoefficients &coefficients, const double radius_km, const double cos_theta,
+                                                const double sin_theta, const double longitude_rad) const;
+};
+
+}  // namespace s2e::geomagnetic
+
+#endif  // S2E_LIBRARY_GEOMAGNETIC_IGRF_HPP_
@@ -0,0 +1,110 @@
+/**
+ * @file test_igrf.cpp
+ * @brief Test codes for Igrf class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include "igrf.hpp"
+
+using namespace s2e::geomagnetic;
+
+/**
+ * @brief Test Constructor
+ */
+TEST(Igrf, Constructor) {
+  std::string test_file_name = "/settings/environment/magnetic_field/igrf13.coef";
+  Igrf igrf(CORE_DIR_FROM_EXE + test_file_name);
+
+  EXPECT_TRUE(igrf.GetFileReadSuccessFlag());
+  EXPECT_EQ(13, igrf.GetMaxDegree());
+}
+
+/**
+ * @brief Test Constructor with wrong file
+ */
+TEST(Igrf, ConstructorWithWrongFile) {
+  Igrf igrf("false_file_path.coef");
+
+  EXPECT_FALSE(igrf.GetFileReadSuccessFlag());
+  s2e::math::Vector<3> magnetic_field_i_nT = igrf.CalcMagneticField_i_nT(2020.0, s2e::geodesy::GeodeticPosition(0.0, 0.0, 500e3), 0.0);
+  for (size_t i = 0; i < 3; i++) {
+    EXPECT_DOUBLE_EQ(0.0, magnetic_field_i_nT[i]);
+  }
+}
+
+/**
+ * @brief Test magnetic field calculation
+ */
+TEST(Igrf, CalcMagneticField) {
+  std::string test_file_name = "/settings/environment/magnetic_field/igrf13.coef";
+  const Igrf igrf(CORE_DIR_FROM_EXE + test_file_name);
+  const double accuracy_nT = 1e-6;
+
+  // Reference values are calculated with the original IGRF code
+  s2e::math::Vector<3> magnetic_field_i_nT = igrf.CalcMagneticField_i_nT(2020.5, s2e::geodesy::GeodeticPosition(0.0, 0.0, 500e3), 0.0);
+  EXPECT_NEAR(10838.1277356701, magnetic_field_i_nT[0], accuracy_nT);
+  EXPECT_NEAR(-1896.6152023094, magnetic_field_i_nT[1], accuracy_nT);
+  EXPECT_NEAR(21610.2599238855, magnetic_field_i_nT[2], accuracy_nT);
+
+  magnetic_field_i_nT = igrf.CalcMagneticField_i_nT(2022.3, s2e::geodesy::GeodeticPosition(0.6, -1.2, 700e3), 1.0);
+  EXPECT_NEAR(-33481.8237431129, magnetic_field_i_nT[0], accuracy_nT);
+  EXPECT_NEAR(3141.2913563104, magnetic_field_i_nT[1], accuracy_nT);
+  EXPECT_NEAR(-2635.2021836085, magnetic_field_i_nT[2], accuracy_nT);
+
+  magnetic_field_i_nT = igrf.CalcMagneticField_i_nT(2021.0, s2e::geodesy::GeodeticPosition(-1.2, 2.5, 400e3), 3.5);
+  EXPECT_NEAR(17098.9119187761, magnetic_field_i_nT[0], accuracy_nT);
+  EXPECT_NEAR(-3589.7406366178, magnetic_field_i_nT[1], accuracy_nT);
+  EXPECT_NEAR(-51093.4698164034, magnetic_field_i_nT[2], accuracy_nT);
+
+  magnetic_field_i_nT = igrf.CalcMagneticField_i_nT(2023.9, s2e::geodesy::GeodeticPosition(1.1, 0.3, 10e3), 5.0);
+  EXPECT_NEAR(-17798.0406742306, magnetic_field_i_nT[0], accuracy_nT);
+  EXPECT_NEAR(30060.2009433623, magnetic_field_i_nT[1], accuracy_nT);
+  EXPECT_NEAR(-38872.6292212062, magnetic_field_i_nT[2], accuracy_nT);
+
+  // Interpolation between epochs
+  magnetic_field_i_nT = igrf.CalcMagneticField_i_nT(2016.2, s2e::geodesy::GeodeticPosition(-0.4, -2.9, 600e3), 2.0);
+  EXPECT_NEAR(22281.7235741908, magnetic_field_i_nT[0], accuracy_nT);
+  EXPECT_NEAR(-18878.9344480231, magnetic_field_i_nT[1], accuracy_nT);
+  EXPECT_NEAR(12120.6156903566, magnetic_field_i_nT[2], accuracy_nT);
+}
+
+/**
+ * @brief Test magnetic field calculation with pre-calculated coefficients
+ */
+TEST(Igrf, CalcMagneticFieldWithCoefficients) {
+  std::string test_file_name = "/settings/environment/magnetic_field/igrf13.coef";
+  const Igrf igrf(CORE_DIR_FROM_EXE + test_file_name);
+
+  const IgrfCoefficients coefficients = igrf.CalcCoefficients(2022.3);
+  EXPECT_DOUBLE_EQ(2022.3, coefficients.decimal_year);
+  EXPECT_EQ(igrf.GetMaxDegree(), coefficients.max_degree);
+
+  const s2e::geodesy::GeodeticPosition position(0.6, -1.2, 700e3);
+  const s2e::math::Vector<3> expected_nT = igrf.CalcMagneticField_i_nT(2022.3, position, 1.0);
+  const s2e::math::Vector<3> magnetic_field_i_nT = igrf.CalcMagneticField_i_nT(coefficients, position, 1.0);
+  for (size_t i = 0; i < 3; i++) {
+    EXPECT_DOUBLE_EQ(expected_nT[i], magnetic_field_i_nT[i]);
+  }
+
+  // Inconsistent coefficients
+  const IgrfCoefficients empty_coefficients;
+  const s2e::math::Vector<3> zero_nT = igrf.CalcMagneticField_i_nT(empty_coefficients, position, 1.0);
+  for (size_t i = 0; i < 3; i++) {
+    EXPECT_DOUBLE_EQ(0.0, zero_nT[i]);
+  }
+}
+
+/**
+ * @brief Test continuity of the magnetic field near the pole
+ */
+TEST(Igrf, CalcMagneticFieldNearPole) {
+  std::string test_file_name = "/settings/environment/magnetic_field/igrf13.coef";
+  const Igrf igrf(CORE_DIR_FROM_EXE + test_file_name);
+  const double accuracy_nT = 1e-6;
+
+  const s2e::math::Vector<3> magnetic_field_i_nT = igrf.CalcMagneticField_i_nT(2020.5, s2e::geodesy::GeodeticPosition(1.5, 0.2, 500e3), 0.0);
+  const s2e::math::Vector<3> shifted_i_nT = igrf.CalcMagneticField_i_nT(2020.5, s2e::geodesy::GeodeticPosition(1.5 + 1e-12, 0.2, 500e3), 0.0);
+  for (size_t i = 0; i < 3; i++) {
+    EXPECT_NEAR(magnetic_field_i_nT[i], shifted_i_nT[i], accuracy_nT);
+  }
+}
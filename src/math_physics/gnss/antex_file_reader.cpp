@@ -6,6 +6,7 @@
 
 #include "antex_file_reader.hpp"
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <math_physics/gnss/gnss_satellite_number.hpp>
@@ -33,7 +34,7 @@ AntexGridDefinition::AntexGridDefinition(const double zenith_start_angle_deg, co
   }
 }
 
-size_t AntexGridDefinition::CalcClosestZenithIndex(const double zenith_angle_deg) {
+size_t AntexGridDefinition::CalcClosestZenithIndex(const double zenith_angle_deg) const {
   if (zenith_angle_deg <= zenith_start_angle_deg_) {
     return 0;
   } else if (zenith_angle_deg >= zenith_end_angle_deg_) {
@@ -45,7 +46,7 @@ size_t AntexGridDefinition::CalcClosestZenithIndex(const double zenith_angle_deg
   }
 }
 
-size_t AntexGridDefinition::CalcClosestAzimuthIndex(const double azimuth_angle_deg) {
+size_t AntexGridDefinition::CalcClosestAzimuthIndex(const double azimuth_angle_deg) const {
   if (azimuth_angle_deg <= 0.0) {
     return 0;
   } else if (azimuth_angle_deg >= 360.0) {
@@ -56,6 +57,35 @@ size_t AntexGridDefinition::CalcClosestAzimuthIndex(const double azimuth_angle_d
   }
 }
 
+double AntexPhaseCenterData::CalcPhaseCenterVariation_mm(const double zenith_angle_deg) const {
+  if (phase_center_variation_matrix_mm_.empty()) return 0.0;
+  const std::vector<double>& variation_mm = phase_center_variation_matrix_mm_[0];
+  const size_t number_of_grid = std::min(grid_information_.GetNumberOfZenithGrid(), variation_mm.size());
+  if (number_of_grid == 0) return 0.0;
+
+  const double step_deg = grid_information_.GetZenithStepAngle_deg();
+  const double position = (zenith_angle_deg - grid_information_.GetZenithStartAngle_deg()) / step_deg;
+  if (position <= 0.0) return variation_mm[0];
+  if (position >= (double)(number_of_grid - 1)) return variation_mm[number_of_grid - 1];
+
+  const size_t lower_index = (size_t)position;
+  const double ratio = position - (double)lower_index;
+  return (1.0 - ratio) * variation_mm[lower_index] + ratio * variation_mm[lower_index + 1];
+}
+
+const AntexSatelliteData* AntexFileReader::SearchAntexSatelliteData(const size_t satellite_index, const time_system::EpochTime& time) const {
+  if (satellite_index >= antex_satellite_data_.size()) return nullptr;
+  const std::vector<AntexSatelliteData>& data_list = antex_satellite_data_[satellite_index];
+
+  // The last data which starts before the target time
+  auto is_before_start = [](const time_system::EpochTime& target, const AntexSatelliteData& data) { return target < data.GetValidStartEpochTime(); };
+  const auto upper = std::upper_bound(data_list.begin(), data_list.end(), time, is_before_start);
+  if (upper == data_list.begin()) return nullptr;
+  const AntexSatelliteData& data = *(upper - 1);
+  if (!data.IsValid(time)) return nullptr;
+  return &data;
+}
+
 bool AntexFileReader::ReadFile(const std::string file_name) {
   // File open
   std::ifstream antex_file(file_name);
@@ -64,6 +94,7 @@ bool AntexFileReader::ReadFile(const std::string file_name) {
     return false;
   }
 
+  antex_satellite_data_.assign(kTotalNumberOfGnssSatellite, std::vector<AntexSatelliteData>());
   while (antex_file.peek() != EOF) {
     std::string line;
     std::getline(antex_file, line);
@@ -81,6 +112,13 @@ bool AntexFileReader::ReadFile(const std::string file_name) {
     }
   }
 
+  // Sort by the valid start time for the binary search
+  for (auto& data_list : antex_satellite_data_) {
+    std::stable_sort(data_list.begin(), data_list.end(), [](const AntexSatelliteData& left, const AntexSatelliteData& right) {
+      return left.GetValidStartEpochTime() < right.GetValidStartEpochTime();
+    });
+  }
+
   // Read epoch wise data
   antex_file.close();
   return true;
@@ -99,7 +137,7 @@ void AntexFileReader::ReadAntexData(std::ifstream& antex_file) {
       std::string serial_number = line.substr(20, 20);
       size_t satellite_index = ConvertGnssSatelliteNumberToIndex(serial_number);
 
-      if (satellite_index == UINT32_MAX) {
+      if (satellite_index >= kTotalNumberOfGnssSatellite) {
         // receiver
         // TODO: implement
       } else {
@@ -108,6 +146,7 @@ void AntexFileReader::ReadAntexData(std::ifstream& antex_file) {
         antex_satellite_data = ReadAntexSatelliteData(antex_file);
         antex_satellite_data.SetAntennaType(antenna_type);
         antex_satellite_data.SetSerialNumber(serial_number);
+        if (antex_satellite_data_[satellite_index].empty()) number_of_satellite_data_++;
         antex_satellite_data_[satellite_index].push_back(antex_satellite_data);
       }
       break;
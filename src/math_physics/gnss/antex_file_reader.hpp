@@ -10,9 +10,9 @@
 
 #include <stdint.h>
 
-#include <map>
 #include <math_physics/math/vector.hpp>
 #include <math_physics/time_system/date_time_format.hpp>
+#include <math_physics/time_system/epoch_time.hpp>
 #include <string>
 #include <vector>
 
@@ -46,14 +46,14 @@ class AntexGridDefinition {
    * @param [in] zenith_angle_deg: Zenith angle [deg]
    * @return The closest grid index
    */
-  size_t CalcClosestZenithIndex(const double zenith_angle_deg);
+  size_t CalcClosestZenithIndex(const double zenith_angle_deg) const;
   /**
    * @fn CalcClosestAzimuthIndex
    * @brief Calculate the closest azimuth grid index
    * @param [in] azimuth_angle_deg: Azimuth angle [deg]
    * @return The closest grid index
    */
-  size_t CalcClosestAzimuthIndex(const double azimuth_angle_deg);
+  size_t CalcClosestAzimuthIndex(const double azimuth_angle_deg) const;
 
   // Getter
   /**
@@ -116,7 +116,15 @@ class AntexPhaseCenterData {
    */
   ~AntexPhaseCenterData() {}
 
-  // TODO: Implement phase center variation calculation from the matrix
+  /**
+   * @fn CalcPhaseCenterVariation_mm
+   * @brief Calculate phase center variation with linear interpolation of the zenith grid
+   * @note The grid index is directly calculated from the grid definition without searching.
+   *       TODO: Support azimuth dependent data (DAZI). The azimuth independent data (NOAZI) is used now.
+   * @param [in] zenith_angle_deg: Zenith angle [deg]
+   * @return Phase center variation [mm]
+   */
+  double CalcPhaseCenterVariation_mm(const double zenith_angle_deg) const;
 
   // Setter
   /**
@@ -152,17 +160,17 @@ class AntexPhaseCenterData {
    * @fn GetPhaseCenterOffset_mm
    * @return Phase center offset vector [mm]
    */
-  inline math::Vector<3> GetPhaseCenterOffset_mm() const { return phase_center_offset_mm_; }
+  inline const math::Vector<3>& GetPhaseCenterOffset_mm() const { return phase_center_offset_mm_; }
   /**
    * @fn GetGridInformation
    * @return Grid information
    */
-  inline AntexGridDefinition GetGridInformation() const { return grid_information_; }
+  inline const AntexGridDefinition& GetGridInformation() const { return grid_information_; }
   /**
    * @fn GetPhaseCenterVariationMatrix_mm
    * @return Phase center variation matrix [mm] (column, row definition: [azimuth][zenith])
    */
-  inline std::vector<std::vector<double>> GetPhaseCenterVariationMatrix_mm() const { return phase_center_variation_matrix_mm_; }
+  inline const std::vector<std::vector<double>>& GetPhaseCenterVariationMatrix_mm() const { return phase_center_variation_matrix_mm_; }
 
  private:
   std::string frequency_name_ = "";                                    //!< Frequency name
@@ -203,12 +211,19 @@ class AntexSatelliteData {
    * @fn SetValidStartTime
    * @param[in] valid_start_time: Valid start time
    */
-  inline void SetValidStartTime(const time_system::DateTime valid_start_time) { valid_start_time_ = valid_start_time; };
+  inline void SetValidStartTime(const time_system::DateTime valid_start_time) {
+    valid_start_time_ = valid_start_time;
+    valid_start_epoch_time_ = time_system::EpochTime(valid_start_time);
+  };
   /**
    * @fn SetValidEndTime
    * @param[in] valid_end_time: Valid end time
    */
-  inline void SetValidEndTime(const time_system::DateTime valid_end_time) { valid_end_time_ = valid_end_time; };
+  inline void SetValidEndTime(const time_system::DateTime valid_end_time) {
+    valid_end_time_ = valid_end_time;
+    valid_end_epoch_time_ = time_system::EpochTime(valid_end_time);
+    has_valid_end_time_ = true;
+  };
   /**
    * @fn SetNumberOfFrequency
    * @param[in] number_of_frequency: Number of frequency
@@ -241,6 +256,19 @@ class AntexSatelliteData {
    * @return Valid end time
    */
   inline time_system::DateTime GetValidEndTime() const { return valid_end_time_; };
+  /**
+   * @fn GetValidStartEpochTime
+   * @return Valid start time as epoch time
+   */
+  inline const time_system::EpochTime& GetValidStartEpochTime() const { return valid_start_epoch_time_; };
+  /**
+   * @fn IsValid
+   * @param[in] time: Target time
+   * @return true: the data is valid at the time
+   */
+  inline bool IsValid(const time_system::EpochTime& time) const {
+    return valid_start_epoch_time_ <= time && (!has_valid_end_time_ || time <= valid_end_epoch_time_);
+  };
   /**
    * @fn GetNumberOfFrequency
    * @return Number of frequency
@@ -251,13 +279,16 @@ class AntexSatelliteData {
    * @param[in] frequency_index: Frequency index start from 0
    * @return Antenna phase center data
    */
-  inline AntexPhaseCenterData GetPhaseCenterData(const size_t frequency_index) const { return phase_center_data_[frequency_index]; };
+  inline const AntexPhaseCenterData& GetPhaseCenterData(const size_t frequency_index) const { return phase_center_data_[frequency_index]; };
 
  private:
   std::string antenna_type_;                             //!< Antenna type
   std::string serial_number_;                            //!< Serial number or satellite code
   time_system::DateTime valid_start_time_;               //!< Valid start time
   time_system::DateTime valid_end_time_;                 //!< Valid end time (The latest data does not have the end time)
+  time_system::EpochTime valid_start_epoch_time_;        //!< Valid start time as epoch time for the search
+  time_system::EpochTime valid_end_epoch_time_;          //!< Valid end time as epoch time for the search
+  bool has_valid_end_time_ = false;                      //!< Flag to show the valid end time is defined
   size_t number_of_frequency_ = 1;                       //!< Number of frequency
   std::vector<AntexPhaseCenterData> phase_center_data_;  //!< Phase center data for each frequency
 };
@@ -292,19 +323,28 @@ class AntexFileReader {
    * @fn GetNumberOfSatelliteData
    * @return Number of GNSS satellites in read data
    */
-  inline size_t GetNumberOfSatelliteData() const { return antex_satellite_data_.size(); }
+  inline size_t GetNumberOfSatelliteData() const { return number_of_satellite_data_; }
   /**
    * @fn GetAntexSatelliteData
    * @param[in] satellite_index: GNSS satellite index used in S2E
-   * @return ANTEX data list for the GNSS satellite (including several valid time data)
+   * @return ANTEX data list for the GNSS satellite (including several valid time data sorted by the valid start time)
    */
-  inline std::vector<AntexSatelliteData> GetAntexSatelliteData(const size_t satellite_index) const {
+  inline const std::vector<AntexSatelliteData>& GetAntexSatelliteData(const size_t satellite_index) const {
     return antex_satellite_data_.at(satellite_index);
   };
+  /**
+   * @fn SearchAntexSatelliteData
+   * @brief Search the ANTEX data valid at the time with binary search of the valid start time
+   * @param[in] satellite_index: GNSS satellite index used in S2E
+   * @param[in] time: Target time
+   * @return ANTEX data valid at the time, or nullptr when no data is valid
+   */
+  const AntexSatelliteData* SearchAntexSatelliteData(const size_t satellite_index, const time_system::EpochTime& time) const;
 
  private:
-  bool is_file_read_succeeded_;                                             //!< File read success flag
-  std::map<size_t, std::vector<AntexSatelliteData>> antex_satellite_data_;  //!< ANTEX data list for GNSS satellite
+  bool is_file_read_succeeded_;                                        //!< File read success flag
+  size_t number_of_satellite_data_ = 0;                                //!< Number of GNSS satellites in read data
+  std::vector<std::vector<AntexSatelliteData>> antex_satellite_data_;  //!< ANTEX data list indexed by GNSS satellite index
   // TODO: Implement data for Receivers
 
   /**
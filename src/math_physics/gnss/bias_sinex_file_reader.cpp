@@ -3,14 +3,23 @@
  * @brief Read bias SINEX format file
  * @note Ref. https://files.igs.org/pub/data/format/sinex_bias_100.pdf
  */
+#define _CRT_SECURE_NO_WARNINGS  // for sscanf
 
 #include "bias_sinex_file_reader.hpp"
 
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
 #include <fstream>
 #include <iostream>
+#include <math_physics/gnss/gnss_satellite_number.hpp>
+#include <math_physics/time_system/date_time_format.hpp>
 
 namespace s2e::gnss {
 
+static const size_t kNumberOfBiasIdentifier = static_cast<size_t>(BiasIdentifier::kError) + 1;      //!< Number of bias identifiers
+static const size_t kNumberOfBiasTargetSignal = static_cast<size_t>(BiasTargetSignal::kError) + 1;  //!< Number of bias target signals
+
 bool BiasSinexFileReader::ReadFile(const std::string file_name) {
   // File open
   std::ifstream bias_sinex_file(file_name);
@@ -67,11 +76,52 @@ bool BiasSinexFileReader::ReadFile(const std::string file_name) {
     }
   }
 
+  MakeSatelliteBiasTable();
+
   // Read epoch wise data
   bias_sinex_file.close();
   return true;
 }
 
+size_t BiasSinexFileReader::CalcTableIndex(const size_t satellite_index, const BiasIdentifier identifier, const BiasTargetSignal target_signal) {
+  return (satellite_index * kNumberOfBiasIdentifier + static_cast<size_t>(identifier)) * kNumberOfBiasTargetSignal +
+         static_cast<size_t>(target_signal);
+}
+
+void BiasSinexFileReader::MakeSatelliteBiasTable() {
+  satellite_bias_table_.assign(kTotalNumberOfGnssSatellite * kNumberOfBiasIdentifier * kNumberOfBiasTargetSignal, std::vector<size_t>());
+  for (size_t i = 0; i < solution_data_.size(); i++) {
+    const BiasSolutionData& solution_data = solution_data_[i];
+    if (!solution_data.IsSatelliteBias() || solution_data.GetSatelliteIndex() >= kTotalNumberOfGnssSatellite) continue;
+    const size_t table_index = CalcTableIndex(solution_data.GetSatelliteIndex(), solution_data.GetIdentifier(), solution_data.GetTargetSignal());
+    satellite_bias_table_[table_index].push_back(i);
+  }
+
+  // Sort by the valid start time for the binary search
+  for (auto& indices : satellite_bias_table_) {
+    std::stable_sort(indices.begin(), indices.end(), [this](const size_t left, const size_t right) {
+      return solution_data_[left].GetValidStartTime() < solution_data_[right].GetValidStartTime();
+    });
+  }
+}
+
+const BiasSolutionData* BiasSinexFileReader::SearchSatelliteBias(const size_t satellite_index, const BiasIdentifier identifier,
+                                                                 const BiasTargetSignal target_signal, const time_system::EpochTime& time) const {
+  // The table is not made when the file read failed
+  if (satellite_index >= kTotalNumberOfGnssSatellite || satellite_bias_table_.empty()) return nullptr;
+  const std::vector<size_t>& indices = satellite_bias_table_[CalcTableIndex(satellite_index, identifier, target_signal)];
+
+  // The last data which starts before the target time
+  auto is_before_start = [this](const time_system::EpochTime& target, const size_t index) {
+    return target < solution_data_[index].GetValidStartTime();
+  };
+  const auto upper = std::upper_bound(indices.begin(), indices.end(), time, is_before_start);
+  if (upper == indices.begin()) return nullptr;
+  const BiasSolutionData& solution_data = solution_data_[*(upper - 1)];
+  if (time > solution_data.GetValidEndTime()) return nullptr;
+  return &solution_data;
+}
+
 void BiasSinexFileReader::ReadFileReference(std::ifstream& bias_sinex_file) {
   std::string line;
   while (1) {
@@ -180,6 +230,7 @@ void BiasSinexFileReader::ReadBiasSolution(std::ifstream& bias_sinex_file) {
     read_size = 14;
     std::string end_time = line.substr(read_point, read_size);
     read_point += read_size + 1;
+    solution_data.SetValidTime(start_time, end_time);
 
     read_size = 4;
     solution_data.SetUnit(line.substr(read_point, read_size));
@@ -220,6 +271,28 @@ void BiasSolutionData::SetIdentifier(const std::string identifier) {
   }
 }
 
+void BiasSolutionData::SetSatelliteNumber(const std::string satellite_number) {
+  satellite_number_ = satellite_number;
+  // System-wide data has only the system character (e.g. "G  ")
+  if (satellite_number.size() == 3 && isdigit(satellite_number[1]) && isdigit(satellite_number[2])) {
+    satellite_index_ = ConvertGnssSatelliteNumberToIndex(satellite_number);
+  } else {
+    satellite_index_ = UINT32_MAX;
+  }
+}
+
+void BiasSolutionData::SetValidTime(const std::string start_time, const std::string end_time) {
+  // Time format is YYYY:DOY:SSSSS. 0000:000:00000 means the time is not defined.
+  auto convert_time = [](const std::string time, const time_system::EpochTime undefined_time) {
+    size_t year = 0, day_of_year = 0, second_of_day = 0;
+    if (sscanf(time.c_str(), "%zu:%zu:%zu", &year, &day_of_year, &second_of_day) != 3 || year == 0) return undefined_time;
+    const time_system::EpochTime start_of_year(time_system::DateTime(year, 1, 1, 0, 0, 0.0));
+    return start_of_year + time_system::EpochTime((day_of_year - 1) * 86400 + second_of_day, 0.0);
+  };
+  valid_start_time_ = convert_time(start_time, time_system::EpochTime(0, 0.0));
+  valid_end_time_ = convert_time(end_time, time_system::EpochTime(UINT64_MAX, 0.0));
+}
+
 void BiasSolutionData::SetUnit(const std::string unit) {
   if (unit == "ns  ") {
     unit_ = BiasUnit::kNs;
@@ -7,6 +7,9 @@
 #ifndef S2E_LIBRARY_BIAS_SINEX_FILE_READER_HPP_
 #define S2E_LIBRARY_BIAS_SINEX_FILE_READER_HPP_
 
+#include <stdint.h>
+
+#include <math_physics/time_system/epoch_time.hpp>
 #include <string>
 #include <vector>
 
@@ -62,12 +65,10 @@ class BiasSolutionData {
   // Setters
   void SetIdentifier(const std::string identifier);
   inline void SetSatelliteSvnCode(const std::string satellite_svn_code) { satellite_svn_code_ = satellite_svn_code; }
-  inline void SetSatelliteNumber(const std::string satellite_number) {
-    satellite_number_ = satellite_number;
-    // satellite_index_ = ConvertSatelliteNumberToIndex(satellite_number);
-  }
+  void SetSatelliteNumber(const std::string satellite_number);
   inline void SetStationName(const std::string station_name) { station_name_ = station_name; }
   void SetTargetSignal(const std::string signal1, const std::string signal2);
+  void SetValidTime(const std::string start_time, const std::string end_time);
   void SetUnit(const std::string unit);
   inline void SetBias(const double bias) { bias_ = bias; }
   inline void SetBiasStandardDeviation(const double bias_standard_deviation) { bias_standard_deviation_ = bias_standard_deviation; }
@@ -77,22 +78,33 @@ class BiasSolutionData {
   }
 
   // Getters
-  inline BiasIdentifier GetIdentifier() { return identifier_; }
-  inline std::string GetSatelliteSvnCode() { return satellite_svn_code_; }
-  inline std::string GetStationName() { return station_name_; }
-  inline BiasTargetSignal GetTargetSignal() { return target_signal_; }
-  inline BiasUnit GetUnit() { return unit_; }
-  inline double GetBias() { return bias_; }
-  inline double GetBiasStandardDeviation() { return bias_standard_deviation_; }
-  inline double GetSlope() { return slope_ns_s_; }
-  inline double GetSlopeStandardDeviation() { return slope_standard_deviation_ns_s_; }
+  inline BiasIdentifier GetIdentifier() const { return identifier_; }
+  inline std::string GetSatelliteSvnCode() const { return satellite_svn_code_; }
+  inline size_t GetSatelliteIndex() const { return satellite_index_; }
+  inline std::string GetStationName() const { return station_name_; }
+  inline BiasTargetSignal GetTargetSignal() const { return target_signal_; }
+  inline const time_system::EpochTime& GetValidStartTime() const { return valid_start_time_; }
+  inline const time_system::EpochTime& GetValidEndTime() const { return valid_end_time_; }
+  inline BiasUnit GetUnit() const { return unit_; }
+  inline double GetBias() const { return bias_; }
+  inline double GetBiasStandardDeviation() const { return bias_standard_deviation_; }
+  inline double GetSlope() const { return slope_ns_s_; }
+  inline double GetSlopeStandardDeviation() const { return slope_standard_deviation_ns_s_; }
+  /**
+   * @fn IsSatelliteBias
+   * @return true: the bias is defined for a satellite without station
+   */
+  inline bool IsSatelliteBias() const { return satellite_index_ != UINT32_MAX && station_name_.find_first_not_of(' ') == std::string::npos; }
 
  private:
   BiasIdentifier identifier_ = BiasIdentifier::kError;         //!< Bias identifier
   std::string satellite_svn_code_ = "";                        //!< Satellite SVN code
   std::string satellite_number_ = "";                          //!< Satellite number
+  size_t satellite_index_ = UINT32_MAX;                        //!< GNSS satellite index used in S2E (UINT32_MAX for system or station data)
   std::string station_name_ = "";                              //!< Station name
   BiasTargetSignal target_signal_ = BiasTargetSignal::kError;  //!< Target signal for the bias information
+  time_system::EpochTime valid_start_time_;                    //!< Valid start time
+  time_system::EpochTime valid_end_time_;                      //!< Valid end time
   BiasUnit unit_ = BiasUnit::kError;                           //!< Unit information
   double bias_ = 0.0;                                          //!< Bias [unit is defined by the unit information]
   double bias_standard_deviation_ = 0.0;                       //!< Standard deviation of bias [unit is defined by the unit information
@@ -130,15 +142,43 @@ class BiasSinexFileReader {
    */
   inline size_t GetNumberOfBiasData() const { return solution_data_.size(); }
   /**
-   * @fn GetFileReadSuccessFlag
+   * @fn GetBiasData
    * @param[in] index: Index of bias solution data
-   * @return File read success flag
+   * @return Bias solution data
    */
-  inline BiasSolutionData GetBiasData(const size_t index) const { return solution_data_[index]; }
+  inline const BiasSolutionData& GetBiasData(const size_t index) const { return solution_data_[index]; }
+  /**
+   * @fn SearchSatelliteBias
+   * @brief Search the satellite bias valid at the time with the satellite bias table
+   * @param[in] satellite_index: GNSS satellite index used in S2E
+   * @param[in] identifier: Bias identifier
+   * @param[in] target_signal: Target signal
+   * @param[in] time: Target time
+   * @return Bias solution data valid at the time, or nullptr when no data is valid
+   */
+  const BiasSolutionData* SearchSatelliteBias(const size_t satellite_index, const BiasIdentifier identifier, const BiasTargetSignal target_signal,
+                                              const time_system::EpochTime& time) const;
 
  private:
   bool is_file_read_succeeded_;                  //!< File read success flag
   std::vector<BiasSolutionData> solution_data_;  //!< List of solution data
+  //! Indices of the solution data for satellites without station sorted by the valid start time. The table is indexed by CalcTableIndex.
+  std::vector<std::vector<size_t>> satellite_bias_table_;
+
+  /**
+   * @fn CalcTableIndex
+   * @brief Calculate the index of the satellite bias table
+   * @param[in] satellite_index: GNSS satellite index used in S2E
+   * @param[in] identifier: Bias identifier
+   * @param[in] target_signal: Target signal
+   * @return Index of the satellite bias table
+   */
+  static size_t CalcTableIndex(const size_t satellite_index, const BiasIdentifier identifier, const BiasTargetSignal target_signal);
+  /**
+   * @fn MakeSatelliteBiasTable
+   * @brief Make the satellite bias table from the solution data
+   */
+  void MakeSatelliteBiasTable();
 
   /**
    * @fn ReadFile
@@ -0,0 +1,81 @@
+/**
+ * @file gnss_observation_geometry.cpp
+ * @brief Geometry and pseudorange between a GNSS receiver antenna and all GNSS satellites calculated in batch
+ */
+
+#include "gnss_observation_geometry.hpp"
+
+#include <cmath>
+#include <environment/global/physical_constants.hpp>
+
+namespace s2e::gnss {
+
+void GnssObservationGeometry::Update(const math::Vector<3>& antenna_position_m, const std::vector<math::Vector<3>>& satellite_positions_m,
+                                     const std::vector<math::Vector<3>>& satellite_velocities_m_s,
+                                     const std::vector<double>& satellite_clock_offsets_s, const double receiver_clock_offset_s) {
+  const size_t number_of_satellites = satellite_positions_m.size();
+  antenna_position_m_ = antenna_position_m;
+  line_of_sights_m_.resize(number_of_satellites);
+  geometric_distances_m_.resize(number_of_satellites);
+  ranges_m_.resize(number_of_satellites);
+  pseudoranges_m_.resize(number_of_satellites);
+  is_visible_.assign(number_of_satellites, 0);
+
+  // Line of sight at the reception time
+  for (size_t i = 0; i < number_of_satellites; i++) {
+    line_of_sights_m_[i] = satellite_positions_m[i] - antenna_position_m;
+    geometric_distances_m_[i] = line_of_sights_m_[i].CalcNorm();
+    ranges_m_[i] = geometric_distances_m_[i];
+  }
+
+  // Light time correction: the satellite moves back to the transmission time. One iteration is enough for the GNSS satellite velocity.
+  // The line of sight is kept at the reception time for the visibility and the direction, and only the range is corrected.
+  if (satellite_velocities_m_s.size() == number_of_satellites) {
+    for (size_t i = 0; i < number_of_satellites; i++) {
+      const double light_time_s = geometric_distances_m_[i] / environment::speed_of_light_m_s;
+      math::Vector<3> corrected_line_of_sight_m = line_of_sights_m_[i];
+      for (size_t axis = 0; axis < 3; axis++) {
+        corrected_line_of_sight_m[axis] -= satellite_velocities_m_s[i][axis] * light_time_s;
+      }
+      ranges_m_[i] = corrected_line_of_sight_m.CalcNorm();
+    }
+  }
+
+  // Pseudorange
+  for (size_t i = 0; i < number_of_satellites; i++) {
+    const double satellite_clock_offset_s = i < satellite_clock_offsets_s.size() ? satellite_clock_offsets_s[i] : 0.0;
+    pseudoranges_m_[i] = ranges_m_[i] + environment::speed_of_light_m_s * (receiver_clock_offset_s - satellite_clock_offset_s);
+  }
+}
+
+size_t GnssObservationGeometry::CalcVisibility(const double earth_radius_m, const math::Vector<3>& antenna_direction, const double half_width_rad) {
+  // The angles are compared with cosine to avoid acos and asin for each satellite
+  const double antenna_distance_m = antenna_position_m_.CalcNorm();
+  const double sin_earth_edge = earth_radius_m / antenna_distance_m;
+  const double cos_earth_edge = sqrt(1.0 - sin_earth_edge * sin_earth_edge);
+  const double cos_half_width = cos(half_width_rad);
+
+  size_t number_of_visible_satellites = 0;
+  for (size_t i = 0; i < ranges_m_.size(); i++) {
+    const math::Vector<3>& line_of_sight_m = line_of_sights_m_[i];
+    const double range_m = geometric_distances_m_[i];
+
+    // Earth occultation
+    // Visible when the satellite is in the same hemisphere, or the angle between the earth center and the satellite is larger than the earth edge
+    bool is_visible = true;
+    const double inner_product_m2 = InnerProduct(antenna_position_m_, antenna_position_m_ + line_of_sight_m);
+    if (!(inner_product_m2 > 0.0)) {
+      const double cos_angle_from_earth_center = -InnerProduct(antenna_position_m_, line_of_sight_m) / (antenna_distance_m * range_m);
+      is_visible = cos_angle_from_earth_center < cos_earth_edge;
+    }
+
+    // Antenna cone
+    is_visible = is_visible && (InnerProduct(antenna_direction, line_of_sight_m) > cos_half_width * range_m);
+
+    is_visible_[i] = is_visible ? 1 : 0;
+    if (is_visible) number_of_visible_satellites++;
+  }
+  return number_of_visible_satellites;
+}
+
+}  // namespace s2e::gnss
@@ -0,0 +1,100 @@
+/**
+ * @file gnss_observation_geometry.hpp
+ * @brief Geometry and pseudorange between a GNSS receiver antenna and all GNSS satellites calculated in batch
+ */
+
+#ifndef S2E_LIBRARY_GNSS_GNSS_OBSERVATION_GEOMETRY_HPP_
+#define S2E_LIBRARY_GNSS_GNSS_OBSERVATION_GEOMETRY_HPP_
+
+#include <math_physics/math/vector.hpp>
+#include <vector>
+
+namespace s2e::gnss {
+
+/**
+ * @class GnssObservationGeometry
+ * @brief Geometry and pseudorange between a GNSS receiver antenna and all GNSS satellites
+ * @note All satellites are processed in passes over arrays of each quantity, and the buffers are reused at every update.
+ *       The satellite positions and velocities should be calculated once per step and shared by all receivers.
+ */
+class GnssObservationGeometry {
+ public:
+  /**
+   * @fn GnssObservationGeometry
+   * @brief Default constructor
+   */
+  GnssObservationGeometry() {}
+
+  /**
+   * @fn Update
+   * @brief Calculate the line of sight, the range and the pseudorange with the light time correction for all satellites
+   * @note The frame of the positions and velocities must be an inertial frame.
+   * @param [in] antenna_position_m: Position of the receiver antenna at the reception time [m]
+   * @param [in] satellite_positions_m: Positions of all satellites at the reception time [m]
+   * @param [in] satellite_velocities_m_s: Velocities of all satellites [m/s]
+   * @param [in] satellite_clock_offsets_s: Clock offsets of all satellites [s]
+   * @param [in] receiver_clock_offset_s: Clock offset of the receiver [s]
+   */
+  void Update(const math::Vector<3>& antenna_position_m, const std::vector<math::Vector<3>>& satellite_positions_m,
+              const std::vector<math::Vector<3>>& satellite_velocities_m_s, const std::vector<double>& satellite_clock_offsets_s,
+              const double receiver_clock_offset_s = 0.0);
+
+  /**
+   * @fn CalcVisibility
+   * @brief Judge the visibility of all satellites with the earth occultation and the cone antenna pattern
+   * @param [in] earth_radius_m: Radius of the earth sphere [m]
+   * @param [in] antenna_direction: Unit vector of the antenna pointing direction in the frame of Update
+   * @param [in] half_width_rad: Half width of the antenna cone [rad]
+   * @return Number of visible satellites
+   */
+  size_t CalcVisibility(const double earth_radius_m, const math::Vector<3>& antenna_direction, const double half_width_rad);
+
+  // Getters
+  /**
+   * @fn GetNumberOfSatellites
+   * @return Number of satellites
+   */
+  inline size_t GetNumberOfSatellites() const { return ranges_m_.size(); }
+  /**
+   * @fn GetLineOfSight_m
+   * @param [in] satellite_id: Satellite ID
+   * @return Vector from the antenna to the satellite at the reception time without the light time correction [m]
+   */
+  inline const math::Vector<3>& GetLineOfSight_m(const size_t satellite_id) const { return line_of_sights_m_[satellite_id]; }
+  /**
+   * @fn GetRange_m
+   * @param [in] satellite_id: Satellite ID
+   * @return Geometric range with the light time correction [m]
+   */
+  inline double GetRange_m(const size_t satellite_id) const { return ranges_m_[satellite_id]; }
+  /**
+   * @fn GetGeometricDistance_m
+   * @param [in] satellite_id: Satellite ID
+   * @return Distance between the antenna and the satellite at the reception time without the light time correction [m]
+   */
+  inline double GetGeometricDistance_m(const size_t satellite_id) const { return geometric_distances_m_[satellite_id]; }
+  /**
+   * @fn GetPseudorange_m
+   * @param [in] satellite_id: Satellite ID
+   * @return Pseudorange without noise, ionosphere and troposphere [m]
+   */
+  inline double GetPseudorange_m(const size_t satellite_id) const { return pseudoranges_m_[satellite_id]; }
+  /**
+   * @fn IsVisible
+   * @param [in] satellite_id: Satellite ID
+   * @return Visibility judged by the last CalcVisibility
+   */
+  inline bool IsVisible(const size_t satellite_id) const { return is_visible_[satellite_id] != 0; }
+
+ private:
+  math::Vector<3> antenna_position_m_{0.0};       //!< Position of the receiver antenna [m]
+  std::vector<math::Vector<3>> line_of_sights_m_;  //!< Vectors from the antenna to the satellites at the reception time [m]
+  std::vector<double> geometric_distances_m_;      //!< Distances at the reception time [m]
+  std::vector<double> ranges_m_;                   //!< Geometric ranges with the light time correction [m]
+  std::vector<double> pseudoranges_m_;             //!< Pseudoranges [m]
+  std::vector<unsigned char> is_visible_;          //!< Visibility flags
+};
+
+}  // namespace s2e::gnss
+
+#endif  // S2E_LIBRARY_GNSS_GNSS_OBSERVATION_GEOMETRY_HPP_
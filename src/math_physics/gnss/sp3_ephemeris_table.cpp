@@ -0,0 +1,143 @@
+/**
+ * @file sp3_ephemeris_table.cpp
+ * @brief GNSS satellite orbit and clock table covering multiple SP3 files with interpolation over index ranges
+ */
+
+#include "sp3_ephemeris_table.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+
+namespace s2e::gnss {
+
+bool Sp3EphemerisTable::AddEpoch(const time_system::EpochTime& epoch, const std::vector<math::Vector<3>>& positions_m,
+                                 const std::vector<double>& clock_offsets_s) {
+  if (epoch_times_s_.empty()) {
+    number_of_satellites_ = positions_m.size();
+    reference_epoch_ = epoch;
+  }
+  if (positions_m.size() != number_of_satellites_ || clock_offsets_s.size() != number_of_satellites_) return false;
+
+  const double epoch_time_s = CalcElapsedTime_s(epoch);
+  if (!epoch_times_s_.empty() && epoch_time_s <= epoch_times_s_.back()) return false;
+
+  epoch_times_s_.push_back(epoch_time_s);
+  positions_m_.insert(positions_m_.end(), positions_m.begin(), positions_m.end());
+  clock_offsets_s_.insert(clock_offsets_s_.end(), clock_offsets_s.begin(), clock_offsets_s.end());
+  return true;
+}
+
+bool Sp3EphemerisTable::AddSp3File(const Sp3FileReader& sp3_file) {
+  const size_t number_of_satellites = sp3_file.GetNumberOfSatellites();
+  if (!epoch_times_s_.empty() && number_of_satellites != number_of_satellites_) {
+    std::cout << "[Warning] SP3 ephemeris table: The number of satellites is incompatible with the other SP3 files." << std::endl;
+    return false;
+  }
+
+  std::vector<math::Vector<3>> positions_m(number_of_satellites);
+  std::vector<double> clock_offsets_s(number_of_satellites);
+  for (size_t epoch_id = 0; epoch_id < sp3_file.GetNumberOfEpoch(); epoch_id++) {
+    for (size_t satellite_id = 0; satellite_id < number_of_satellites; satellite_id++) {
+      positions_m[satellite_id] = 1000.0 * sp3_file.GetSatellitePosition_km(epoch_id, satellite_id);
+      clock_offsets_s[satellite_id] = sp3_file.GetSatelliteClockOffset(epoch_id, satellite_id) * 1e-6;
+    }
+    // Overlapped epochs are skipped
+    AddEpoch(time_system::EpochTime(sp3_file.GetEpochData(epoch_id)), positions_m, clock_offsets_s);
+  }
+  return true;
+}
+
+size_t Sp3EphemerisTable::SearchNearestEpochId(const time_system::EpochTime& time) const {
+  if (epoch_times_s_.empty()) return 0;
+
+  const double time_s = CalcElapsedTime_s(time);
+  const size_t upper_id = std::lower_bound(epoch_times_s_.begin(), epoch_times_s_.end(), time_s) - epoch_times_s_.begin();
+  if (upper_id == 0) return 0;
+  if (upper_id >= epoch_times_s_.size()) return epoch_times_s_.size() - 1;
+  // Select the nearer one
+  if (time_s - epoch_times_s_[upper_id - 1] < epoch_times_s_[upper_id] - time_s) return upper_id - 1;
+  return upper_id;
+}
+
+double Sp3EphemerisTable::CalcElapsedTime_s(const time_system::EpochTime& time) const {
+  // Integer part is subtracted first to keep the precision of the fraction
+  const double integer_diff_s = (double)((int64_t)time.GetTime_s() - (int64_t)reference_epoch_.GetTime_s());
+  return integer_diff_s + (time.GetFraction_s() - reference_epoch_.GetFraction_s());
+}
+
+math::Vector<3> Sp3EphemerisTable::CalcPositionWithTrigonometric_m(const size_t satellite_id, const size_t window_start_epoch_id,
+                                                                   const size_t window_size, const double time_s, const double period) const {
+  size_t start_id = window_start_epoch_id;
+  size_t end_id = std::min(window_start_epoch_id + window_size, epoch_times_s_.size());
+  if (start_id >= end_id) return math::Vector<3>(0.0);
+
+  // Trigonometric interpolation needs odd number of points. The farthest point is removed.
+  if ((end_id - start_id) % 2 == 0) {
+    if (fabs(time_s - epoch_times_s_[start_id]) < fabs(time_s - epoch_times_s_[end_id - 1])) {
+      end_id--;
+    } else {
+      start_id++;
+    }
+  }
+
+  math::BarycentricInterpolation interpolation(math::BarycentricInterpolationType::kTrigonometric, period);
+  interpolation.SetNodes(&epoch_times_s_[start_id], end_id - start_id);
+  std::vector<double> basis(end_id - start_id);
+  interpolation.CalcBasis(time_s, basis.data());
+
+  math::Vector<3> position_m(0.0);
+  for (size_t i = start_id; i < end_id; i++) {
+    position_m += basis[i - start_id] * GetPosition_m(i, satellite_id);
+  }
+  return position_m;
+}
+
+double Sp3EphemerisTable::CalcClockOffsetWithPolynomial_s(const size_t satellite_id, const size_t window_start_epoch_id, const size_t window_size,
+                                                          const double time_s) const {
+  const size_t end_id = std::min(window_start_epoch_id + window_size, epoch_times_s_.size());
+  if (window_start_epoch_id >= end_id) return 0.0;
+
+  math::BarycentricInterpolation interpolation(math::BarycentricInterpolationType::kPolynomial);
+  interpolation.SetNodes(&epoch_times_s_[window_start_epoch_id], end_id - window_start_epoch_id);
+  std::vector<double> basis(end_id - window_start_epoch_id);
+  interpolation.CalcBasis(time_s, basis.data());
+
+  double clock_offset_s = 0.0;
+  for (size_t i = window_start_epoch_id; i < end_id; i++) {
+    clock_offset_s += basis[i - window_start_epoch_id] * GetClockOffset_s(i, satellite_id);
+  }
+  return clock_offset_s;
+}
+
+void Sp3EphemerisTable::CalcAllPositions_m(const size_t window_start_epoch_id, const std::vector<double>& basis,
+                                           std::vector<math::Vector<3>>& positions_m) const {
+  positions_m.assign(number_of_satellites_, math::Vector<3>(0.0));
+  const size_t end_id = std::min(window_start_epoch_id + basis.size(), epoch_times_s_.size());
+  // The satellites are the inner loop to access the table contiguously
+  for (size_t epoch_id = window_start_epoch_id; epoch_id < end_id; epoch_id++) {
+    const double weight = basis[epoch_id - window_start_epoch_id];
+    const math::Vector<3>* epoch_positions_m = &positions_m_[epoch_id * number_of_satellites_];
+    for (size_t satellite_id = 0; satellite_id < number_of_satellites_; satellite_id++) {
+      for (size_t axis = 0; axis < 3; axis++) {
+        positions_m[satellite_id][axis] += weight * epoch_positions_m[satellite_id][axis];
+      }
+    }
+  }
+}
+
+void Sp3EphemerisTable::CalcAllClockOffsets_s(const size_t window_start_epoch_id, const std::vector<double>& basis,
+                                              std::vector<double>& clock_offsets_s) const {
+  clock_offsets_s.assign(number_of_satellites_, 0.0);
+  const size_t end_id = std::min(window_start_epoch_id + basis.size(), epoch_times_s_.size());
+  for (size_t epoch_id = window_start_epoch_id; epoch_id < end_id; epoch_id++) {
+    const double weight = basis[epoch_id - window_start_epoch_id];
+    const double* epoch_clock_offsets_s = &clock_offsets_s_[epoch_id * number_of_satellites_];
+    for (size_t satellite_id = 0; satellite_id < number_of_satellites_; satellite_id++) {
+      clock_offsets_s[satellite_id] += weight * epoch_clock_offsets_s[satellite_id];
+    }
+  }
+}
+
+}  // namespace s2e::gnss
@@ -0,0 +1,162 @@
+/**
+ * @file sp3_ephemeris_table.hpp
+ * @brief GNSS satellite orbit and clock table covering multiple SP3 files with interpolation over index ranges
+ */
+
+#ifndef S2E_LIBRARY_GNSS_SP3_EPHEMERIS_TABLE_HPP_
+#define S2E_LIBRARY_GNSS_SP3_EPHEMERIS_TABLE_HPP_
+
+#include <math_physics/math/barycentric_interpolation.hpp>
+#include <math_physics/math/vector.hpp>
+#include <math_physics/time_system/epoch_time.hpp>
+#include <vector>
+
+#include "sp3_file_reader.hpp"
+
+namespace s2e::gnss {
+
+/**
+ * @class Sp3EphemerisTable
+ * @brief GNSS satellite orbit and clock table covering multiple SP3 files
+ * @note The data of all epochs and satellites are stored in contiguous arrays as [epoch_id * number_of_satellites + satellite_id].
+ *       Interpolation windows are given as the start epoch ID and the number of epochs, so sliding the window does not copy data.
+ *       The CalcAll* functions apply an interpolation basis calculated once with math::BarycentricInterpolation to all satellites.
+ */
+class Sp3EphemerisTable {
+ public:
+  /**
+   * @fn Sp3EphemerisTable
+   * @brief Default constructor
+   */
+  Sp3EphemerisTable() {}
+
+  /**
+   * @fn AddEpoch
+   * @brief Add data of an epoch to the tail of the table
+   * @param [in] epoch: Epoch time
+   * @param [in] positions_m: Positions of all satellites [m]
+   * @param [in] clock_offsets_s: Clock offsets of all satellites [s]
+   * @return true: success, false: the epoch is not later than the last epoch or the number of satellites is incompatible
+   */
+  bool AddEpoch(const time_system::EpochTime& epoch, const std::vector<math::Vector<3>>& positions_m, const std::vector<double>& clock_offsets_s);
+  /**
+   * @fn AddSp3File
+   * @brief Add all epochs of a SP3 file to the tail of the table
+   * @note Epochs which are not later than the last epoch of the table (e.g. the overlap of the daily files) are skipped.
+   * @param [in] sp3_file: SP3 file
+   * @return true: success, false: the number of satellites is incompatible
+   */
+  bool AddSp3File(const Sp3FileReader& sp3_file);
+
+  /**
+   * @fn SearchNearestEpochId
+   * @brief Search the epoch ID nearest to the time
+   * @param [in] time: Target time
+   * @return Nearest epoch ID
+   */
+  size_t SearchNearestEpochId(const time_system::EpochTime& time) const;
+
+  /**
+   * @fn CalcPositionWithTrigonometric_m
+   * @brief Calculate satellite position with trigonometric interpolation over the window
+   * @param [in] satellite_id: Satellite ID
+   * @param [in] window_start_epoch_id: Start epoch ID of the interpolation window
+   * @param [in] window_size: Number of epochs in the interpolation window
+   * @param [in] time_s: Target time from the reference epoch [s]
+   * @param [in] period: Characteristic period (angular rate) of the trigonometric interpolation [rad/s]
+   * @return Interpolated position [m]
+   */
+  math::Vector<3> CalcPositionWithTrigonometric_m(const size_t satellite_id, const size_t window_start_epoch_id, const size_t window_size,
+                                                  const double time_s, const double period) const;
+  /**
+   * @fn CalcClockOffsetWithPolynomial_s
+   * @brief Calculate satellite clock offset with polynomial interpolation over the window
+   * @param [in] satellite_id: Satellite ID
+   * @param [in] window_start_epoch_id: Start epoch ID of the interpolation window
+   * @param [in] window_size: Number of epochs in the interpolation window
+   * @param [in] time_s: Target time from the reference epoch [s]
+   * @return Interpolated clock offset [s]
+   */
+  double CalcClockOffsetWithPolynomial_s(const size_t satellite_id, const size_t window_start_epoch_id, const size_t window_size,
+                                         const double time_s) const;
+
+  /**
+   * @fn CalcAllPositions_m
+   * @brief Calculate positions of all satellites with an interpolation basis over the window
+   * @param [in] window_start_epoch_id: Start epoch ID of the interpolation window
+   * @param [in] basis: Interpolation basis of each epoch in the window. The size is the number of epochs in the window.
+   * @param [out] positions_m: Interpolated positions of all satellites [m]
+   */
+  void CalcAllPositions_m(const size_t window_start_epoch_id, const std::vector<double>& basis, std::vector<math::Vector<3>>& positions_m) const;
+  /**
+   * @fn CalcAllClockOffsets_s
+   * @brief Calculate clock offsets of all satellites with an interpolation basis over the window
+   * @param [in] window_start_epoch_id: Start epoch ID of the interpolation window
+   * @param [in] basis: Interpolation basis of each epoch in the window. The size is the number of epochs in the window.
+   * @param [out] clock_offsets_s: Interpolated clock offsets of all satellites [s]
+   */
+  void CalcAllClockOffsets_s(const size_t window_start_epoch_id, const std::vector<double>& basis, std::vector<double>& clock_offsets_s) const;
+
+  // Getters
+  /**
+   * @fn GetNumberOfEpochs
+   * @return Number of epochs
+   */
+  inline size_t GetNumberOfEpochs() const { return epoch_times_s_.size(); }
+  /**
+   * @fn GetNumberOfSatellites
+   * @return Number of satellites
+   */
+  inline size_t GetNumberOfSatellites() const { return number_of_satellites_; }
+  /**
+   * @fn GetReferenceEpoch
+   * @return Reference epoch (the first epoch of the table)
+   */
+  inline const time_system::EpochTime& GetReferenceEpoch() const { return reference_epoch_; }
+  /**
+   * @fn CalcElapsedTime_s
+   * @param [in] time: Target time
+   * @return Elapsed time from the reference epoch [s]
+   */
+  double CalcElapsedTime_s(const time_system::EpochTime& time) const;
+  /**
+   * @fn GetEpochTime_s
+   * @param [in] epoch_id: Epoch ID
+   * @return Time of the epoch from the reference epoch [s]
+   */
+  inline double GetEpochTime_s(const size_t epoch_id) const { return epoch_times_s_[epoch_id]; }
+  /**
+   * @fn GetEpochTimes_s
+   * @return Times of all epochs from the reference epoch [s]
+   */
+  inline const std::vector<double>& GetEpochTimes_s() const { return epoch_times_s_; }
+  /**
+   * @fn GetPosition_m
+   * @param [in] epoch_id: Epoch ID
+   * @param [in] satellite_id: Satellite ID
+   * @return Satellite position at the epoch [m]
+   */
+  inline const math::Vector<3>& GetPosition_m(const size_t epoch_id, const size_t satellite_id) const {
+    return positions_m_[epoch_id * number_of_satellites_ + satellite_id];
+  }
+  /**
+   * @fn GetClockOffset_s
+   * @param [in] epoch_id: Epoch ID
+   * @param [in] satellite_id: Satellite ID
+   * @return Satellite clock offset at the epoch [s]
+   */
+  inline double GetClockOffset_s(const size_t epoch_id, const size_t satellite_id) const {
+    return clock_offsets_s_[epoch_id * number_of_satellites_ + satellite_id];
+  }
+
+ private:
+  size_t number_of_satellites_ = 0;           //!< Number of satellites
+  time_system::EpochTime reference_epoch_;    //!< Reference epoch (the first epoch of the table)
+  std::vector<double> epoch_times_s_;         //!< Epoch times from the reference epoch [s]
+  std::vector<math::Vector<3>> positions_m_;  //!< Satellite positions [m]
+  std::vector<double> clock_offsets_s_;       //!< Satellite clock offsets [s]
+};
+
+}  // namespace s2e::gnss
+
+#endif  // S2E_LIBRARY_GNSS_SP3_EPHEMERIS_TABLE_HPP_
@@ -8,12 +8,289 @@
 
 #include "sp3_file_reader.hpp"
 
+#include <charconv>
+#include <cstdio>
+#include <filesystem>
 #include <fstream>
 #include <iostream>
 
 namespace s2e::gnss {
 
-Sp3FileReader::Sp3FileReader(const std::string file_name) { ReadFile(file_name); }
+// Cache file format (native byte order)
+// magic, size, modification time and hash of the source SP3 file, header, epochs, position and clock data, velocity and clock rate data,
+// and their correlations
+static const char kCacheFileMagic[8] = {'S', '2', 'E', 'S', 'P', '3', '0', '3'};
+
+/**
+ * @fn ReadWholeFile
+ * @brief Read whole file into a buffer
+ */
+static bool ReadWholeFile(const std::string& file_name, std::string& buffer) {
+  std::ifstream file(file_name, std::ios::binary);
+  if (!file.is_open()) return false;
+  file.seekg(0, std::ios::end);
+  buffer.resize((size_t)file.tellg());
+  file.seekg(0, std::ios::beg);
+  file.read(&buffer[0], buffer.size());
+  return (bool)file;
+}
+
+/**
+ * @fn CalcHash
+ * @brief Calculate 64 bit FNV-1a hash of the contents of a file
+ * @note The hash detects reissued files with the same size, which is common for SP3 files because of the fixed width lines.
+ * @param [in] buffer: Whole data of the file
+ * @return Hash of the contents of the file
+ */
+static uint64_t CalcHash(const std::string& buffer) {
+  uint64_t hash = 14695981039346656037ULL;
+  for (const char c : buffer) {
+    hash ^= (uint64_t)(unsigned char)c;
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+/**
+ * @fn GetFileStatus
+ * @brief Get size and modification time of a file without reading its contents
+ * @param [in] file_name: File name with directory path
+ * @param [out] file_size: Size of the file
+ * @param [out] modification_time: Modification time of the file in the clock of the file system
+ * @return true: success, false: the file is not found
+ */
+static bool GetFileStatus(const std::string& file_name, uint64_t& file_size, int64_t& modification_time) {
+  std::error_code error;
+  file_size = (uint64_t)std::filesystem::file_size(file_name, error);
+  if (error) return false;
+  modification_time = (int64_t)std::filesystem::last_write_time(file_name, error).time_since_epoch().count();
+  return !error;
+}
+
+/**
+ * @fn GetLine
+ * @brief Get a line from the buffer without copy
+ * @param [in] buffer: Buffer of the whole file
+ * @param [in/out] position: Read position in the buffer. It moves to the head of the next line.
+ * @param [out] line: Line without the line break. Empty at the end of the buffer.
+ */
+static void GetLine(const std::string& buffer, size_t& position, std::string_view& line) {
+  if (position >= buffer.size()) {
+    line = std::string_view();
+    return;
+  }
+  size_t end = buffer.find('\n', position);
+  if (end == std::string::npos) end = buffer.size();
+  line = std::string_view(buffer.data() + position, end - position);
+  if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+  position = end < buffer.size() ? end + 1 : end;
+}
+
+/**
+ * @fn GetLine
+ * @brief Get a line from the buffer as string
+ */
+static void GetLine(const std::string& buffer, size_t& position, std::string& line) {
+  std::string_view line_view;
+  GetLine(buffer, position, line_view);
+  line = std::string(line_view);
+}
+
+/**
+ * @fn GetField
+ * @brief Return a fixed column field of the line. Empty when the line is shorter than the position.
+ */
+static std::string_view GetField(const std::string_view line, const size_t position, const size_t length) {
+  if (position >= line.size()) return std::string_view();
+  return line.substr(position, length);
+}
+
+/**
+ * @fn ParseNumber
+ * @brief Parse a number in a fixed column field with std::from_chars
+ * @return Parsed value. Zero when the field does not include a number.
+ */
+template <typename T>
+static T ParseNumber(std::string_view field) {
+  while (!field.empty() && field.front() == ' ') field.remove_prefix(1);
+  if (!field.empty() && field.front() == '+') field.remove_prefix(1);
+  T value{};
+  if (std::from_chars(field.data(), field.data() + field.size(), value).ec != std::errc()) return T{};
+  return value;
+}
+static double ParseDouble(const std::string_view field) { return ParseNumber<double>(field); }
+static int ParseInt(const std::string_view field) { return ParseNumber<int>(field); }
+
+/**
+ * @fn WriteValue
+ * @brief Write a value as binary
+ */
+template <typename T>
+static void WriteValue(std::ofstream& file, const T& value) {
+  file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+/**
+ * @fn ReadValue
+ * @brief Read a value as binary
+ */
+template <typename T>
+static T ReadValue(std::ifstream& file) {
+  T value{};
+  file.read(reinterpret_cast<char*>(&value), sizeof(T));
+  return value;
+}
+
+/**
+ * @fn WriteString
+ * @brief Write a string with its length
+ */
+static void WriteString(std::ofstream& file, const std::string& value) {
+  WriteValue<uint64_t>(file, value.size());
+  file.write(value.data(), value.size());
+}
+
+/**
+ * @fn ReadString
+ * @brief Read a string written by WriteString
+ */
+static std::string ReadString(std::ifstream& file) {
+  const uint64_t length = ReadValue<uint64_t>(file);
+  // Strings in SP3 files are short. A long length means a broken file.
+  const uint64_t kMaxLength = 1024;
+  if (!file || length > kMaxLength) {
+    file.setstate(std::ios::failbit);
+    return "";
+  }
+  std::string value(length, '\0');
+  file.read(&value[0], length);
+  return value;
+}
+
+/**
+ * @fn WriteDateTime
+ * @brief Write a date time
+ */
+static void WriteDateTime(std::ofstream& file, const time_system::DateTime& date_time) {
+  WriteValue<uint64_t>(file, date_time.GetYear());
+  WriteValue<uint64_t>(file, date_time.GetMonth());
+  WriteValue<uint64_t>(file, date_time.GetDay());
+  WriteValue<uint64_t>(file, date_time.GetHour());
+  WriteValue<uint64_t>(file, date_time.GetMinute());
+  WriteValue<double>(file, date_time.GetSecond());
+}
+
+/**
+ * @fn ReadDateTime
+ * @brief Read a date time written by WriteDateTime
+ */
+static time_system::DateTime ReadDateTime(std::ifstream& file) {
+  const size_t year = (size_t)ReadValue<uint64_t>(file);
+  const size_t month = (size_t)ReadValue<uint64_t>(file);
+  const size_t day = (size_t)ReadValue<uint64_t>(file);
+  const size_t hour = (size_t)ReadValue<uint64_t>(file);
+  const size_t minute = (size_t)ReadValue<uint64_t>(file);
+  const double second = ReadValue<double>(file);
+  return time_system::DateTime(year, month, day, hour, minute, second);
+}
+
+/**
+ * @fn WriteData
+ * @brief Write SP3 data
+ */
+static void WriteData(std::ofstream& file, const Sp3PositionClock& data) {
+  WriteString(file, data.satellite_id_);
+  WriteValue(file, data.position_km_);
+  WriteValue(file, data.clock_us_);
+  WriteValue(file, data.position_standard_deviation_);
+  WriteValue(file, data.clock_standard_deviation_);
+  WriteValue(file, data.clock_event_flag_);
+  WriteValue(file, data.clock_prediction_flag_);
+  WriteValue(file, data.maneuver_flag_);
+  WriteValue(file, data.orbit_prediction_flag_);
+}
+static void WriteData(std::ofstream& file, const Sp3VelocityClockRate& data) {
+  WriteString(file, data.satellite_id_);
+  WriteValue(file, data.velocity_dm_s_);
+  WriteValue(file, data.clock_rate_);
+  WriteValue(file, data.velocity_standard_deviation_);
+  WriteValue(file, data.clock_rate_standard_deviation_);
+}
+static void WriteData(std::ofstream& file, const Sp3PositionClockCorrelation& data) { WriteValue(file, data); }
+static void WriteData(std::ofstream& file, const Sp3VelocityClockRateCorrelation& data) { WriteValue(file, data); }
+
+/**
+ * @fn ReadData
+ * @brief Read SP3 data written by WriteData
+ */
+static void ReadData(std::ifstream& file, Sp3PositionClock& data) {
+  data.satellite_id_ = ReadString(file);
+  data.position_km_ = ReadValue<math::Vector<3>>(file);
+  data.clock_us_ = ReadValue<double>(file);
+  data.position_standard_deviation_ = ReadValue<math::Vector<3>>(file);
+  data.clock_standard_deviation_ = ReadValue<double>(file);
+  data.clock_event_flag_ = ReadValue<bool>(file);
+  data.clock_prediction_flag_ = ReadValue<bool>(file);
+  data.maneuver_flag_ = ReadValue<bool>(file);
+  data.orbit_prediction_flag_ = ReadValue<bool>(file);
+}
+static void ReadData(std::ifstream& file, Sp3VelocityClockRate& data) {
+  data.satellite_id_ = ReadString(file);
+  data.velocity_dm_s_ = ReadValue<math::Vector<3>>(file);
+  data.clock_rate_ = ReadValue<double>(file);
+  data.velocity_standard_deviation_ = ReadValue<math::Vector<3>>(file);
+  data.clock_rate_standard_deviation_ = ReadValue<double>(file);
+}
+static void ReadData(std::ifstream& file, Sp3PositionClockCorrelation& data) { data = ReadValue<Sp3PositionClockCorrelation>(file); }
+static void ReadData(std::ifstream& file, Sp3VelocityClockRateCorrelation& data) { data = ReadValue<Sp3VelocityClockRateCorrelation>(file); }
+
+/**
+ * @fn WriteDataMap
+ * @brief Write satellite wise SP3 data
+ */
+template <typename T>
+static void WriteDataMap(std::ofstream& file, const std::map<size_t, std::vector<T>>& data_map) {
+  WriteValue<uint64_t>(file, data_map.size());
+  for (const auto& satellite_data : data_map) {
+    WriteValue<uint64_t>(file, satellite_data.first);
+    WriteValue<uint64_t>(file, satellite_data.second.size());
+    for (const T& data : satellite_data.second) WriteData(file, data);
+  }
+}
+
+/**
+ * @fn ReadDataMap
+ * @brief Read satellite wise SP3 data written by WriteDataMap
+ */
+template <typename T>
+static std::map<size_t, std::vector<T>> ReadDataMap(std::ifstream& file, const size_t max_number_of_satellites, const size_t max_number_of_epoch) {
+  std::map<size_t, std::vector<T>> data_map;
+  const uint64_t number_of_satellites = ReadValue<uint64_t>(file);
+  if (number_of_satellites > max_number_of_satellites) file.setstate(std::ios::failbit);
+  for (uint64_t i = 0; i < number_of_satellites && file; i++) {
+    const size_t satellite_id = (size_t)ReadValue<uint64_t>(file);
+    const uint64_t number_of_data = ReadValue<uint64_t>(file);
+    if (number_of_data > max_number_of_epoch) {
+      file.setstate(std::ios::failbit);
+      break;
+    }
+    std::vector<T>& satellite_data = data_map[satellite_id];
+    satellite_data.resize(number_of_data);
+    for (T& data : satellite_data) ReadData(file, data);
+  }
+  return data_map;
+}
+
+Sp3FileReader::Sp3FileReader(const std::string file_name, const std::string cache_file_name) {
+  if (cache_file_name.empty()) {
+    ReadFile(file_name);
+    return;
+  }
+
+  // The cache is used only when it is generated from the file with the same contents
+  if (ReadCacheFile(cache_file_name, file_name)) return;
+  if (ReadFile(file_name)) WriteCacheFile(cache_file_name, file_name);
+}
 
 time_system::DateTime Sp3FileReader::GetEpochData(const size_t epoch_id) const {
   if (epoch_id > epoch_.size()) {
@@ -23,7 +300,7 @@ time_system::DateTime Sp3FileReader::GetEpochData(const size_t epoch_id) const {
   return epoch_[epoch_id];
 }
 
-Sp3PositionClock Sp3FileReader::GetPositionClock(const size_t epoch_id, const size_t satellite_id) {
+Sp3PositionClock Sp3FileReader::GetPositionClock(const size_t epoch_id, const size_t satellite_id) const {
   Sp3PositionClock zero;
   if (epoch_id >= epoch_.size()) {
     return zero;
@@ -32,97 +309,224 @@ Sp3PositionClock Sp3FileReader::GetPositionClock(const size_t epoch_id, const si
     return zero;
   }
 
-  return position_clock_[satellite_id][epoch_id];
+  return position_clock_.at(satellite_id)[epoch_id];
 }
 
-double Sp3FileReader::GetSatelliteClockOffset(const size_t epoch_id, const size_t satellite_id) {
+double Sp3FileReader::GetSatelliteClockOffset(const size_t epoch_id, const size_t satellite_id) const {
   Sp3PositionClock position_clock = GetPositionClock(epoch_id, satellite_id);
   return position_clock.clock_us_;
 }
 
-math::Vector<3> Sp3FileReader::GetSatellitePosition_km(const size_t epoch_id, const size_t satellite_id) {
+math::Vector<3> Sp3FileReader::GetSatellitePosition_km(const size_t epoch_id, const size_t satellite_id) const {
   Sp3PositionClock position_clock = GetPositionClock(epoch_id, satellite_id);
   return position_clock.position_km_;
 }
 
 bool Sp3FileReader::ReadFile(const std::string file_name) {
-  // File open
-  std::ifstream sp3_file(file_name);
-  if (!sp3_file.is_open()) {
+  // The whole file is read at once and decoded in the memory
+  std::string buffer;
+  if (!ReadWholeFile(file_name, buffer)) {
     std::cout << "[Warning] SP3 file not found: " << file_name << std::endl;
     return false;
   }
+  source_file_size_ = (uint64_t)buffer.size();
+  source_file_hash_ = CalcHash(buffer);
+  size_t position = 0;
 
   // Header
-  size_t line_number = ReadHeader(sp3_file);
+  size_t line_number = ReadHeader(buffer, position);
   if (line_number == 0) return false;
 
   // Read epoch wise data
+  std::string_view line;
   for (size_t epoch_id = 0; epoch_id < header_.number_of_epoch_; epoch_id++) {
-    std::string line;
     // Epoch information
-    std::getline(sp3_file, line);
+    GetLine(buffer, position, line);
     if (line.find("* ") != 0) {
       std::cout << "[Warning] SP3 file Epoch line first character error: " << line << std::endl;
       return false;
     }
     size_t year, month, day, hour, minute;
     double second;
-    sscanf(line.substr(3, 28).c_str(), "%zu %2zu %2zu %2zu %2zu %12lf", &year, &month, &day, &hour, &minute, &second);
+    sscanf(std::string(GetField(line, 3, 28)).c_str(), "%zu %2zu %2zu %2zu %2zu %12lf", &year, &month, &day, &hour, &minute, &second);
     epoch_.push_back(time_system::DateTime(year, month, day, hour, minute, second));
 
     // Orbit and Clock information
     for (size_t satellite_id = 0; satellite_id < header_.number_of_satellites_; satellite_id++) {
-      std::getline(sp3_file, line);
+      GetLine(buffer, position, line);
       // Position and Clock
       if (line.find("P") != 0) {
         std::cout << "[Warning] SP3 file position and clock data first character error: " << line << std::endl;
         return false;
       }
-      Sp3PositionClock position_clock = DecodePositionClockData(line);
-      position_clock_[satellite_id].push_back(position_clock);
+      position_clock_[satellite_id].push_back(DecodePositionClockData(line));
 
       // [Optional] Position and Clock Correlation
-      std::streampos previous_position = sp3_file.tellg();
-      std::getline(sp3_file, line);
+      size_t previous_position = position;
+      GetLine(buffer, position, line);
       if (line.find("EP") != 0) {
-        sp3_file.seekg(previous_position);
+        position = previous_position;
       } else {
-        Sp3PositionClockCorrelation position_clock_correlation = DecodePositionClockCorrelation(line);
-        position_clock_correlation_[satellite_id].push_back(position_clock_correlation);
+        position_clock_correlation_[satellite_id].push_back(DecodePositionClockCorrelation(line));
       }
 
       // Velocity and Clock rate
       if (header_.mode_ == Sp3Mode::kVelocity) {
-        std::getline(sp3_file, line);
+        GetLine(buffer, position, line);
         // Position and Clock
         if (line.find("V") != 0) {
           std::cout << "[Warning] SP3 file position and clock data first character error: " << line << std::endl;
           return false;
         }
-        Sp3VelocityClockRate velocity_clock_rate = DecodeVelocityClockRateData(line);
-        velocity_clock_rate_[satellite_id].push_back(velocity_clock_rate);
+        velocity_clock_rate_[satellite_id].push_back(DecodeVelocityClockRateData(line));
 
         // [Optional] Velocity and Clock rate Correlation
-        previous_position = sp3_file.tellg();
-        std::getline(sp3_file, line);
+        previous_position = position;
+        GetLine(buffer, position, line);
         if (line.find("EV") != 0) {
-          sp3_file.seekg(previous_position);
+          position = previous_position;
         } else {
-          Sp3VelocityClockRateCorrelation velocity_clock_rate_correlation = DecodeVelocityClockRateCorrelation(line);
-          velocity_clock_rate_correlation_[satellite_id].push_back(velocity_clock_rate_correlation);
+          velocity_clock_rate_correlation_[satellite_id].push_back(DecodeVelocityClockRateCorrelation(line));
         }
       }
     }
   }
 
-  // Test
-  time_system::DateTime test = epoch_[0];
-  test = epoch_[1];
-  std::vector<Sp3PositionClock> test_p = position_clock_[0];
-  test_p = position_clock_[1];
+  return true;
+}
+
+bool Sp3FileReader::WriteCacheFile(const std::string cache_file_name, const std::string source_file_name) const {
+  uint64_t source_file_size;
+  int64_t source_modification_time;
+  if (!GetFileStatus(source_file_name, source_file_size, source_modification_time)) {
+    std::cout << "[Warning] SP3 file not found: " << source_file_name << std::endl;
+    return false;
+  }
+  if (source_file_size != source_file_size_) {
+    std::cout << "[Warning] SP3 file is changed after reading: " << source_file_name << std::endl;
+    return false;
+  }
+
+  std::ofstream file(cache_file_name, std::ios::binary);
+  if (!file.is_open()) {
+    std::cout << "[Warning] SP3 cache file cannot be opened: " << cache_file_name << std::endl;
+    return false;
+  }
+
+  file.write(kCacheFileMagic, sizeof(kCacheFileMagic));
+  WriteValue<uint64_t>(file, source_file_size_);
+  WriteValue<int64_t>(file, source_modification_time);
+  WriteValue<uint64_t>(file, source_file_hash_);
+
+  // Header
+  WriteValue<int32_t>(file, (int32_t)header_.mode_);
+  WriteDateTime(file, header_.start_epoch_);
+  WriteValue<uint64_t>(file, header_.number_of_epoch_);
+  WriteString(file, header_.used_data_);
+  WriteString(file, header_.coordinate_system_);
+  WriteValue<int32_t>(file, (int32_t)header_.orbit_type_);
+  WriteString(file, header_.agency_name_);
+  WriteValue<uint64_t>(file, header_.start_gps_time_.GetWeek());
+  WriteValue<double>(file, header_.start_gps_time_.GetElapsedTimeFromWeek_s());
+  WriteValue<double>(file, header_.epoch_interval_s_);
+  WriteValue<uint64_t>(file, header_.start_time_mjday_);
+  WriteValue<double>(file, header_.start_time_mjday_fractional_day_);
+  WriteValue<uint64_t>(file, header_.number_of_satellites_);
+  for (size_t i = 0; i < header_.number_of_satellites_; i++) {
+    WriteString(file, header_.satellite_ids_[i]);
+    WriteValue<uint16_t>(file, i < header_.satellite_accuracy_.size() ? header_.satellite_accuracy_[i] : 0);
+  }
+  WriteString(file, header_.file_type_);
+  WriteString(file, header_.time_system_);
+  WriteValue<double>(file, header_.base_number_position_);
+  WriteValue<double>(file, header_.base_number_clock_);
+
+  // Data
+  for (size_t epoch_id = 0; epoch_id < header_.number_of_epoch_; epoch_id++) WriteDateTime(file, epoch_[epoch_id]);
+  WriteDataMap(file, position_clock_);
+  WriteDataMap(file, position_clock_correlation_);
+  WriteDataMap(file, velocity_clock_rate_);
+  WriteDataMap(file, velocity_clock_rate_correlation_);
+
+  if (!file) {
+    std::cout << "[Warning] SP3 cache file writing failed: " << cache_file_name << std::endl;
+    return false;
+  }
+  return true;
+}
 
-  sp3_file.close();
+bool Sp3FileReader::ReadCacheFile(const std::string cache_file_name, const std::string source_file_name) {
+  std::ifstream file(cache_file_name, std::ios::binary);
+  if (!file.is_open()) return false;
+  uint64_t source_file_size;
+  int64_t source_modification_time;
+  if (!GetFileStatus(source_file_name, source_file_size, source_modification_time)) return false;
+
+  char magic[sizeof(kCacheFileMagic)];
+  file.read(magic, sizeof(magic));
+  if (!file || std::string(magic, sizeof(magic)) != std::string(kCacheFileMagic, sizeof(kCacheFileMagic))) return false;
+  if (ReadValue<uint64_t>(file) != source_file_size) return false;
+  const int64_t cached_modification_time = ReadValue<int64_t>(file);
+  const uint64_t source_file_hash = ReadValue<uint64_t>(file);
+  if (!file) return false;
+  // The contents are read only when the modification time differs (e.g. a copied file) to avoid the rejection of the same data
+  if (cached_modification_time != source_modification_time) {
+    std::string buffer;
+    if (!ReadWholeFile(source_file_name, buffer) || CalcHash(buffer) != source_file_hash) return false;
+  }
+
+  // Header
+  Sp3Header header;
+  header.mode_ = (Sp3Mode)ReadValue<int32_t>(file);
+  header.start_epoch_ = ReadDateTime(file);
+  header.number_of_epoch_ = (size_t)ReadValue<uint64_t>(file);
+  header.used_data_ = ReadString(file);
+  header.coordinate_system_ = ReadString(file);
+  header.orbit_type_ = (Sp3OrbitType)ReadValue<int32_t>(file);
+  header.agency_name_ = ReadString(file);
+  const size_t gps_week = (size_t)ReadValue<uint64_t>(file);
+  const double gps_elapsed_time_from_week_s = ReadValue<double>(file);
+  header.start_gps_time_ = time_system::GpsTime(gps_week, gps_elapsed_time_from_week_s);
+  header.epoch_interval_s_ = ReadValue<double>(file);
+  header.start_time_mjday_ = (size_t)ReadValue<uint64_t>(file);
+  header.start_time_mjday_fractional_day_ = ReadValue<double>(file);
+  header.number_of_satellites_ = (size_t)ReadValue<uint64_t>(file);
+  // The size of the source file limits the number of data
+  if (!file || header.number_of_satellites_ > source_file_size || header.number_of_epoch_ > source_file_size) return false;
+  for (size_t i = 0; i < header.number_of_satellites_ && file; i++) {
+    header.satellite_ids_.push_back(ReadString(file));
+    header.satellite_accuracy_.push_back(ReadValue<uint16_t>(file));
+  }
+  header.file_type_ = ReadString(file);
+  header.time_system_ = ReadString(file);
+  header.base_number_position_ = ReadValue<double>(file);
+  header.base_number_clock_ = ReadValue<double>(file);
+  if (!file) return false;
+
+  // Data
+  std::vector<time_system::DateTime> epoch;
+  for (size_t epoch_id = 0; epoch_id < header.number_of_epoch_ && file; epoch_id++) epoch.push_back(ReadDateTime(file));
+  const size_t n_sat = header.number_of_satellites_;
+  const size_t n_epoch = header.number_of_epoch_;
+  std::map<size_t, std::vector<Sp3PositionClock>> position_clock = ReadDataMap<Sp3PositionClock>(file, n_sat, n_epoch);
+  std::map<size_t, std::vector<Sp3PositionClockCorrelation>> position_clock_correlation =
+      ReadDataMap<Sp3PositionClockCorrelation>(file, n_sat, n_epoch);
+  std::map<size_t, std::vector<Sp3VelocityClockRate>> velocity_clock_rate = ReadDataMap<Sp3VelocityClockRate>(file, n_sat, n_epoch);
+  std::map<size_t, std::vector<Sp3VelocityClockRateCorrelation>> velocity_clock_rate_correlation =
+      ReadDataMap<Sp3VelocityClockRateCorrelation>(file, n_sat, n_epoch);
+  if (!file) {
+    std::cout << "[Warning] Broken SP3 cache file: " << cache_file_name << std::endl;
+    return false;
+  }
+
+  header_ = header;
+  epoch_ = epoch;
+  position_clock_ = position_clock;
+  position_clock_correlation_ = position_clock_correlation;
+  velocity_clock_rate_ = velocity_clock_rate;
+  velocity_clock_rate_correlation_ = velocity_clock_rate_correlation;
+  source_file_size_ = source_file_size;
+  source_file_hash_ = source_file_hash;
   return true;
 }
 
@@ -147,13 +551,13 @@ size_t Sp3FileReader::SearchNearestEpochId(const time_system::EpochTime time) {
   return nearest_epoch_id;
 }
 
-size_t Sp3FileReader::ReadHeader(std::ifstream& sp3_file) {
+size_t Sp3FileReader::ReadHeader(const std::string& buffer, size_t& position) {
   size_t line_number = 0;
   std::string line;
 
   // 1st line
   line_number++;
-  std::getline(sp3_file, line);
+  GetLine(buffer, position, line);
   // Check SP3 version
   if (line.find("#d") != 0) {
     std::cout << "[Warning] SP3 file version is not supported: " << line << std::endl;
@@ -192,7 +596,7 @@ size_t Sp3FileReader::ReadHeader(std::ifstream& sp3_file) {
 
   // 2nd line
   line_number++;
-  std::getline(sp3_file, line);
+  GetLine(buffer, position, line);
   // Check first character
   if (line.find("##") != 0) {
     std::cout << "[Warning] SP3 file 2nd line first character error: " << line << std::endl;
@@ -206,7 +610,7 @@ size_t Sp3FileReader::ReadHeader(std::ifstream& sp3_file) {
 
   // Satellite ID lines
   line_number++;
-  std::getline(sp3_file, line);
+  GetLine(buffer, position, line);
   // Check first character
   if (line.find("+ ") != 0) {
     std::cout << "[Warning] SP3 file satellite ID line first character error: " << line << std::endl;
@@ -223,7 +627,7 @@ size_t Sp3FileReader::ReadHeader(std::ifstream& sp3_file) {
       header_.satellite_ids_.push_back(line.substr(9 + i * 3, 3));
     }
     line_number++;
-    std::getline(sp3_file, line);
+    GetLine(buffer, position, line);
   }
   if (header_.satellite_ids_.size() != header_.number_of_satellites_) {
     std::cout << "[Warning] SP3 file number of satellite and size of satellite ID are incompatible." << std::endl;
@@ -244,7 +648,7 @@ size_t Sp3FileReader::ReadHeader(std::ifstream& sp3_file) {
       header_.satellite_accuracy_.push_back((uint8_t)stoi(line.substr(9 + i * 3, 3)));
     }
     line_number++;
-    std::getline(sp3_file, line);
+    GetLine(buffer, position, line);
   }
   if (header_.satellite_accuracy_.size() != header_.number_of_satellites_) {
     std::cout << "[Warning] SP3 file number of satellite and size of accuracy are incompatible." << std::endl;
@@ -259,7 +663,7 @@ size_t Sp3FileReader::ReadHeader(std::ifstream& sp3_file) {
   header_.file_type_ = line.substr(3, 2);
   header_.time_system_ = line.substr(9, 3);
   line_number++;
-  std::getline(sp3_file, line);
+  GetLine(buffer, position, line);
   if (line.find("%c") != 0) {
     std::cout << "[Warning] SP3 file 2nd additional character line first character error: " << line << std::endl;
     return 0;
@@ -267,7 +671,7 @@ size_t Sp3FileReader::ReadHeader(std::ifstream& sp3_file) {
 
   // Additional float lines
   line_number++;
-  std::getline(sp3_file, line);
+  GetLine(buffer, position, line);
   if (line.find("%f") != 0) {
     std::cout << "[Warning] SP3 file 1st additional float line first character error: " << line << std::endl;
     return 0;
@@ -275,7 +679,7 @@ size_t Sp3FileReader::ReadHeader(std::ifstream& sp3_file) {
   header_.base_number_position_ = std::stod(line.substr(3, 10));
   header_.base_number_clock_ = std::stod(line.substr(14, 12));
   line_number++;
-  std::getline(sp3_file, line);
+  GetLine(buffer, position, line);
   if (line.find("%f") != 0) {
     std::cout << "[Warning] SP3 file 2nd additional float line first character error: " << line << std::endl;
     return 0;
@@ -283,74 +687,66 @@ size_t Sp3FileReader::ReadHeader(std::ifstream& sp3_file) {
 
   // Additional integer lines
   line_number++;
-  std::getline(sp3_file, line);
+  GetLine(buffer, position, line);
   if (line.find("%i") != 0) {
     std::cout << "[Warning] SP3 file 1st additional integer line first character error: " << line << std::endl;
     return 0;
   }
   line_number++;
-  std::getline(sp3_file, line);
+  GetLine(buffer, position, line);
   if (line.find("%i") != 0) {
     std::cout << "[Warning] SP3 file 2nd additional integer line first character error: " << line << std::endl;
     return 0;
   }
 
   // Comment lines
-  std::streampos pos;
+  size_t previous_position;
   do {
     line_number++;
-    pos = sp3_file.tellg();
-    std::getline(sp3_file, line);
+    previous_position = position;
+    GetLine(buffer, position, line);
   } while (line.find("/*") == 0);
 
-  sp3_file.seekg(pos);
+  position = previous_position;
   return line_number - 1;
 }
 
-Sp3PositionClock Sp3FileReader::DecodePositionClockData(std::string line) {
+Sp3PositionClock Sp3FileReader::DecodePositionClockData(const std::string_view line) {
   Sp3PositionClock position_clock;
 
   // Satellite ID
-  position_clock.satellite_id_ = line.substr(1, 3);
+  position_clock.satellite_id_ = std::string(GetField(line, 1, 3));
 
   // Position and clock
   math::Vector<3> position_km;
   for (size_t axis = 0; axis < 3; axis++) {
-    position_km[axis] = stod(line.substr(4 + axis * 14, 14));
+    position_km[axis] = ParseDouble(GetField(line, 4 + axis * 14, 14));
   }
   position_clock.position_km_ = position_km;
-  position_clock.clock_us_ = stod(line.substr(46, 14));
+  position_clock.clock_us_ = ParseDouble(GetField(line, 46, 14));
 
   // Standard deviations
   if (line.size() > 61) {
     math::Vector<3> position_standard_deviation;
     for (size_t axis = 0; axis < 3; axis++) {
-      try {
-        position_standard_deviation[axis] = stod(line.substr(61 + axis * 3, 2));
-      } catch (const std::invalid_argument&) {
-        position_standard_deviation[axis] = 0.0;
-      }
+      position_standard_deviation[axis] = ParseDouble(GetField(line, 61 + axis * 3, 2));
     }
     position_clock.position_standard_deviation_ = position_standard_deviation;
-    try {
-      position_clock.clock_standard_deviation_ = stod(line.substr(70, 3));
-    } catch (const std::invalid_argument&) {
-      position_clock.clock_standard_deviation_ = 0.0;
-    }
+    position_clock.clock_standard_deviation_ = ParseDouble(GetField(line, 70, 3));
   }
 
   // Flags
   if (line.size() > 73) {
-    if (line.substr(74, 1) == "E") {
+    if (GetField(line, 74, 1) == "E") {
       position_clock.clock_event_flag_ = true;
     }
-    if (line.substr(75, 1) == "P") {
+    if (GetField(line, 75, 1) == "P") {
       position_clock.clock_prediction_flag_ = true;
     }
-    if (line.substr(78, 1) == "M") {
+    if (GetField(line, 78, 1) == "M") {
       position_clock.maneuver_flag_ = true;
     }
-    if (line.substr(79, 1) == "P") {
+    if (GetField(line, 79, 1) == "P") {
       position_clock.orbit_prediction_flag_ = true;
     }
   }
@@ -359,65 +755,65 @@ Sp3PositionClock Sp3FileReader::DecodePositionClockData(std::string line) {
   return position_clock;
 }
 
-Sp3PositionClockCorrelation Sp3FileReader::DecodePositionClockCorrelation(std::string line) {
+Sp3PositionClockCorrelation Sp3FileReader::DecodePositionClockCorrelation(const std::string_view line) {
   Sp3PositionClockCorrelation correlation;
 
   // Satellite ID
-  correlation.position_x_standard_deviation_mm_ = stoi(line.substr(4, 4));
-  correlation.position_y_standard_deviation_mm_ = stoi(line.substr(9, 4));
-  correlation.position_z_standard_deviation_mm_ = stoi(line.substr(14, 4));
-  correlation.clock_standard_deviation_ps_ = stoi(line.substr(19, 7));
-  correlation.x_y_correlation_ = stoi(line.substr(27, 8));
-  correlation.x_z_correlation_ = stoi(line.substr(36, 8));
-  correlation.x_clock_correlation_ = stoi(line.substr(45, 8));
-  correlation.y_z_correlation_ = stoi(line.substr(54, 8));
-  correlation.y_clock_correlation_ = stoi(line.substr(63, 8));
-  correlation.z_clock_correlation_ = stoi(line.substr(72, 8));
+  correlation.position_x_standard_deviation_mm_ = ParseInt(GetField(line, 4, 4));
+  correlation.position_y_standard_deviation_mm_ = ParseInt(GetField(line, 9, 4));
+  correlation.position_z_standard_deviation_mm_ = ParseInt(GetField(line, 14, 4));
+  correlation.clock_standard_deviation_ps_ = ParseInt(GetField(line, 19, 7));
+  correlation.x_y_correlation_ = ParseInt(GetField(line, 27, 8));
+  correlation.x_z_correlation_ = ParseInt(GetField(line, 36, 8));
+  correlation.x_clock_correlation_ = ParseInt(GetField(line, 45, 8));
+  correlation.y_z_correlation_ = ParseInt(GetField(line, 54, 8));
+  correlation.y_clock_correlation_ = ParseInt(GetField(line, 63, 8));
+  correlation.z_clock_correlation_ = ParseInt(GetField(line, 72, 8));
 
   return correlation;
 }
 
-Sp3VelocityClockRate Sp3FileReader::DecodeVelocityClockRateData(std::string line) {
+Sp3VelocityClockRate Sp3FileReader::DecodeVelocityClockRateData(const std::string_view line) {
   Sp3VelocityClockRate velocity_clock_rate;
 
   // Satellite ID
-  velocity_clock_rate.satellite_id_ = line.substr(1, 3);
+  velocity_clock_rate.satellite_id_ = std::string(GetField(line, 1, 3));
 
   // Velocity and clock rate
   math::Vector<3> velocity_dm_s;
   for (size_t axis = 0; axis < 3; axis++) {
-    velocity_dm_s[axis] = stod(line.substr(4 + axis * 14, 14));
+    velocity_dm_s[axis] = ParseDouble(GetField(line, 4 + axis * 14, 14));
   }
   velocity_clock_rate.velocity_dm_s_ = velocity_dm_s;
-  velocity_clock_rate.clock_rate_ = stod(line.substr(46, 14));
+  velocity_clock_rate.clock_rate_ = ParseDouble(GetField(line, 46, 14));
 
   // Standard deviations
   if (line.size() > 60) {
     math::Vector<3> velocity_standard_deviation;
     for (size_t axis = 0; axis < 3; axis++) {
-      velocity_standard_deviation[axis] = stod(line.substr(61 + axis * 2, 2));
+      velocity_standard_deviation[axis] = ParseDouble(GetField(line, 61 + axis * 2, 2));
     }
     velocity_clock_rate.velocity_standard_deviation_ = velocity_standard_deviation;
-    velocity_clock_rate.clock_rate_standard_deviation_ = stod(line.substr(70, 3));
+    velocity_clock_rate.clock_rate_standard_deviation_ = ParseDouble(GetField(line, 70, 3));
   }
 
   return velocity_clock_rate;
 }
 
-Sp3VelocityClockRateCorrelation Sp3FileReader::DecodeVelocityClockRateCorrelation(std::string line) {
+Sp3VelocityClockRateCorrelation Sp3FileReader::DecodeVelocityClockRateCorrelation(const std::string_view line) {
   Sp3VelocityClockRateCorrelation correlation;
 
   // Satellite ID
-  correlation.velocity_x_standard_deviation_ = stoi(line.substr(4, 4));
-  correlation.velocity_y_standard_deviation_ = stoi(line.substr(9, 4));
-  correlation.velocity_z_standard_deviation_ = stoi(line.substr(14, 4));
-  correlation.clock_rate_standard_deviation_ = stoi(line.substr(19, 7));
-  correlation.x_y_correlation_ = stoi(line.substr(27, 8));
-  correlation.x_z_correlation_ = stoi(line.substr(36, 8));
-  correlation.x_clock_correlation_ = stoi(line.substr(45, 8));
-  correlation.y_z_correlation_ = stoi(line.substr(54, 8));
-  correlation.y_clock_correlation_ = stoi(line.substr(63, 8));
-  correlation.z_clock_correlation_ = stoi(line.substr(72, 8));
+  correlation.velocity_x_standard_deviation_ = ParseInt(GetField(line, 4, 4));
+  correlation.velocity_y_standard_deviation_ = ParseInt(GetField(line, 9, 4));
+  correlation.velocity_z_standard_deviation_ = ParseInt(GetField(line, 14, 4));
+  correlation.clock_rate_standard_deviation_ = ParseInt(GetField(line, 19, 7));
+  correlation.x_y_correlation_ = ParseInt(GetField(line, 27, 8));
+  correlation.x_z_correlation_ = ParseInt(GetField(line, 36, 8));
+  correlation.x_clock_correlation_ = ParseInt(GetField(line, 45, 8));
+  correlation.y_z_correlation_ = ParseInt(GetField(line, 54, 8));
+  correlation.y_clock_correlation_ = ParseInt(GetField(line, 63, 8));
+  correlation.z_clock_correlation_ = ParseInt(GetField(line, 72, 8));
 
   return correlation;
 }
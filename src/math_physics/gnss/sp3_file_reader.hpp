@@ -15,6 +15,7 @@
 #include <math_physics/time_system/date_time_format.hpp>
 #include <math_physics/time_system/gps_time.hpp>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace s2e::gnss {
@@ -163,9 +164,13 @@ class Sp3FileReader {
   /**
    * @fn Sp3FileReader
    * @brief Constructor
+   * @note When the cache file name is set, the cache file is read instead of the SP3 file if it was generated from the SP3 file with the same
+   *       size and modification time, so the SP3 file is not read. When only the modification time differs, the contents hash is compared.
+   *       Otherwise, the SP3 file is read and the cache file is generated.
    * @param[in] file_name: File name of target SP3 file with directory path
+   * @param[in] cache_file_name: File name of the binary cache file with directory path. Empty means the cache is not used.
    */
-  Sp3FileReader(const std::string file_name);
+  Sp3FileReader(const std::string file_name, const std::string cache_file_name = "");
 
   // Getter
   // Header information
@@ -176,12 +181,31 @@ class Sp3FileReader {
   inline time_system::GpsTime GetStartEpochGpsTime() const { return header_.start_gps_time_; }
   // Data
   time_system::DateTime GetEpochData(const size_t epoch_id) const;
-  Sp3PositionClock GetPositionClock(const size_t epoch_id, const size_t satellite_id);
-  double GetSatelliteClockOffset(const size_t epoch_id, const size_t satellite_id);
-  math::Vector<3> GetSatellitePosition_km(const size_t epoch_id, const size_t satellite_id);
+  Sp3PositionClock GetPositionClock(const size_t epoch_id, const size_t satellite_id) const;
+  double GetSatelliteClockOffset(const size_t epoch_id, const size_t satellite_id) const;
+  math::Vector<3> GetSatellitePosition_km(const size_t epoch_id, const size_t satellite_id) const;
 
   size_t SearchNearestEpochId(const time_system::EpochTime time);
 
+  /**
+   * @fn WriteCacheFile
+   * @brief Write the read data as a binary cache file
+   * @note The cache file uses the native byte order, so it should be used only on the machine which generates it.
+   * @param[in] cache_file_name: File name of the cache file with directory path
+   * @param[in] source_file_name: File name of the source SP3 file. Its size, modification time and the contents hash of the read data are stored
+   *                              to check the consistency when reading.
+   * @return true: success, false: file read or write error
+   */
+  bool WriteCacheFile(const std::string cache_file_name, const std::string source_file_name) const;
+  /**
+   * @fn ReadCacheFile
+   * @brief Read a binary cache file written by WriteCacheFile
+   * @param[in] cache_file_name: File name of the cache file with directory path
+   * @param[in] source_file_name: File name of the source SP3 file
+   * @return true: success, false: the cache file is not found, broken, or generated from other file or other version of the file
+   */
+  bool ReadCacheFile(const std::string cache_file_name, const std::string source_file_name);
+
  private:
   Sp3Header header_;                          //!< SP3 header information
   std::vector<time_system::DateTime> epoch_;  //!< Epoch data list
@@ -192,9 +216,13 @@ class Sp3FileReader {
   std::map<size_t, std::vector<Sp3VelocityClockRate>> velocity_clock_rate_;                         //!< Velocity and Clock rate data
   std::map<size_t, std::vector<Sp3VelocityClockRateCorrelation>> velocity_clock_rate_correlation_;  //!< Velocity and Clock rate correlation
 
+  uint64_t source_file_size_ = 0;  //!< Size of the SP3 file of the read data
+  uint64_t source_file_hash_ = 0;  //!< Contents hash of the SP3 file of the read data
+
   /**
    * @fn ReadFile
    * @brief Read SP3 file
+   * @note The whole file is loaded into the memory at once, and the lines are decoded without copy with std::from_chars.
    * @param[in] file_name: File name of target SP3 file with directory path
    * @return true: File read success, false: File read error
    */
@@ -202,38 +230,39 @@ class Sp3FileReader {
   /**
    * @fn ReadHeader
    * @brief Read SP3 file
-   * @param[in] sp3_file: file stream of the SP3 file
+   * @param[in] buffer: Whole data of the SP3 file
+   * @param[in/out] position: Read position in the buffer
    * @return The last line of header. 0 means error is happened.
    */
-  size_t ReadHeader(std::ifstream& sp3_file);
+  size_t ReadHeader(const std::string& buffer, size_t& position);
   /**
    * @fn DecodePositionClockData
    * @brief Decode position and clock data in SP3 file
    * @param[in] line: Single line data of the SP3 file
    * @return decoded data
    */
-  Sp3PositionClock DecodePositionClockData(std::string line);
+  Sp3PositionClock DecodePositionClockData(const std::string_view line);
   /**
    * @fn DecodePositionClockCorrelation
    * @brief Decode position and clock correlation data in SP3 file
    * @param[in] line: Single line data of the SP3 file
    * @return decoded data
    */
-  Sp3PositionClockCorrelation DecodePositionClockCorrelation(std::string line);
+  Sp3PositionClockCorrelation DecodePositionClockCorrelation(const std::string_view line);
   /**
    * @fn DecodeVelocityClockRateData
    * @brief Decode velocity and clock rate data in SP3 file
    * @param[in] line: Single line data of the SP3 file
    * @return decoded data
    */
-  Sp3VelocityClockRate DecodeVelocityClockRateData(std::string line);
+  Sp3VelocityClockRate DecodeVelocityClockRateData(const std::string_view line);
   /**
    * @fn DecodeVelocityClockRateCorrelation
    * @brief Decode velocity and clock rate correlation data in SP3 file
    * @param[in] line: Single line data of the SP3 file
    * @return decoded data
    */
-  Sp3VelocityClockRateCorrelation DecodeVelocityClockRateCorrelation(std::string line);
+  Sp3VelocityClockRateCorrelation DecodeVelocityClockRateCorrelation(const std::string_view line);
 };
 
 }  // namespace s2e::gnss
@@ -177,3 +177,38 @@ TEST(AntexGridDefinition, Constructor) {
   EXPECT_EQ(10, grid.CalcClosestAzimuthIndex(101.0));
   EXPECT_EQ(20, grid.CalcClosestAzimuthIndex(195.0));
 }
+
+/**
+ * @brief Test search of the valid data and phase center variation
+ */
+TEST(AntexReader, Search) {
+  std::string test_file_name = "/src/math_physics/gnss/example.atx";
+  AntexFileReader antex_file(CORE_DIR_FROM_EXE + test_file_name);
+  ASSERT_TRUE(antex_file.GetFileReadSuccessFlag());
+
+  using s2e::time_system::DateTime;
+  using s2e::time_system::EpochTime;
+  // Before the first data
+  EXPECT_EQ(nullptr, antex_file.SearchAntexSatelliteData(0, EpochTime(DateTime(1990, 1, 1, 0, 0, 0.0))));
+  // Valid data
+  const AntexSatelliteData* antex_satellite_data = antex_file.SearchAntexSatelliteData(0, EpochTime(DateTime(2010, 1, 1, 0, 0, 0.0)));
+  ASSERT_NE(nullptr, antex_satellite_data);
+  EXPECT_THAT(antex_satellite_data->GetAntennaType(), ::testing::MatchesRegex("BLOCK IIR-M.*"));
+  antex_satellite_data = antex_file.SearchAntexSatelliteData(0, EpochTime(DateTime(2011, 7, 10, 0, 0, 0.0)));
+  ASSERT_NE(nullptr, antex_satellite_data);
+  EXPECT_THAT(antex_satellite_data->GetAntennaType(), ::testing::MatchesRegex("BLOCK IIA.*"));
+  // Gap between valid times
+  EXPECT_EQ(nullptr, antex_file.SearchAntexSatelliteData(0, EpochTime(DateTime(2011, 7, 14, 0, 0, 0.0))));
+  // The latest data without the valid end time
+  antex_satellite_data = antex_file.SearchAntexSatelliteData(0, EpochTime(DateTime(2020, 1, 1, 0, 0, 0.0)));
+  ASSERT_NE(nullptr, antex_satellite_data);
+  EXPECT_THAT(antex_satellite_data->GetAntennaType(), ::testing::MatchesRegex("BLOCK IIF.*"));
+
+  // Phase center variation
+  const AntexPhaseCenterData& phase_center_data = antex_file.GetAntexSatelliteData(0)[0].GetPhaseCenterData(0);
+  EXPECT_DOUBLE_EQ(-0.8, phase_center_data.CalcPhaseCenterVariation_mm(-1.0));
+  EXPECT_DOUBLE_EQ(-0.8, phase_center_data.CalcPhaseCenterVariation_mm(0.0));
+  EXPECT_DOUBLE_EQ(-0.85, phase_center_data.CalcPhaseCenterVariation_mm(0.5));
+  EXPECT_DOUBLE_EQ(1.4, phase_center_data.CalcPhaseCenterVariation_mm(8.0));
+  EXPECT_DOUBLE_EQ(-0.9, phase_center_data.CalcPhaseCenterVariation_mm(30.0));
+}
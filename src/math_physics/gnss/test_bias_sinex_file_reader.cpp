@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include "bias_sinex_file_reader.hpp"
+#include "gnss_satellite_number.hpp"
 
 using namespace s2e::gnss;
 
@@ -33,3 +34,33 @@ TEST(BiasSinex, Constructor) {
   EXPECT_NEAR(0.0, bias_solution.GetBias(), 1e-10);
   EXPECT_NEAR(0.0, bias_solution.GetBiasStandardDeviation(), 1e-6);
 }
+
+TEST(BiasSinex, SearchSatelliteBias) {
+  std::string test_file_name = "/src/math_physics/gnss/example.BSX";
+  BiasSinexFileReader bias_sinex_file(CORE_DIR_FROM_EXE + test_file_name);
+  ASSERT_TRUE(bias_sinex_file.GetFileReadSuccessFlag());
+
+  using s2e::time_system::DateTime;
+  using s2e::time_system::EpochTime;
+  // 2023:091 is 2023/04/01
+  const EpochTime valid_time(DateTime(2023, 4, 1, 12, 0, 0.0));
+  const BiasSolutionData* bias_solution = bias_sinex_file.SearchSatelliteBias(0, BiasIdentifier::kDsb, BiasTargetSignal::kP1P2, valid_time);
+  ASSERT_NE(nullptr, bias_solution);
+  EXPECT_NEAR(-6.75076755510313E+00, bias_solution->GetBias(), 1e-10);
+  EXPECT_EQ(EpochTime(DateTime(2023, 4, 1, 0, 0, 0.0)), bias_solution->GetValidStartTime());
+  EXPECT_EQ(EpochTime(DateTime(2023, 4, 1, 23, 59, 59.0)), bias_solution->GetValidEndTime());
+
+  bias_solution = bias_sinex_file.SearchSatelliteBias(kGlonassIndexBegin + 3, BiasIdentifier::kDsb, BiasTargetSignal::kP1P2, valid_time);
+  ASSERT_NE(nullptr, bias_solution);
+  EXPECT_NEAR(2.716123247800000E+00, bias_solution->GetBias(), 1e-10);
+
+  // Out of the valid time
+  const EpochTime invalid_time(DateTime(2023, 4, 2, 12, 0, 0.0));
+  EXPECT_EQ(nullptr, bias_sinex_file.SearchSatelliteBias(0, BiasIdentifier::kDsb, BiasTargetSignal::kP1P2, invalid_time));
+  // Station dependent data is not included
+  EXPECT_EQ(nullptr, bias_sinex_file.SearchSatelliteBias(kGlonassIndexBegin + 3, BiasIdentifier::kIsb, BiasTargetSignal::kP1P2, valid_time));
+
+  // File read error
+  BiasSinexFileReader bias_sinex_file_fault("false_file_path.BSX");
+  EXPECT_EQ(nullptr, bias_sinex_file_fault.SearchSatelliteBias(0, BiasIdentifier::kDsb, BiasTargetSignal::kP1P2, valid_time));
+}
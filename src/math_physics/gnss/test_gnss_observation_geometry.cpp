@@ -0,0 +1,88 @@
+/**
+ * @file test_gnss_observation_geometry.cpp
+ * @brief Test codes for GnssObservationGeometry class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "../math/constants.hpp"
+#include "gnss_observation_geometry.hpp"
+
+using namespace s2e::gnss;
+
+static const double kEarthRadius_m = 6378136.6;
+static const double kSpeedOfLight_m_s = 299792458.0;
+
+/**
+ * @brief Test for visibility with the earth occultation and the antenna cone
+ */
+TEST(GnssObservationGeometry, Visibility) {
+  s2e::math::Vector<3> antenna_position_m(0.0);
+  antenna_position_m[2] = kEarthRadius_m + 500e3;
+  const double gnss_radius_m = 2.656e7;
+
+  std::vector<s2e::math::Vector<3>> satellite_positions_m;
+  // Zenith, 60 deg from zenith, behind the earth, and just above the earth limb
+  for (const double angle_rad : {0.0, s2e::math::pi / 3.0, s2e::math::pi, 1.8}) {
+    s2e::math::Vector<3> position_m(0.0);
+    position_m[0] = gnss_radius_m * sin(angle_rad);
+    position_m[2] = gnss_radius_m * cos(angle_rad);
+    satellite_positions_m.push_back(position_m);
+  }
+
+  GnssObservationGeometry geometry;
+  geometry.Update(antenna_position_m, satellite_positions_m, {}, {});
+  EXPECT_EQ(4, geometry.GetNumberOfSatellites());
+  EXPECT_NEAR(gnss_radius_m - antenna_position_m[2], geometry.GetRange_m(0), 1e-6);
+
+  // Wide antenna pointing to zenith
+  s2e::math::Vector<3> antenna_direction(0.0);
+  antenna_direction[2] = 1.0;
+  const size_t number_of_visible_satellites = geometry.CalcVisibility(kEarthRadius_m, antenna_direction, s2e::math::pi_2 * 1.5);
+  EXPECT_TRUE(geometry.IsVisible(0));
+  EXPECT_TRUE(geometry.IsVisible(1));
+  EXPECT_FALSE(geometry.IsVisible(2));
+  // The satellite near the limb is visible when the angle from nadir is larger than the earth limb
+  const double limb_angle_rad = asin(kEarthRadius_m / antenna_position_m[2]);
+  const s2e::math::Vector<3> line_of_sight_m = geometry.GetLineOfSight_m(3);
+  const double angle_from_nadir_rad = acos(-line_of_sight_m[2] / line_of_sight_m.CalcNorm());
+  EXPECT_EQ(angle_from_nadir_rad > limb_angle_rad, geometry.IsVisible(3));
+  EXPECT_EQ(geometry.IsVisible(3) ? 3 : 2, number_of_visible_satellites);
+
+  // Narrow antenna
+  EXPECT_EQ(1, geometry.CalcVisibility(kEarthRadius_m, antenna_direction, 10.0 * s2e::math::deg_to_rad));
+  EXPECT_TRUE(geometry.IsVisible(0));
+}
+
+/**
+ * @brief Test for light time correction and pseudorange
+ */
+TEST(GnssObservationGeometry, Pseudorange) {
+  s2e::math::Vector<3> antenna_position_m(0.0);
+  antenna_position_m[2] = kEarthRadius_m;
+  s2e::math::Vector<3> satellite_position_m(0.0);
+  satellite_position_m[2] = 2.656e7;
+  s2e::math::Vector<3> satellite_velocity_m_s(0.0);
+  satellite_velocity_m_s[0] = 3.9e3;
+  const double satellite_clock_offset_s = 1e-4;
+  const double receiver_clock_offset_s = -2e-5;
+
+  GnssObservationGeometry geometry;
+  geometry.Update(antenna_position_m, {satellite_position_m}, {satellite_velocity_m_s}, {satellite_clock_offset_s}, receiver_clock_offset_s);
+
+  const double distance_m = satellite_position_m[2] - antenna_position_m[2];
+  const double light_time_s = distance_m / kSpeedOfLight_m_s;
+  const double expected_range_m = sqrt(distance_m * distance_m + pow(satellite_velocity_m_s[0] * light_time_s, 2.0));
+  EXPECT_NEAR(expected_range_m, geometry.GetRange_m(0), 1e-6);
+  EXPECT_NEAR(distance_m, geometry.GetGeometricDistance_m(0), 1e-6);
+  EXPECT_NEAR(expected_range_m + kSpeedOfLight_m_s * (receiver_clock_offset_s - satellite_clock_offset_s), geometry.GetPseudorange_m(0), 1e-6);
+
+  // The line of sight and the visibility use the geometry at the reception time without the light time correction
+  EXPECT_DOUBLE_EQ(0.0, geometry.GetLineOfSight_m(0)[0]);
+  EXPECT_NEAR(distance_m, geometry.GetLineOfSight_m(0)[2], 1e-6);
+  s2e::math::Vector<3> antenna_direction(0.0);
+  antenna_direction[2] = 1.0;
+  const double half_width_rad = 0.1 * satellite_velocity_m_s[0] * light_time_s / distance_m;
+  EXPECT_EQ(1, geometry.CalcVisibility(kEarthRadius_m, antenna_direction, half_width_rad));
+}
@@ -0,0 +1,104 @@
+/**
+ * @file test_sp3_ephemeris_table.cpp
+ * @brief Test codes for Sp3EphemerisTable class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "sp3_ephemeris_table.hpp"
+
+using namespace s2e::gnss;
+
+/**
+ * @brief Test adding SP3 files
+ */
+TEST(Sp3EphemerisTable, AddSp3File) {
+  std::string test_file_name = "/src/math_physics/gnss/example.sp3";
+  Sp3FileReader sp3_file(CORE_DIR_FROM_EXE + test_file_name);
+
+  Sp3EphemerisTable table;
+  EXPECT_TRUE(table.AddSp3File(sp3_file));
+  // Overlapped epochs are skipped
+  EXPECT_TRUE(table.AddSp3File(sp3_file));
+
+  EXPECT_EQ(2, table.GetNumberOfEpochs());
+  EXPECT_EQ(119, table.GetNumberOfSatellites());
+  EXPECT_DOUBLE_EQ(0.0, table.GetEpochTime_s(0));
+  EXPECT_NEAR(900.0, table.GetEpochTime_s(1), 1e-6);
+  for (size_t satellite_id = 0; satellite_id < table.GetNumberOfSatellites(); satellite_id++) {
+    for (size_t axis = 0; axis < 3; axis++) {
+      EXPECT_DOUBLE_EQ(1000.0 * sp3_file.GetSatellitePosition_km(1, satellite_id)[axis], table.GetPosition_m(1, satellite_id)[axis]);
+    }
+    EXPECT_DOUBLE_EQ(1e-6 * sp3_file.GetSatelliteClockOffset(1, satellite_id), table.GetClockOffset_s(1, satellite_id));
+  }
+  EXPECT_EQ(1, table.SearchNearestEpochId(s2e::time_system::EpochTime(sp3_file.GetEpochData(1))));
+}
+
+/**
+ * @brief Test interpolation over index ranges
+ */
+TEST(Sp3EphemerisTable, Interpolation) {
+  const double interval_s = 900.0;
+  const double angular_velocity_rad_s = 1.45e-4;
+  const double radius_m = 2.656e7;
+  const double clock_drift = 1e-10;
+
+  Sp3EphemerisTable table;
+  for (size_t epoch_id = 0; epoch_id < 20; epoch_id++) {
+    const double time_s = epoch_id * interval_s;
+    std::vector<s2e::math::Vector<3>> positions_m(2, s2e::math::Vector<3>(0.0));
+    std::vector<double> clock_offsets_s(2);
+    for (size_t satellite_id = 0; satellite_id < 2; satellite_id++) {
+      const double phase_rad = angular_velocity_rad_s * time_s + satellite_id;
+      positions_m[satellite_id][0] = radius_m * cos(phase_rad);
+      positions_m[satellite_id][1] = radius_m * sin(phase_rad);
+      clock_offsets_s[satellite_id] = 1e-4 * satellite_id + clock_drift * time_s;
+    }
+    EXPECT_TRUE(table.AddEpoch(s2e::time_system::EpochTime(1000000000 + (uint64_t)time_s, 0.0), positions_m, clock_offsets_s));
+  }
+  // Past epoch cannot be added
+  EXPECT_FALSE(table.AddEpoch(s2e::time_system::EpochTime(1000000000, 0.0), std::vector<s2e::math::Vector<3>>(2), std::vector<double>(2)));
+
+  const size_t window_size = 9;
+  for (double time_s = 4.0 * interval_s; time_s < 14.0 * interval_s; time_s += 100.0) {
+    const size_t window_start_epoch_id = table.SearchNearestEpochId(s2e::time_system::EpochTime(1000000000 + (uint64_t)time_s, 0.0)) - 4;
+    for (size_t satellite_id = 0; satellite_id < 2; satellite_id++) {
+      const double phase_rad = angular_velocity_rad_s * time_s + satellite_id;
+      const s2e::math::Vector<3> position_m =
+          table.CalcPositionWithTrigonometric_m(satellite_id, window_start_epoch_id, window_size, time_s, angular_velocity_rad_s);
+      EXPECT_NEAR(radius_m * cos(phase_rad), position_m[0], 1e-3);
+      EXPECT_NEAR(radius_m * sin(phase_rad), position_m[1], 1e-3);
+      EXPECT_NEAR(1e-4 * satellite_id + clock_drift * time_s,
+                  table.CalcClockOffsetWithPolynomial_s(satellite_id, window_start_epoch_id, window_size, time_s), 1e-15);
+    }
+
+    // Basis shared by all satellites
+    std::vector<double> nodes_s(window_size);
+    for (size_t i = 0; i < window_size; i++) nodes_s[i] = table.GetEpochTime_s(window_start_epoch_id + i);
+    std::vector<double> basis(window_size);
+    s2e::math::BarycentricInterpolation orbit_interpolation(s2e::math::BarycentricInterpolationType::kTrigonometric, angular_velocity_rad_s);
+    orbit_interpolation.SetNodes(nodes_s.data(), window_size);
+    orbit_interpolation.CalcBasis(time_s, basis.data());
+    std::vector<s2e::math::Vector<3>> positions_m;
+    table.CalcAllPositions_m(window_start_epoch_id, basis, positions_m);
+    std::vector<s2e::math::Vector<3>> velocities_m_s;
+    orbit_interpolation.CalcBasisDerivative(time_s, basis.data());
+    table.CalcAllPositions_m(window_start_epoch_id, basis, velocities_m_s);
+    s2e::math::BarycentricInterpolation clock_interpolation(s2e::math::BarycentricInterpolationType::kPolynomial);
+    clock_interpolation.SetNodes(nodes_s.data(), window_size);
+    clock_interpolation.CalcBasis(time_s, basis.data());
+    std::vector<double> clock_offsets_s;
+    table.CalcAllClockOffsets_s(window_start_epoch_id, basis, clock_offsets_s);
+    ASSERT_EQ(2, positions_m.size());
+    ASSERT_EQ(2, clock_offsets_s.size());
+    for (size_t satellite_id = 0; satellite_id < 2; satellite_id++) {
+      const double phase_rad = angular_velocity_rad_s * time_s + satellite_id;
+      EXPECT_NEAR(radius_m * cos(phase_rad), positions_m[satellite_id][0], 1e-3);
+      EXPECT_NEAR(radius_m * sin(phase_rad), positions_m[satellite_id][1], 1e-3);
+      EXPECT_NEAR(1e-4 * satellite_id + clock_drift * time_s, clock_offsets_s[satellite_id], 1e-15);
+      EXPECT_NEAR(-radius_m * angular_velocity_rad_s * sin(phase_rad), velocities_m_s[satellite_id][0], 1e-6);
+      EXPECT_NEAR(radius_m * angular_velocity_rad_s * cos(phase_rad), velocities_m_s[satellite_id][1], 1e-6);
+    }
+  }
+}
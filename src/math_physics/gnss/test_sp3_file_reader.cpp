@@ -4,6 +4,12 @@
  */
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
 #include "sp3_file_reader.hpp"
 
 using namespace s2e::gnss;
@@ -59,3 +65,85 @@ TEST(Sp3FileReader, Constructor) {
   EXPECT_DOUBLE_EQ(-5590.944265, sp3_file.GetSatellitePosition_km(1, 118)[2]);
   EXPECT_DOUBLE_EQ(97.367506, sp3_file.GetSatelliteClockOffset(1, 118));
 }
+
+/**
+ * @brief Test binary cache file
+ */
+TEST(Sp3FileReader, CacheFile) {
+  std::string test_file_name = "/src/math_physics/gnss/example.sp3";
+  std::string cache_file_name = "test_sp3_file_reader.s2ecache";
+  std::remove(cache_file_name.c_str());
+
+  // The first read generates the cache file and the second read uses it
+  Sp3FileReader sp3_file(CORE_DIR_FROM_EXE + test_file_name, cache_file_name);
+  Sp3FileReader cached_sp3_file(CORE_DIR_FROM_EXE + test_file_name, cache_file_name);
+
+  EXPECT_EQ(sp3_file.GetNumberOfEpoch(), cached_sp3_file.GetNumberOfEpoch());
+  EXPECT_EQ(sp3_file.GetNumberOfSatellites(), cached_sp3_file.GetNumberOfSatellites());
+  EXPECT_EQ(1734, cached_sp3_file.GetStartEpochGpsTime().GetWeek());
+  EXPECT_DOUBLE_EQ(259200.0, cached_sp3_file.GetStartEpochGpsTime().GetElapsedTimeFromWeek_s());
+  EXPECT_DOUBLE_EQ(1.23456789, cached_sp3_file.GetEpochData(1).GetSecond());
+  EXPECT_EQ(sp3_file.GetHeader().satellite_ids_, cached_sp3_file.GetHeader().satellite_ids_);
+  for (size_t epoch_id = 0; epoch_id < sp3_file.GetNumberOfEpoch(); epoch_id++) {
+    for (size_t satellite_id = 0; satellite_id < sp3_file.GetNumberOfSatellites(); satellite_id++) {
+      for (size_t axis = 0; axis < 3; axis++) {
+        EXPECT_DOUBLE_EQ(sp3_file.GetSatellitePosition_km(epoch_id, satellite_id)[axis],
+                         cached_sp3_file.GetSatellitePosition_km(epoch_id, satellite_id)[axis]);
+      }
+      EXPECT_DOUBLE_EQ(sp3_file.GetSatelliteClockOffset(epoch_id, satellite_id), cached_sp3_file.GetSatelliteClockOffset(epoch_id, satellite_id));
+    }
+  }
+
+  EXPECT_TRUE(cached_sp3_file.ReadCacheFile(cache_file_name, CORE_DIR_FROM_EXE + test_file_name));
+  // The cache generated from other file is rejected
+  EXPECT_FALSE(cached_sp3_file.ReadCacheFile(cache_file_name, "not_existing.sp3"));
+  EXPECT_FALSE(cached_sp3_file.ReadCacheFile("not_existing.s2ecache", CORE_DIR_FROM_EXE + test_file_name));
+
+  std::remove(cache_file_name.c_str());
+}
+
+/**
+ * @brief Test binary cache file with the source file rewritten with the same size
+ */
+TEST(Sp3FileReader, CacheFileWithRewrittenSource) {
+  std::string test_file_name = "/src/math_physics/gnss/example.sp3";
+  std::string source_file_name = "test_sp3_file_reader_source.sp3";
+  std::string cache_file_name = "test_sp3_file_reader_rewritten.s2ecache";
+  std::remove(cache_file_name.c_str());
+
+  std::ifstream original_file(CORE_DIR_FROM_EXE + test_file_name, std::ios::binary);
+  std::string contents((std::istreambuf_iterator<char>(original_file)), std::istreambuf_iterator<char>());
+  {
+    std::ofstream source_file(source_file_name, std::ios::binary);
+    source_file << contents;
+  }
+  Sp3FileReader sp3_file(source_file_name, cache_file_name);
+  EXPECT_DOUBLE_EQ(-32428.005614, sp3_file.GetSatellitePosition_km(1, 118)[0]);
+
+  // The cache is used for the same contents with other modification time (e.g. a copied file)
+  const std::filesystem::file_time_type modification_time = std::filesystem::last_write_time(source_file_name);
+  std::filesystem::last_write_time(source_file_name, modification_time + std::chrono::seconds(10));
+  EXPECT_TRUE(sp3_file.ReadCacheFile(cache_file_name, source_file_name));
+
+  // Correct a value without changing the file size
+  const size_t position = contents.find("-32428.005614");
+  ASSERT_NE(std::string::npos, position);
+  contents.replace(position, 13, "-32428.005615");
+  {
+    std::ofstream source_file(source_file_name, std::ios::binary);
+    source_file << contents;
+  }
+  // The modification time is set explicitly since the rewrite can be within the time resolution of the file system
+  std::filesystem::last_write_time(source_file_name, modification_time + std::chrono::seconds(20));
+  EXPECT_FALSE(sp3_file.ReadCacheFile(cache_file_name, source_file_name));
+  Sp3FileReader rewritten_sp3_file(source_file_name, cache_file_name);
+  EXPECT_DOUBLE_EQ(-32428.005615, rewritten_sp3_file.GetSatellitePosition_km(1, 118)[0]);
+
+  // The cache is regenerated from the rewritten file
+  Sp3FileReader cached_sp3_file(source_file_name, cache_file_name);
+  EXPECT_TRUE(cached_sp3_file.ReadCacheFile(cache_file_name, source_file_name));
+  EXPECT_DOUBLE_EQ(-32428.005615, cached_sp3_file.GetSatellitePosition_km(1, 118)[0]);
+
+  std::remove(source_file_name.c_str());
+  std::remove(cache_file_name.c_str());
+}
@@ -9,6 +9,7 @@
 #include <cmath>
 #include <fstream>
 #include <iostream>
+#include <sstream>
 
 namespace s2e::gravity {
 
@@ -28,152 +29,143 @@ GravityPotential::GravityPotential(const size_t degree, const std::vector<std::v
   // TODO Check size
 }
 
-math::Vector<3> GravityPotential::CalcAcceleration_xcxf_m_s2(const math::Vector<3> &position_xcxf_m) {
-  math::Vector<3> acceleration_xcxf_m_s2(0.0);
-  if (degree_ <= 0) return acceleration_xcxf_m_s2;  // TODO: Consider this assertion is needed
+math::Vector<3> GravityPotential::CalcAcceleration_xcxf_m_s2(const math::Vector<3> &position_xcxf_m) const {
+  return CalcAcceleration_xcxf_m_s2(std::vector<math::Vector<3>>{position_xcxf_m})[0];
+}
 
-  xcxf_x_m_ = position_xcxf_m[0];
-  xcxf_y_m_ = position_xcxf_m[1];
-  xcxf_z_m_ = position_xcxf_m[2];
-  radius_m_ = position_xcxf_m.CalcNorm();
+std::vector<math::Vector<3>> GravityPotential::CalcAcceleration_xcxf_m_s2(const std::vector<math::Vector<3>> &positions_xcxf_m) const {
+  const size_t num_positions = positions_xcxf_m.size();
+  std::vector<math::Vector<3>> accelerations_xcxf_m_s2(num_positions, math::Vector<3>(0.0));
+  if (degree_ <= 0 || num_positions == 0) return accelerations_xcxf_m_s2;  // TODO: Consider this assertion is needed
 
   // Calc V and W
   const size_t degree_vw = degree_ + 1;
-  std::vector<std::vector<double>> v(degree_vw + 1, std::vector<double>(degree_vw + 1, 0.0));
-  std::vector<std::vector<double>> w(degree_vw + 1, std::vector<double>(degree_vw + 1, 0.0));
-  // n = m = 0
-  v[0][0] = center_body_radius_m_ / radius_m_;
-  w[0][0] = 0.0;
-  m_ = 0;
-
-  while (m_ < degree_vw) {
-    for (n_ = m_ + 1; n_ <= degree_vw; n_++) {
-      if (n_ <= m_ + 1) {
-        v_w_nm_update(&v[n_][m_], &w[n_][m_], v[n_ - 1][m_], w[n_ - 1][m_], 0.0, 0.0);
-      } else {
-        v_w_nm_update(&v[n_][m_], &w[n_][m_], v[n_ - 1][m_], w[n_ - 1][m_], v[n_ - 2][m_], w[n_ - 2][m_]);
-      }
-    }
-    // next step
-    m_++;
-    n_ = m_;
-    v_w_nn_update(&v[n_][m_], &w[n_][m_], v[n_ - 1][m_ - 1], w[n_ - 1][m_ - 1]);
-  }
+  const size_t stride = degree_vw + 1;
+  std::vector<double> v, w;
+  CalcVw(positions_xcxf_m, degree_vw, v, w);
+  // Head index of the (n, m) element for all positions
+  const auto index = [stride, num_positions](const size_t n, const size_t m) { return (n * stride + m) * num_positions; };
 
   // Calc Acceleration
-  for (n_ = 0; n_ <= degree_; n_++)  // this loop can integrate with previous loop
-  {
-    m_ = 0;
-    const double n_d = (double)n_;
+  // The coefficients are loaded once for each (n, m) and applied to all positions
+  std::vector<double> acceleration_x(num_positions, 0.0), acceleration_y(num_positions, 0.0), acceleration_z(num_positions, 0.0);
+  for (size_t n = 0; n <= degree_; n++) {
+    const double n_d = (double)n;
     const double normalize = sqrt((2.0 * n_d + 1.0) / (2.0 * n_d + 3.0));
     const double normalize_xy = normalize * sqrt((n_d + 2.0) * (n_d + 1.0) / 2.0);
-    // m_==0
-    acceleration_xcxf_m_s2[0] += -c_[n_][0] * v[n_ + 1][1] * normalize_xy;
-    acceleration_xcxf_m_s2[1] += -c_[n_][0] * w[n_ + 1][1] * normalize_xy;
-    acceleration_xcxf_m_s2[2] += (n_ + 1.0) * (-c_[n_][0] * v[n_ + 1][0] - s_[n_][0] * w[n_ + 1][0]) * normalize;
-    for (m_ = 1; m_ <= n_; m_++) {
-      const double m_d = (double)m_;
+    // m == 0
+    {
+      const double c_n0 = c_[n][0];
+      const double s_n0 = s_[n][0];
+      const double *v_n1_0 = &v[index(n + 1, 0)];
+      const double *w_n1_0 = &w[index(n + 1, 0)];
+      const double *v_n1_1 = &v[index(n + 1, 1)];
+      const double *w_n1_1 = &w[index(n + 1, 1)];
+      for (size_t i = 0; i < num_positions; i++) {
+        acceleration_x[i] += -c_n0 * v_n1_1[i] * normalize_xy;
+        acceleration_y[i] += -c_n0 * w_n1_1[i] * normalize_xy;
+        acceleration_z[i] += (n_d + 1.0) * (-c_n0 * v_n1_0[i] - s_n0 * w_n1_0[i]) * normalize;
+      }
+    }
+    for (size_t m = 1; m <= n; m++) {
+      const double m_d = (double)m;
       const double factorial = (n_d - m_d + 1.0) * (n_d - m_d + 2.0);
       const double normalize_xy1 = normalize * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0));
       double normalize_xy2;
-      if (m_ == 1) {
+      if (m == 1) {
         normalize_xy2 = normalize * sqrt(factorial) * sqrt(2.0);
       } else {
         normalize_xy2 = normalize * sqrt(factorial);
       }
       const double normalize_z = normalize * sqrt((n_d + m_d + 1.0) / (n_d - m_d + 1.0));
 
-      acceleration_xcxf_m_s2[0] += 0.5 * (normalize_xy1 * (-c_[n_][m_] * v[n_ + 1][m_ + 1] - s_[n_][m_] * w[n_ + 1][m_ + 1]) +
-                                          normalize_xy2 * (c_[n_][m_] * v[n_ + 1][m_ - 1] + s_[n_][m_] * w[n_ + 1][m_ - 1]));
-      acceleration_xcxf_m_s2[1] += 0.5 * (normalize_xy1 * (-c_[n_][m_] * w[n_ + 1][m_ + 1] + s_[n_][m_] * v[n_ + 1][m_ + 1]) +
-                                          normalize_xy2 * (-c_[n_][m_] * w[n_ + 1][m_ - 1] + s_[n_][m_] * v[n_ + 1][m_ - 1]));
-      acceleration_xcxf_m_s2[2] += (n_d - m_d + 1.0) * (-c_[n_][m_] * v[n_ + 1][m_] - s_[n_][m_] * w[n_ + 1][m_]) * normalize_z;
+      const double c_nm = c_[n][m];
+      const double s_nm = s_[n][m];
+      const double *v_plus = &v[index(n + 1, m + 1)];
+      const double *w_plus = &w[index(n + 1, m + 1)];
+      const double *v_zero = &v[index(n + 1, m)];
+      const double *w_zero = &w[index(n + 1, m)];
+      const double *v_minus = &v[index(n + 1, m - 1)];
+      const double *w_minus = &w[index(n + 1, m - 1)];
+      for (size_t i = 0; i < num_positions; i++) {
+        acceleration_x[i] += 0.5 * (normalize_xy1 * (-c_nm * v_plus[i] - s_nm * w_plus[i]) + normalize_xy2 * (c_nm * v_minus[i] + s_nm * w_minus[i]));
+        acceleration_y[i] +=
+            0.5 * (normalize_xy1 * (-c_nm * w_plus[i] + s_nm * v_plus[i]) + normalize_xy2 * (-c_nm * w_minus[i] + s_nm * v_minus[i]));
+        acceleration_z[i] += (n_d - m_d + 1.0) * (-c_nm * v_zero[i] - s_nm * w_zero[i]) * normalize_z;
+      }
     }
   }
-  acceleration_xcxf_m_s2 *= gravity_constants_m3_s2_ / pow(center_body_radius_m_, 2.0);
 
-  return acceleration_xcxf_m_s2;
+  const double coefficient = gravity_constants_m3_s2_ / (center_body_radius_m_ * center_body_radius_m_);
+  for (size_t i = 0; i < num_positions; i++) {
+    accelerations_xcxf_m_s2[i][0] = acceleration_x[i] * coefficient;
+    accelerations_xcxf_m_s2[i][1] = acceleration_y[i] * coefficient;
+    accelerations_xcxf_m_s2[i][2] = acceleration_z[i] * coefficient;
+  }
+
+  return accelerations_xcxf_m_s2;
 }
 
-math::Matrix<3, 3> GravityPotential::CalcPartialDerivative_xcxf_s2(const math::Vector<3> &position_xcxf_m) {
+math::Matrix<3, 3> GravityPotential::CalcPartialDerivative_xcxf_s2(const math::Vector<3> &position_xcxf_m) const {
   math::Matrix<3, 3> partial_derivative(0.0);
   if (degree_ <= 0) return partial_derivative;
 
-  xcxf_x_m_ = position_xcxf_m[0];
-  xcxf_y_m_ = position_xcxf_m[1];
-  xcxf_z_m_ = position_xcxf_m[2];
-  radius_m_ = position_xcxf_m.CalcNorm();
-
   // Calc V and W
   const size_t degree_vw = degree_ + 2;
-  std::vector<std::vector<double>> v(degree_vw + 1, std::vector<double>(degree_vw + 1, 0.0));
-  std::vector<std::vector<double>> w(degree_vw + 1, std::vector<double>(degree_vw + 1, 0.0));
-  // n = m = 0
-  v[0][0] = center_body_radius_m_ / radius_m_;
-  w[0][0] = 0.0;
-  m_ = 0;
-  while (m_ < degree_vw) {
-    for (n_ = m_ + 1; n_ <= degree_vw; n_++) {
-      if (n_ <= m_ + 1) {
-        v_w_nm_update(&v[n_][m_], &w[n_][m_], v[n_ - 1][m_], w[n_ - 1][m_], 0.0, 0.0);
-      } else {
-        v_w_nm_update(&v[n_][m_], &w[n_][m_], v[n_ - 1][m_], w[n_ - 1][m_], v[n_ - 2][m_], w[n_ - 2][m_]);
-      }
-    }
-    // next step
-    m_++;
-    n_ = m_;
-    v_w_nn_update(&v[n_][m_], &w[n_][m_], v[n_ - 1][m_ - 1], w[n_ - 1][m_ - 1]);
-  }
+  const size_t stride = degree_vw + 1;
+  std::vector<double> v_array, w_array;
+  CalcVw(std::vector<math::Vector<3>>{position_xcxf_m}, degree_vw, v_array, w_array);
+  const auto v = [&](const size_t n, const size_t m) { return v_array[n * stride + m]; };
+  const auto w = [&](const size_t n, const size_t m) { return w_array[n * stride + m]; };
 
   // Calc partial derivatives
-  for (n_ = 0; n_ <= degree_; n_++)  // this loop can integrate with previous loop
+  for (size_t n = 0; n <= degree_; n++)  // this loop can integrate with previous loop
   {
-    const double n_d = (double)n_;
+    const double n_d = (double)n;
 
     // C_n_0 * V_n+2_m
     const double normalize_cn0_v20 = sqrt((2.0 * n_d + 1.0) / (2.0 * n_d + 5.0));
     const double normalize_cn0_v21 = normalize_cn0_v20 * sqrt((n_d + 2.0) * (n_d + 3.0) / 2.0);
     const double normalize_cn0_v22 = normalize_cn0_v20 * sqrt((n_d + 1.0) * (n_d + 2.0) * (n_d + 3.0) * (n_d + 4.0) / 2.0);
 
-    for (m_ = 0; m_ <= n_; m_++) {
-      const double m_d = (double)m_;
+    for (size_t m = 0; m <= n; m++) {
+      const double m_d = (double)m;
 
       // dx/dx, dx/dy, dy/dy
-      if (m_ == 0) {
+      if (m == 0) {
         partial_derivative[0][0] +=
-            0.5 * (c_[n_][0] * v[n_ + 2][2] * normalize_cn0_v22 - c_[n_][0] * v[n_ + 2][0] * (n_d + 1.0) * (n_d + 2.0) * normalize_cn0_v20);
+            0.5 * (c_[n][0] * v(n + 2, 2) * normalize_cn0_v22 - c_[n][0] * v(n + 2, 0) * (n_d + 1.0) * (n_d + 2.0) * normalize_cn0_v20);
         partial_derivative[1][1] +=
-            0.5 * (-c_[n_][0] * v[n_ + 2][2] * normalize_cn0_v22 - c_[n_][0] * v[n_ + 2][0] * (n_d + 1.0) * (n_d + 2.0) * normalize_cn0_v20);
+            0.5 * (-c_[n][0] * v(n + 2, 2) * normalize_cn0_v22 - c_[n][0] * v(n + 2, 0) * (n_d + 1.0) * (n_d + 2.0) * normalize_cn0_v20);
 
-        partial_derivative[0][1] += 0.5 * (c_[n_][0] * w[n_ + 2][2] * normalize_cn0_v22);
-      } else if (m_ == 1) {
+        partial_derivative[0][1] += 0.5 * (c_[n][0] * w(n + 2, 2) * normalize_cn0_v22);
+      } else if (m == 1) {
         const double normalize_cn1_v21 = normalize_cn0_v20 * sqrt((n_d + 2.0) * (n_d + 3.0) / (n_d * (n_d + 1.0)));
         const double normalize_cn1_v21_with_coeff = n_d * (n_d + 1.0) * normalize_cn1_v21;
         const double normalize_cn1_v23 = normalize_cn0_v20 * sqrt((n_d + 2.0) * (n_d + 3.0) * (n_d + 4.0) * (n_d + 5.0));
 
-        partial_derivative[0][0] += 0.25 * ((c_[n_][1] * v[n_ + 2][3] + s_[n_][1] * w[n_ + 2][3]) * normalize_cn1_v23 -
-                                            (3.0 * c_[n_][1] * v[n_ + 2][1] + s_[n_][1] * w[n_ + 2][1]) * normalize_cn1_v21_with_coeff);
-        partial_derivative[1][1] += 0.25 * ((-c_[n_][1] * v[n_ + 2][3] - s_[n_][1] * w[n_ + 2][3]) * normalize_cn1_v23 -
-                                            (c_[n_][1] * v[n_ + 2][1] + 3.0 * s_[n_][1] * w[n_ + 2][1]) * normalize_cn1_v21_with_coeff);
+        partial_derivative[0][0] += 0.25 * ((c_[n][1] * v(n + 2, 3) + s_[n][1] * w(n + 2, 3)) * normalize_cn1_v23 -
+                                            (3.0 * c_[n][1] * v(n + 2, 1) + s_[n][1] * w(n + 2, 1)) * normalize_cn1_v21_with_coeff);
+        partial_derivative[1][1] += 0.25 * ((-c_[n][1] * v(n + 2, 3) - s_[n][1] * w(n + 2, 3)) * normalize_cn1_v23 -
+                                            (c_[n][1] * v(n + 2, 1) + 3.0 * s_[n][1] * w(n + 2, 1)) * normalize_cn1_v21_with_coeff);
 
-        partial_derivative[0][1] += 0.25 * ((c_[n_][1] * w[n_ + 2][3] - s_[n_][1] * v[n_ + 2][3]) * normalize_cn1_v23 -
-                                            (c_[n_][1] * w[n_ + 2][1] + s_[n_][1] * v[n_ + 2][1]) * normalize_cn1_v21_with_coeff);
-      } else if (m_ == 2) {
+        partial_derivative[0][1] += 0.25 * ((c_[n][1] * w(n + 2, 3) - s_[n][1] * v(n + 2, 3)) * normalize_cn1_v23 -
+                                            (c_[n][1] * w(n + 2, 1) + s_[n][1] * v(n + 2, 1)) * normalize_cn1_v21_with_coeff);
+      } else if (m == 2) {
         double normalize_cnm_v2p2 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) * (n_d + m_d + 3.0) * (n_d + m_d + 4.0));
         double normalize_cnm_v2m2 = normalize_cn0_v20 * sqrt(2.0 / ((n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0) * (n_d - m_d + 4.0)));
         double normalize_cnm_v2m2_with_coeff = (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0) * (n_d - m_d + 4.0) * normalize_cnm_v2m2;
         double normalize_cnm_v20 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) / ((n_d - m_d + 1.0) * (n_d - m_d + 2.0)));
         double normalize_cnm_v20_with_coeff = 2.0 * (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * normalize_cnm_v20;
 
-        partial_derivative[0][0] += 0.25 * ((c_[n_][m_] * v[n_ + 2][m_ + 2] + s_[n_][m_] * w[n_ + 2][m_ + 2]) * normalize_cnm_v2p2 -
-                                            (c_[n_][m_] * v[n_ + 2][m_] + s_[n_][m_] * w[n_ + 2][m_]) * normalize_cnm_v20_with_coeff +
-                                            (c_[n_][m_] * v[n_ + 2][m_ - 2] + s_[n_][m_] * w[n_ + 2][m_ - 2]) * normalize_cnm_v2m2_with_coeff);
-        partial_derivative[1][1] += 0.25 * ((-c_[n_][m_] * v[n_ + 2][m_ + 2] - s_[n_][m_] * w[n_ + 2][m_ + 2]) * normalize_cnm_v2p2 -
-                                            (c_[n_][m_] * v[n_ + 2][m_] + s_[n_][m_] * w[n_ + 2][m_]) * normalize_cnm_v20_with_coeff -
-                                            (c_[n_][m_] * v[n_ + 2][m_ - 2] + s_[n_][m_] * w[n_ + 2][m_ - 2]) * normalize_cnm_v2m2_with_coeff);
-        partial_derivative[0][1] += 0.25 * ((c_[n_][m_] * w[n_ + 2][m_ + 2] - s_[n_][m_] * v[n_ + 2][m_ + 2]) * normalize_cnm_v2p2 +
-                                            (-c_[n_][m_] * w[n_ + 2][m_ - 2] + s_[n_][m_] * v[n_ + 2][m_ - 2]) * normalize_cnm_v2m2_with_coeff);
+        partial_derivative[0][0] += 0.25 * ((c_[n][m] * v(n + 2, m + 2) + s_[n][m] * w(n + 2, m + 2)) * normalize_cnm_v2p2 -
+                                            (c_[n][m] * v(n + 2, m) + s_[n][m] * w(n + 2, m)) * normalize_cnm_v20_with_coeff +
+                                            (c_[n][m] * v(n + 2, m - 2) + s_[n][m] * w(n + 2, m - 2)) * normalize_cnm_v2m2_with_coeff);
+        partial_derivative[1][1] += 0.25 * ((-c_[n][m] * v(n + 2, m + 2) - s_[n][m] * w(n + 2, m + 2)) * normalize_cnm_v2p2 -
+                                            (c_[n][m] * v(n + 2, m) + s_[n][m] * w(n + 2, m)) * normalize_cnm_v20_with_coeff -
+                                            (c_[n][m] * v(n + 2, m - 2) + s_[n][m] * w(n + 2, m - 2)) * normalize_cnm_v2m2_with_coeff);
+        partial_derivative[0][1] += 0.25 * ((c_[n][m] * w(n + 2, m + 2) - s_[n][m] * v(n + 2, m + 2)) * normalize_cnm_v2p2 +
+                                            (-c_[n][m] * w(n + 2, m - 2) + s_[n][m] * v(n + 2, m - 2)) * normalize_cnm_v2m2_with_coeff);
       } else {
         double normalize_cnm_v2p2 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) * (n_d + m_d + 3.0) * (n_d + m_d + 4.0));
         double normalize_cnm_v2m2 = normalize_cn0_v20 * sqrt(1.0 / ((n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0) * (n_d - m_d + 4.0)));
@@ -181,44 +173,44 @@ math::Matrix<3, 3> GravityPotential::CalcPartialDerivative_xcxf_s2(const math::V
         double normalize_cnm_v20 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) / ((n_d - m_d + 1.0) * (n_d - m_d + 2.0)));
         double normalize_cnm_v20_with_coeff = 2.0 * (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * normalize_cnm_v20;
 
-        partial_derivative[0][0] += 0.25 * ((c_[n_][m_] * v[n_ + 2][m_ + 2] + s_[n_][m_] * w[n_ + 2][m_ + 2]) * normalize_cnm_v2p2 -
-                                            (c_[n_][m_] * v[n_ + 2][m_] + s_[n_][m_] * w[n_ + 2][m_]) * normalize_cnm_v20_with_coeff +
-                                            (c_[n_][m_] * v[n_ + 2][m_ - 2] + s_[n_][m_] * w[n_ + 2][m_ - 2]) * normalize_cnm_v2m2_with_coeff);
-        partial_derivative[1][1] += 0.25 * ((-c_[n_][m_] * v[n_ + 2][m_ + 2] - s_[n_][m_] * w[n_ + 2][m_ + 2]) * normalize_cnm_v2p2 -
-                                            (c_[n_][m_] * v[n_ + 2][m_] + s_[n_][m_] * w[n_ + 2][m_]) * normalize_cnm_v20_with_coeff -
-                                            (c_[n_][m_] * v[n_ + 2][m_ - 2] + s_[n_][m_] * w[n_ + 2][m_ - 2]) * normalize_cnm_v2m2_with_coeff);
-        partial_derivative[0][1] += 0.25 * ((c_[n_][m_] * w[n_ + 2][m_ + 2] - s_[n_][m_] * v[n_ + 2][m_ + 2]) * normalize_cnm_v2p2 +
-                                            (-c_[n_][m_] * w[n_ + 2][m_ - 2] + s_[n_][m_] * v[n_ + 2][m_ - 2]) * normalize_cnm_v2m2_with_coeff);
+        partial_derivative[0][0] += 0.25 * ((c_[n][m] * v(n + 2, m + 2) + s_[n][m] * w(n + 2, m + 2)) * normalize_cnm_v2p2 -
+                                            (c_[n][m] * v(n + 2, m) + s_[n][m] * w(n + 2, m)) * normalize_cnm_v20_with_coeff +
+                                            (c_[n][m] * v(n + 2, m - 2) + s_[n][m] * w(n + 2, m - 2)) * normalize_cnm_v2m2_with_coeff);
+        partial_derivative[1][1] += 0.25 * ((-c_[n][m] * v(n + 2, m + 2) - s_[n][m] * w(n + 2, m + 2)) * normalize_cnm_v2p2 -
+                                            (c_[n][m] * v(n + 2, m) + s_[n][m] * w(n + 2, m)) * normalize_cnm_v20_with_coeff -
+                                            (c_[n][m] * v(n + 2, m - 2) + s_[n][m] * w(n + 2, m - 2)) * normalize_cnm_v2m2_with_coeff);
+        partial_derivative[0][1] += 0.25 * ((c_[n][m] * w(n + 2, m + 2) - s_[n][m] * v(n + 2, m + 2)) * normalize_cnm_v2p2 +
+                                            (-c_[n][m] * w(n + 2, m - 2) + s_[n][m] * v(n + 2, m - 2)) * normalize_cnm_v2m2_with_coeff);
       }
       // dx/dz, dy/dz
-      if (m_ == 0) {
-        partial_derivative[0][2] += (n_d + 1.0) * (c_[n_][0] * v[n_ + 2][1] * normalize_cn0_v21);
-        partial_derivative[1][2] += (n_d + 1.0) * (c_[n_][0] * w[n_ + 2][1] * normalize_cn0_v21);
-      } else if (m_ == 1) {
+      if (m == 0) {
+        partial_derivative[0][2] += (n_d + 1.0) * (c_[n][0] * v(n + 2, 1) * normalize_cn0_v21);
+        partial_derivative[1][2] += (n_d + 1.0) * (c_[n][0] * w(n + 2, 1) * normalize_cn0_v21);
+      } else if (m == 1) {
         double normalize_cnm_v2p1 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) * (n_d + m_d + 3.0) / (n_d - m_d + 1.0));
         double normalize_cnm_v2p1_with_coeff = (n_d - m_d + 1.0) * normalize_cnm_v2p1;
         double normalize_cnm_v2m1 = normalize_cn0_v20 * sqrt(2.0 * (n_d + m_d + 1.0) / ((n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0)));
         double normalize_cnm_v2m1_with_coeff = (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0) * normalize_cnm_v2m1;
 
-        partial_derivative[0][2] += 0.5 * ((+c_[n_][m_] * v[n_ + 2][m_ + 1] + s_[n_][m_] * w[n_ + 2][m_ + 1]) * normalize_cnm_v2p1_with_coeff +
-                                           (-c_[n_][m_] * v[n_ + 2][m_ - 1] - s_[n_][m_] * w[n_ + 2][m_ - 1]) * normalize_cnm_v2m1_with_coeff);
-        partial_derivative[1][2] += 0.5 * ((+c_[n_][m_] * w[n_ + 2][m_ + 1] - s_[n_][m_] * v[n_ + 2][m_ + 1]) * normalize_cnm_v2p1_with_coeff +
-                                           (+c_[n_][m_] * w[n_ + 2][m_ - 1] - s_[n_][m_] * v[n_ + 2][m_ - 1]) * normalize_cnm_v2m1_with_coeff);
+        partial_derivative[0][2] += 0.5 * ((+c_[n][m] * v(n + 2, m + 1) + s_[n][m] * w(n + 2, m + 1)) * normalize_cnm_v2p1_with_coeff +
+                                           (-c_[n][m] * v(n + 2, m - 1) - s_[n][m] * w(n + 2, m - 1)) * normalize_cnm_v2m1_with_coeff);
+        partial_derivative[1][2] += 0.5 * ((+c_[n][m] * w(n + 2, m + 1) - s_[n][m] * v(n + 2, m + 1)) * normalize_cnm_v2p1_with_coeff +
+                                           (+c_[n][m] * w(n + 2, m - 1) - s_[n][m] * v(n + 2, m - 1)) * normalize_cnm_v2m1_with_coeff);
       } else {
         double normalize_cnm_v2p1 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) * (n_d + m_d + 3.0) / (n_d - m_d + 1.0));
         double normalize_cnm_v2p1_with_coeff = (n_d - m_d + 1.0) * normalize_cnm_v2p1;
         double normalize_cnm_v2m1 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) / ((n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0)));
         double normalize_cnm_v2m1_with_coeff = (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0) * normalize_cnm_v2m1;
 
-        partial_derivative[0][2] += 0.5 * ((+c_[n_][m_] * v[n_ + 2][m_ + 1] + s_[n_][m_] * w[n_ + 2][m_ + 1]) * normalize_cnm_v2p1_with_coeff +
-                                           (-c_[n_][m_] * v[n_ + 2][m_ - 1] - s_[n_][m_] * w[n_ + 2][m_ - 1]) * normalize_cnm_v2m1_with_coeff);
-        partial_derivative[1][2] += 0.5 * ((+c_[n_][m_] * w[n_ + 2][m_ + 1] - s_[n_][m_] * v[n_ + 2][m_ + 1]) * normalize_cnm_v2p1_with_coeff +
-                                           (+c_[n_][m_] * w[n_ + 2][m_ - 1] - s_[n_][m_] * v[n_ + 2][m_ - 1]) * normalize_cnm_v2m1_with_coeff);
+        partial_derivative[0][2] += 0.5 * ((+c_[n][m] * v(n + 2, m + 1) + s_[n][m] * w(n + 2, m + 1)) * normalize_cnm_v2p1_with_coeff +
+                                           (-c_[n][m] * v(n + 2, m - 1) - s_[n][m] * w(n + 2, m - 1)) * normalize_cnm_v2m1_with_coeff);
+        partial_derivative[1][2] += 0.5 * ((+c_[n][m] * w(n + 2, m + 1) - s_[n][m] * v(n + 2, m + 1)) * normalize_cnm_v2p1_with_coeff +
+                                           (+c_[n][m] * w(n + 2, m - 1) - s_[n][m] * v(n + 2, m - 1)) * normalize_cnm_v2m1_with_coeff);
       }
       // dz/dz
       double normalize_cnm_v20 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) / ((n_d - m_d + 1.0) * (n_d - m_d + 2.0)));
       double normalize_cnm_v20_with_coeff = (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * normalize_cnm_v20;
-      partial_derivative[2][2] += (c_[n_][m_] * v[n_ + 2][m_] + s_[n_][m_] * w[n_ + 2][m_]) * normalize_cnm_v20_with_coeff;
+      partial_derivative[2][2] += (c_[n][m] * v(n + 2, m) + s_[n][m] * w(n + 2, m)) * normalize_cnm_v20_with_coeff;
     }
   }
   // Symmetry property
@@ -227,55 +219,101 @@ math::Matrix<3, 3> GravityPotential::CalcPartialDerivative_xcxf_s2(const math::V
   partial_derivative[2][1] = partial_derivative[1][2];
 
   // Multiply common coefficients
-  partial_derivative *= gravity_constants_m3_s2_ / pow(center_body_radius_m_, 3.0);
+  partial_derivative *= gravity_constants_m3_s2_ / (center_body_radius_m_ * center_body_radius_m_ * center_body_radius_m_);
 
   return partial_derivative;
 }
 
-void GravityPotential::v_w_nn_update(double *v_nn, double *w_nn, const double v_prev, const double w_prev) {
-  if (n_ != m_) return;
-
-  const double n_d = (double)n_;
-
-  const double tmp = center_body_radius_m_ / pow(radius_m_, 2.0);
-  const double x_tmp = xcxf_x_m_ * tmp;
-  const double y_tmp = xcxf_y_m_ * tmp;
-  double c_normalize;
-  if (n_ == 1) {
-    c_normalize = (2.0 * n_d - 1.0) * sqrt(2.0 * n_d + 1.0);
-  } else {
-    c_normalize = sqrt((2.0 * n_d + 1.0) / (2.0 * n_d));
+void GravityPotential::CalcVw(const std::vector<math::Vector<3>> &positions_xcxf_m, const size_t degree_vw, std::vector<double> &v,
+                              std::vector<double> &w) const {
+  const size_t num_positions = positions_xcxf_m.size();
+  const size_t stride = degree_vw + 1;
+  v.assign(stride * stride * num_positions, 0.0);
+  w.assign(stride * stride * num_positions, 0.0);
+  const auto index = [stride, num_positions](const size_t n, const size_t m) { return (n * stride + m) * num_positions; };
+
+  // Position dependent factors
+  std::vector<double> x_tmp(num_positions), y_tmp(num_positions), z_tmp(num_positions), re_tmp(num_positions);
+  for (size_t i = 0; i < num_positions; i++) {
+    const double radius_m = positions_xcxf_m[i].CalcNorm();
+    const double tmp = center_body_radius_m_ / (radius_m * radius_m);
+    x_tmp[i] = positions_xcxf_m[i][0] * tmp;
+    y_tmp[i] = positions_xcxf_m[i][1] * tmp;
+    z_tmp[i] = positions_xcxf_m[i][2] * tmp;
+    re_tmp[i] = center_body_radius_m_ * tmp;
+    // n = m = 0
+    v[index(0, 0) + i] = center_body_radius_m_ / radius_m;
+    w[index(0, 0) + i] = 0.0;
   }
 
-  *v_nn = c_normalize * (x_tmp * v_prev - y_tmp * w_prev);
-  *w_nn = c_normalize * (x_tmp * w_prev + y_tmp * v_prev);
-  return;
+  for (size_t m = 0; m < degree_vw; m++) {
+    const double m_d = (double)m;
+    // n != m
+    for (size_t n = m + 1; n <= degree_vw; n++) {
+      const double n_d = (double)n;
+      const double c1 = (2.0 * n_d - 1.0) / (n_d - m_d);
+      const double c_normalize = sqrt(((2.0 * n_d + 1.0) * (n_d - m_d)) / ((2.0 * n_d - 1.0) * (n_d + m_d)));
+      const double *v_prev = &v[index(n - 1, m)];
+      const double *w_prev = &w[index(n - 1, m)];
+      double *v_nm = &v[index(n, m)];
+      double *w_nm = &w[index(n, m)];
+      if (n <= m + 1) {
+        for (size_t i = 0; i < num_positions; i++) {
+          v_nm[i] = c_normalize * c1 * z_tmp[i] * v_prev[i];
+          w_nm[i] = c_normalize * c1 * z_tmp[i] * w_prev[i];
+        }
+      } else {
+        const double c2 = (n_d + m_d - 1.0) / (n_d - m_d);
+        const double c2_normalize = sqrt(((2.0 * n_d - 1.0) * (n_d - m_d - 1.0)) / ((2.0 * n_d - 3.0) * (n_d + m_d - 1.0)));
+        const double *v_prev2 = &v[index(n - 2, m)];
+        const double *w_prev2 = &w[index(n - 2, m)];
+        for (size_t i = 0; i < num_positions; i++) {
+          v_nm[i] = c_normalize * (c1 * z_tmp[i] * v_prev[i] - c2 * c2_normalize * re_tmp[i] * v_prev2[i]);
+          w_nm[i] = c_normalize * (c1 * z_tmp[i] * w_prev[i] - c2 * c2_normalize * re_tmp[i] * w_prev2[i]);
+        }
+      }
+    }
+    // n = m
+    const size_t n = m + 1;
+    const double n_d = (double)n;
+    double c_normalize;
+    if (n == 1) {
+      c_normalize = (2.0 * n_d - 1.0) * sqrt(2.0 * n_d + 1.0);
+    } else {
+      c_normalize = sqrt((2.0 * n_d + 1.0) / (2.0 * n_d));
+    }
+    const double *v_prev = &v[index(n - 1, n - 1)];
+    const double *w_prev = &w[index(n - 1, n - 1)];
+    double *v_nn = &v[index(n, n)];
+    double *w_nn = &w[index(n, n)];
+    for (size_t i = 0; i < num_positions; i++) {
+      v_nn[i] = c_normalize * (x_tmp[i] * v_prev[i] - y_tmp[i] * w_prev[i]);
+      w_nn[i] = c_normalize * (x_tmp[i] * w_prev[i] + y_tmp[i] * v_prev[i]);
+    }
+  }
 }
 
-void GravityPotential::v_w_nm_update(double *v_nm, double *w_nm, const double v_prev, const double w_prev, const double v_prev2,
-                                     const double w_prev2) {
-  if (n_ == m_) return;
-
-  const double m_d = (double)m_;
-  const double n_d = (double)n_;
-
-  const double tmp = center_body_radius_m_ / pow(radius_m_, 2.0);
-  const double z_tmp = xcxf_z_m_ * tmp;
-  const double re_tmp = center_body_radius_m_ * tmp;
-  const double c1 = (2.0 * n_d - 1.0) / (n_d - m_d);
-  const double c2 = (n_d + m_d - 1.0) / (n_d - m_d);
-  double c_normalize, c2_normalize;
-
-  c_normalize = sqrt(((2.0 * n_d + 1.0) * (n_d - m_d)) / ((2.0 * n_d - 1.0) * (n_d + m_d)));
-  if (n_ <= 1) {
-    c2_normalize = 1.0;
-  } else {
-    c2_normalize = sqrt(((2.0 * n_d - 1.0) * (n_d - m_d - 1.0)) / ((2.0 * n_d - 3.0) * (n_d + m_d - 1.0)));
+bool ReadCoefficientsEgm96(const std::string file_name, const size_t degree, std::vector<std::vector<double>> &cosine_coefficients,
+                           std::vector<std::vector<double>> &sine_coefficients) {
+  cosine_coefficients.assign(degree + 1, std::vector<double>(degree + 1, 0.0));
+  sine_coefficients.assign(degree + 1, std::vector<double>(degree + 1, 0.0));
+  std::ifstream coefficients_file(file_name);
+  if (!coefficients_file.is_open()) return false;
+
+  size_t number_of_coefficients = ((degree + 1) * (degree + 2) / 2) - 3;  //-3 for C00,C10,C11
+  for (size_t i = 0; i < number_of_coefficients; i++) {
+    size_t n, m;
+    double c_nm_norm, s_nm_norm;
+    std::string line;
+    getline(coefficients_file, line);
+    std::istringstream streamline(line);
+    streamline >> n >> m >> c_nm_norm >> s_nm_norm;
+    if (!streamline || n > degree || m > n) continue;
+
+    cosine_coefficients[n][m] = c_nm_norm;
+    sine_coefficients[n][m] = s_nm_norm;
   }
-
-  *v_nm = c_normalize * (c1 * z_tmp * v_prev - c2 * c2_normalize * re_tmp * v_prev2);
-  *w_nm = c_normalize * (c1 * z_tmp * w_prev - c2 * c2_normalize * re_tmp * w_prev2);
-  return;
+  return true;
 }
 
 }  // namespace s2e::gravity
@@ -7,6 +7,7 @@
 #define S2E_LIBRARY_GRAVITY_GRAVITY_POTENTIAL_HPP_
 
 #include <environment/global/physical_constants.hpp>
+#include <string>
 #include <vector>
 
 #include "../math/matrix.hpp"
@@ -48,7 +49,16 @@ class GravityPotential {
    * @param [in] position_xcxf_m: Position of the spacecraft in the XCXF frame [m]
    * @return Acceleration in XCXF frame [m/s2]
    */
-  math::Vector<3> CalcAcceleration_xcxf_m_s2(const math::Vector<3> &position_xcxf_m);
+  math::Vector<3> CalcAcceleration_xcxf_m_s2(const math::Vector<3> &position_xcxf_m) const;
+  /**
+   * @fn CalcAcceleration_xcxf_m_s2
+   * @brief Calculate the high-order earth gravity in the XCXF frame for multiple positions at once
+   * @note Coefficients and normalization factors are loaded once per (n, m) and applied to all positions.
+   *       This function does not modify any member, so a single instance can be shared between threads.
+   * @param [in] positions_xcxf_m: Positions in the XCXF frame [m] (e.g. spacecraft in a constellation or RK stages)
+   * @return Accelerations in XCXF frame [m/s2] in the same order with the input positions
+   */
+  std::vector<math::Vector<3>> CalcAcceleration_xcxf_m_s2(const std::vector<math::Vector<3>> &positions_xcxf_m) const;
 
   /**
    * @fn CalcAcceleration_xcxf_m_s2
@@ -56,35 +66,44 @@ class GravityPotential {
    * @param [in] position_xcxf_m: Position of the spacecraft in the XCXF frame [m]
    * @return Partial derivative of acceleration in XCXF frame [-/s2]
    */
-  math::Matrix<3, 3> CalcPartialDerivative_xcxf_s2(const math::Vector<3> &position_xcxf_m);
+  math::Matrix<3, 3> CalcPartialDerivative_xcxf_s2(const math::Vector<3> &position_xcxf_m) const;
+
+  /**
+   * @fn GetDegree
+   * @brief Return maximum degree. Zero means the high-order gravity is not calculated.
+   */
+  inline size_t GetDegree() const { return degree_; }
 
  private:
   size_t degree_ = 0;                   //!< Maximum degree
-  size_t n_ = 0, m_ = 0;                //!< Degree and order (FIXME: follow naming rule)
   std::vector<std::vector<double>> c_;  //!< Cosine coefficients
   std::vector<std::vector<double>> s_;  //!< Sine coefficients
   double gravity_constants_m3_s2_;      //!< Gravity constant of the center body [m3/s2]
   double center_body_radius_m_;         //!< Radius of the center body [m]
 
-  // calculation
-  double radius_m_ = 0.0;                                    //!< Radius [m]
-  double xcxf_x_m_ = 0.0, xcxf_y_m_ = 0.0, xcxf_z_m_ = 0.0;  //!< Spacecraft position in XCXF frame [m]
-
   /**
-   * @fn v_w_nn_update
-   * @brief Calculate V and W function for n = m
-   * @note FIXME: fix function name
+   * @fn CalcVw
+   * @brief Calculate V and W functions for all positions
+   * @param [in] positions_xcxf_m: Positions in the XCXF frame [m]
+   * @param [in] degree_vw: Maximum degree of V and W functions
+   * @param [out] v: V functions stored as v[(n * (degree_vw + 1) + m) * positions_xcxf_m.size() + position index]
+   * @param [out] w: W functions stored with the same layout as v
    */
-  void v_w_nn_update(double *v_nn, double *w_nn, const double v_prev, const double w_prev);
-
-  /**
-   * @fn v_w_nm_update
-   * @brief Calculate V and W function for n not equal m
-   * @note FIXME: fix function name
-   */
-  void v_w_nm_update(double *v_nm, double *w_nm, const double v_prev, const double w_prev, const double v_prev2, const double w_prev2);
+  void CalcVw(const std::vector<math::Vector<3>> &positions_xcxf_m, const size_t degree_vw, std::vector<double> &v, std::vector<double> &w) const;
 };
 
+/**
+ * @fn ReadCoefficientsEgm96
+ * @brief Read the normalized coefficients of the EGM96 model
+ * @param [in] file_name: Coefficient file name
+ * @param [in] degree: Maximum degree to read
+ * @param [out] cosine_coefficients: Normalized cosine coefficients stored as [n][m]. C00, C10, and C11 are zero.
+ * @param [out] sine_coefficients: Normalized sine coefficients stored as [n][m]
+ * @return true: success, false: the file is not found
+ */
+bool ReadCoefficientsEgm96(const std::string file_name, const size_t degree, std::vector<std::vector<double>> &cosine_coefficients,
+                           std::vector<std::vector<double>> &sine_coefficients);
+
 }  // namespace s2e::gravity
 
 #endif  // S2E_LIBRARY_GRAVITY_GRAVITY_POTENTIAL_HPP_
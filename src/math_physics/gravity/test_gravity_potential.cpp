@@ -153,3 +153,46 @@ TEST(GravityPotential, PartialDerivative2) {
     }
   }
 }
+
+/**
+ * @brief Test for batch acceleration calculation
+ */
+TEST(GravityPotential, BatchAcceleration) {
+  const size_t degree = 10;
+
+  std::vector<std::vector<double>> c_;  //!< Cosine coefficients
+  std::vector<std::vector<double>> s_;  //!< Sine coefficients
+
+  // Unit coefficients
+  c_.assign(degree + 1, std::vector<double>(degree + 1, 1.0));
+  s_.assign(degree + 1, std::vector<double>(degree + 1, 1.0));
+
+  // Initialize GravityPotential
+  const s2e::gravity::GravityPotential gravity_potential_(degree, c_, s_, 1.0, 1.0);
+
+  // Positions
+  std::vector<s2e::math::Vector<3>> positions_xcxf_m(3);
+  positions_xcxf_m[0][0] = 1.0;
+  positions_xcxf_m[0][1] = 0.0;
+  positions_xcxf_m[0][2] = 0.0;
+  positions_xcxf_m[1][0] = 1.0;
+  positions_xcxf_m[1][1] = 1.0;
+  positions_xcxf_m[1][2] = 1.0;
+  positions_xcxf_m[2][0] = -1.2;
+  positions_xcxf_m[2][1] = 0.5;
+  positions_xcxf_m[2][2] = 0.8;
+
+  // Batch calculation should match the single position calculation
+  std::vector<s2e::math::Vector<3>> accelerations_xcxf_m_s2 = gravity_potential_.CalcAcceleration_xcxf_m_s2(positions_xcxf_m);
+  ASSERT_EQ(positions_xcxf_m.size(), accelerations_xcxf_m_s2.size());
+  const double accuracy = 1.0e-12;
+  for (size_t i = 0; i < positions_xcxf_m.size(); i++) {
+    s2e::math::Vector<3> acceleration_xcxf_m_s2 = gravity_potential_.CalcAcceleration_xcxf_m_s2(positions_xcxf_m[i]);
+    for (size_t j = 0; j < 3; j++) {
+      EXPECT_NEAR(acceleration_xcxf_m_s2[j], accelerations_xcxf_m_s2[i][j], accuracy);
+    }
+  }
+
+  // Empty input
+  EXPECT_EQ(0u, gravity_potential_.CalcAcceleration_xcxf_m_s2(std::vector<s2e::math::Vector<3>>()).size());
+}
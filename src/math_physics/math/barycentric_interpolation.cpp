@@ -0,0 +1,80 @@
+/**
+ * @file barycentric_interpolation.cpp
+ * @brief Lagrange interpolation weights with the barycentric form shared by multiple data sets on the same nodes
+ */
+
+#include "barycentric_interpolation.hpp"
+
+#include <cmath>
+
+namespace s2e::math {
+
+void BarycentricInterpolation::SetNodes(const double* nodes, const size_t number_of_nodes) {
+  nodes_.assign(nodes, nodes + number_of_nodes);
+  node_weights_.assign(number_of_nodes, 1.0);
+  for (size_t i = 0; i < number_of_nodes; i++) {
+    for (size_t j = 0; j < number_of_nodes; j++) {
+      if (i == j) continue;
+      node_weights_[i] *= CalcNodeDistance(nodes_[i], nodes_[j]);
+    }
+    node_weights_[i] = 1.0 / node_weights_[i];
+  }
+}
+
+void BarycentricInterpolation::CalcBasis(const double x, double* basis) const {
+  // l(x) = prod(d(x, x_j)), basis_i = l(x) * w_i / d(x, x_i)
+  double node_polynomial = 1.0;
+  for (size_t i = 0; i < nodes_.size(); i++) {
+    const double distance = CalcNodeDistance(x, nodes_[i]);
+    if (distance == 0.0) {
+      // x is on the node
+      for (size_t j = 0; j < nodes_.size(); j++) basis[j] = 0.0;
+      basis[i] = 1.0;
+      return;
+    }
+    basis[i] = node_weights_[i] / distance;
+    node_polynomial *= distance;
+  }
+  for (size_t i = 0; i < nodes_.size(); i++) basis[i] *= node_polynomial;
+}
+
+void BarycentricInterpolation::CalcBasisDerivative(const double x, double* basis_derivative) const {
+  const size_t number_of_nodes = nodes_.size();
+  for (size_t i = 0; i < number_of_nodes; i++) {
+    if (CalcNodeDistance(x, nodes_[i]) != 0.0) continue;
+    // x is on the node i
+    // d(basis_k)/dx = d'_i * w_k / (w_i * d(x_i, x_k)), d(basis_i)/dx = sum(d'_j / d(x_i, x_j))
+    basis_derivative[i] = 0.0;
+    for (size_t k = 0; k < number_of_nodes; k++) {
+      if (k == i) continue;
+      const double distance = CalcNodeDistance(x, nodes_[k]);
+      basis_derivative[k] = CalcNodeDistanceDerivative(x, nodes_[i]) * node_weights_[k] / (node_weights_[i] * distance);
+      basis_derivative[i] += CalcNodeDistanceDerivative(x, nodes_[k]) / distance;
+    }
+    return;
+  }
+
+  // d(basis_k)/dx = basis_k * sum_{j != k}(d'_j / d_j)
+  // The sum is calculated without k instead of subtracting it to avoid the cancellation near the node k.
+  CalcBasis(x, basis_derivative);
+  for (size_t k = 0; k < number_of_nodes; k++) {
+    double sum_of_logarithmic_derivative = 0.0;
+    for (size_t j = 0; j < number_of_nodes; j++) {
+      if (j == k) continue;
+      sum_of_logarithmic_derivative += CalcNodeDistanceDerivative(x, nodes_[j]) / CalcNodeDistance(x, nodes_[j]);
+    }
+    basis_derivative[k] *= sum_of_logarithmic_derivative;
+  }
+}
+
+double BarycentricInterpolation::CalcNodeDistance(const double x1, const double x2) const {
+  if (type_ == BarycentricInterpolationType::kTrigonometric) return sin(period_ * (x1 - x2) / 2.0);
+  return x1 - x2;
+}
+
+double BarycentricInterpolation::CalcNodeDistanceDerivative(const double x1, const double x2) const {
+  if (type_ == BarycentricInterpolationType::kTrigonometric) return period_ / 2.0 * cos(period_ * (x1 - x2) / 2.0);
+  return 1.0;
+}
+
+}  // namespace s2e::math
@@ -0,0 +1,98 @@
+/**
+ * @file barycentric_interpolation.hpp
+ * @brief Lagrange interpolation weights with the barycentric form shared by multiple data sets on the same nodes
+ */
+
+#ifndef S2E_LIBRARY_MATH_BARYCENTRIC_INTERPOLATION_HPP_
+#define S2E_LIBRARY_MATH_BARYCENTRIC_INTERPOLATION_HPP_
+
+#include <cstddef>
+#include <vector>
+
+namespace s2e::math {
+
+/**
+ * @enum BarycentricInterpolationType
+ * @brief Basis function type of the interpolation
+ */
+enum class BarycentricInterpolationType {
+  kPolynomial,     //!< Lagrange polynomial
+  kTrigonometric,  //!< Trigonometric Lagrange basis. The number of nodes should be odd.
+};
+
+/**
+ * @class BarycentricInterpolation
+ * @brief Lagrange interpolation weights with the barycentric form
+ * @note The node weights are calculated once when the nodes are set (O(n^2)), and the basis at a target point is calculated in O(n).
+ *       The interpolated value is sum(basis[i] * y[i]), so the same basis is applied to all data sets sharing the nodes.
+ *       Ref: J.-P. Berrut and L. N. Trefethen, Barycentric Lagrange Interpolation, SIAM Review 46(3), 2004
+ */
+class BarycentricInterpolation {
+ public:
+  /**
+   * @fn BarycentricInterpolation
+   * @brief Constructor
+   * @param [in] type: Basis function type
+   * @param [in] period: Characteristic period (angular rate) for the trigonometric basis
+   */
+  BarycentricInterpolation(const BarycentricInterpolationType type = BarycentricInterpolationType::kPolynomial, const double period = 1.0)
+      : type_(type), period_(period) {}
+
+  /**
+   * @fn SetNodes
+   * @brief Set the nodes and calculate the node weights
+   * @param [in] nodes: Independent variables of the nodes. They must be different from each other.
+   * @param [in] number_of_nodes: Number of nodes
+   */
+  void SetNodes(const double* nodes, const size_t number_of_nodes);
+
+  /**
+   * @fn CalcBasis
+   * @brief Calculate the basis at the target independent variable
+   * @param [in] x: Target independent variable
+   * @param [out] basis: Basis of each node. The size must be equal to the number of nodes.
+   */
+  void CalcBasis(const double x, double* basis) const;
+
+  /**
+   * @fn CalcBasisDerivative
+   * @brief Calculate the derivative of the basis with respect to the independent variable at the target point
+   * @param [in] x: Target independent variable
+   * @param [out] basis_derivative: Derivative of the basis of each node. The size must be equal to the number of nodes.
+   */
+  void CalcBasisDerivative(const double x, double* basis_derivative) const;
+
+  /**
+   * @fn SetPeriod
+   * @brief Set the characteristic period of the trigonometric basis
+   * @note The node weights are updated at the next SetNodes
+   * @param [in] period: Characteristic period (angular rate) for the trigonometric basis
+   */
+  inline void SetPeriod(const double period) { period_ = period; }
+  /**
+   * @fn GetNumberOfNodes
+   * @brief Return number of nodes
+   */
+  inline size_t GetNumberOfNodes() const { return nodes_.size(); }
+
+ private:
+  BarycentricInterpolationType type_;  //!< Basis function type
+  double period_;                      //!< Characteristic period for the trigonometric basis
+  std::vector<double> nodes_;          //!< Independent variables of the nodes
+  std::vector<double> node_weights_;   //!< Barycentric weights of the nodes
+
+  /**
+   * @fn CalcNodeDistance
+   * @brief Return the distance between independent variables in the basis function space
+   */
+  double CalcNodeDistance(const double x1, const double x2) const;
+  /**
+   * @fn CalcNodeDistanceDerivative
+   * @brief Return the derivative of the distance with respect to x1
+   */
+  double CalcNodeDistanceDerivative(const double x1, const double x2) const;
+};
+
+}  // namespace s2e::math
+
+#endif  // S2E_LIBRARY_MATH_BARYCENTRIC_INTERPOLATION_HPP_
@@ -0,0 +1,71 @@
+/**
+ * @file chebyshev_interpolation.cpp
+ * @brief Chebyshev polynomial approximation of a vector function over a fixed interval
+ */
+
+#include "chebyshev_interpolation.hpp"
+
+#include <cmath>
+
+#include "constants.hpp"
+
+namespace s2e::math {
+
+ChebyshevInterpolation::ChebyshevInterpolation(const double start, const double end, const std::vector<std::vector<double>>& values_at_nodes)
+    : start_(start), end_(end) {
+  if (values_at_nodes.empty() || values_at_nodes[0].empty()) return;
+
+  const size_t number_of_nodes = values_at_nodes.size();
+  degree_ = number_of_nodes - 1;
+  dimension_ = values_at_nodes[0].size();
+  coefficients_.assign(number_of_nodes * dimension_, 0.0);
+
+  // Discrete orthogonality of the Chebyshev polynomials at the nodes
+  for (size_t order = 0; order < number_of_nodes; order++) {
+    for (size_t node = 0; node < number_of_nodes; node++) {
+      const double weight = 2.0 / number_of_nodes * cos(pi * order * (node + 0.5) / number_of_nodes);
+      for (size_t i = 0; i < dimension_; i++) {
+        coefficients_[order * dimension_ + i] += weight * values_at_nodes[node][i];
+      }
+    }
+  }
+  for (size_t i = 0; i < dimension_; i++) {
+    coefficients_[i] *= 0.5;
+  }
+}
+
+ChebyshevInterpolation::ChebyshevInterpolation(const double start, const double end, const size_t dimension, const std::vector<double>& coefficients)
+    : start_(start), end_(end) {
+  if (dimension == 0 || coefficients.empty() || coefficients.size() % dimension != 0) return;
+
+  degree_ = coefficients.size() / dimension - 1;
+  dimension_ = dimension;
+  coefficients_ = coefficients;
+}
+
+std::vector<double> ChebyshevInterpolation::CalcNodes(const double start, const double end, const size_t degree) {
+  const size_t number_of_nodes = degree + 1;
+  std::vector<double> nodes(number_of_nodes);
+  for (size_t node = 0; node < number_of_nodes; node++) {
+    const double normalized_node = cos(pi * (node + 0.5) / number_of_nodes);
+    nodes[node] = 0.5 * (end + start) + 0.5 * (end - start) * normalized_node;
+  }
+  return nodes;
+}
+
+void ChebyshevInterpolation::CalcValue(const double x, double* value) const {
+  const double normalized_x = (2.0 * x - start_ - end_) / (end_ - start_);
+  for (size_t i = 0; i < dimension_; i++) {
+    // Clenshaw's recurrence
+    double b_1 = 0.0;
+    double b_2 = 0.0;
+    for (size_t order = degree_; order > 0; order--) {
+      const double b_0 = 2.0 * normalized_x * b_1 - b_2 + coefficients_[order * dimension_ + i];
+      b_2 = b_1;
+      b_1 = b_0;
+    }
+    value[i] = normalized_x * b_1 - b_2 + coefficients_[i];
+  }
+}
+
+}  // namespace s2e::math
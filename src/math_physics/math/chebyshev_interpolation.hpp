@@ -0,0 +1,104 @@
+/**
+ * @file chebyshev_interpolation.hpp
+ * @brief Chebyshev polynomial approximation of a vector function over a fixed interval
+ */
+
+#ifndef S2E_LIBRARY_MATH_CHEBYSHEV_INTERPOLATION_HPP_
+#define S2E_LIBRARY_MATH_CHEBYSHEV_INTERPOLATION_HPP_
+
+#include <cstddef>
+#include <vector>
+
+namespace s2e::math {
+
+/**
+ * @class ChebyshevInterpolation
+ * @brief Chebyshev polynomial approximation of a vector function over a fixed interval
+ * @note The function is sampled at the Chebyshev nodes given by CalcNodes, and the approximation is evaluated with Clenshaw's recurrence.
+ *       Ref: Numerical Recipes in C, Section. 5.8
+ */
+class ChebyshevInterpolation {
+ public:
+  /**
+   * @fn ChebyshevInterpolation
+   * @brief Default constructor for an empty approximation. IsInRange always returns false.
+   */
+  ChebyshevInterpolation() {}
+  /**
+   * @fn ChebyshevInterpolation
+   * @brief Constructor
+   * @param [in] start: Start of the interval
+   * @param [in] end: End of the interval
+   * @param [in] values_at_nodes: Function values at the nodes calculated by CalcNodes(start, end, degree) stored as [node][dimension]
+   */
+  ChebyshevInterpolation(const double start, const double end, const std::vector<std::vector<double>>& values_at_nodes);
+  /**
+   * @fn ChebyshevInterpolation
+   * @brief Constructor with precalculated coefficients
+   * @param [in] start: Start of the interval
+   * @param [in] end: End of the interval
+   * @param [in] dimension: Dimension of the function value
+   * @param [in] coefficients: Chebyshev coefficients stored as [order * dimension + dimension index]
+   */
+  ChebyshevInterpolation(const double start, const double end, const size_t dimension, const std::vector<double>& coefficients);
+
+  /**
+   * @fn CalcNodes
+   * @brief Calculate the Chebyshev nodes in the interval
+   * @param [in] start: Start of the interval
+   * @param [in] end: End of the interval
+   * @param [in] degree: Degree of the approximation
+   * @return Nodes (the number is degree + 1)
+   */
+  static std::vector<double> CalcNodes(const double start, const double end, const size_t degree);
+
+  /**
+   * @fn CalcValue
+   * @brief Evaluate the approximation
+   * @param [in] x: Target independent variable in the interval
+   * @param [out] value: Approximated value. The size must be equal to the dimension.
+   */
+  void CalcValue(const double x, double* value) const;
+
+  /**
+   * @fn IsInRange
+   * @brief Return true when x is in the interval
+   */
+  inline bool IsInRange(const double x) const { return dimension_ > 0 && x >= start_ && x <= end_; }
+  /**
+   * @fn GetDegree
+   * @brief Return degree of the approximation
+   */
+  inline size_t GetDegree() const { return degree_; }
+  /**
+   * @fn GetDimension
+   * @brief Return dimension of the function value
+   */
+  inline size_t GetDimension() const { return dimension_; }
+  /**
+   * @fn GetStart
+   * @brief Return start of the interval
+   */
+  inline double GetStart() const { return start_; }
+  /**
+   * @fn GetEnd
+   * @brief Return end of the interval
+   */
+  inline double GetEnd() const { return end_; }
+  /**
+   * @fn GetCoefficients
+   * @brief Return Chebyshev coefficients stored as [order * dimension + dimension index]
+   */
+  inline const std::vector<double>& GetCoefficients() const { return coefficients_; }
+
+ private:
+  double start_ = 0.0;                //!< Start of the interval
+  double end_ = 0.0;                  //!< End of the interval
+  size_t degree_ = 0;                 //!< Degree of the approximation
+  size_t dimension_ = 0;              //!< Dimension of the function value
+  std::vector<double> coefficients_;  //!< Chebyshev coefficients stored as [order * dimension_ + dimension index]
+};
+
+}  // namespace s2e::math
+
+#endif  // S2E_LIBRARY_MATH_CHEBYSHEV_INTERPOLATION_HPP_
@@ -5,26 +5,47 @@
 
 #include "interpolation.hpp"
 
+#include <algorithm>
 #include <cmath>
 
 namespace s2e::math {
 
+Interpolation::Interpolation(const std::vector<double>& independent_variables, const std::vector<double>& dependent_variables) {
+  degree_ = independent_variables.size();
+  if (degree_ < 2) {
+    std::cout << "[WARNINGS] Interpolation degree is smaller than 2" << std::endl;
+  }
+  independent_variables_.assign(2 * degree_, 0.0);
+  dependent_variables_.assign(2 * degree_, 0.0);
+  for (size_t i = 0; i < degree_; i++) {
+    independent_variables_[i] = independent_variables_[i + degree_] = independent_variables[i];
+    dependent_variables_[i] = dependent_variables_[i + degree_] = i < dependent_variables.size() ? dependent_variables[i] : 0.0;
+  }
+  up_diff_.assign(degree_, 0.0);
+  down_diff_.assign(degree_, 0.0);
+}
+
 double Interpolation::CalcPolynomial(const double x) const {
+  const double* independent_variables = GetIndependentVariables();
+  const double* dependent_variables = GetDependentVariables();
+
   // Search nearest point
   size_t nearest_x_id = FindNearestPoint(x);
 
   // Neville's algorithm
-  double y_output = dependent_variables_[nearest_x_id];
-  std::vector<double> down_diff = dependent_variables_;
-  std::vector<double> up_diff = dependent_variables_;
+  double y_output = dependent_variables[nearest_x_id];
+  std::vector<double>& down_diff = down_diff_;
+  std::vector<double>& up_diff = up_diff_;
+  std::copy(dependent_variables, dependent_variables + degree_, down_diff.begin());
+  std::copy(dependent_variables, dependent_variables + degree_, up_diff.begin());
   size_t d_idx = 1;
   for (size_t m = 1; m < degree_; m++) {
     // Calculate C and D
     for (size_t i = 0; i < degree_ - m; i++) {
-      double denominator = independent_variables_[i] - independent_variables_[i + m];
+      double denominator = independent_variables[i] - independent_variables[i + m];
       double down_minus_up = down_diff[i + 1] - up_diff[i];
-      up_diff[i] = (independent_variables_[i + m] - x) * down_minus_up / denominator;
-      down_diff[i] = (independent_variables_[i] - x) * down_minus_up / denominator;
+      up_diff[i] = (independent_variables[i + m] - x) * down_minus_up / denominator;
+      down_diff[i] = (independent_variables[i] - x) * down_minus_up / denominator;
     }
 
     // Upstream first calculation
@@ -42,6 +63,8 @@ double Interpolation::CalcPolynomial(const double x) const {
 }
 
 double Interpolation::CalcTrigonometric(const double x, const double period) const {
+  const double* independent_variables = GetIndependentVariables();
+  const double* dependent_variables = GetDependentVariables();
   double y_output = 0.0;
   size_t end_id = degree_;
   size_t start_id = 0;
@@ -62,30 +85,31 @@ double Interpolation::CalcTrigonometric(const double x, const double period) con
     double t_k = 1.0;
     for (size_t j = start_id; j < end_id; ++j) {
       if (i == j) continue;
-      t_k *= sin(period * (x - independent_variables_[j]) / 2.0) / sin(period * (independent_variables_[i] - independent_variables_[j]) / 2.0);
+      t_k *= sin(period * (x - independent_variables[j]) / 2.0) / sin(period * (independent_variables[i] - independent_variables[j]) / 2.0);
     }
-    y_output += t_k * dependent_variables_[i];
+    y_output += t_k * dependent_variables[i];
   }
 
   return y_output;
 }
 
 bool Interpolation::PushAndPopData(const double independent_variable, const double dependent_variable) {
-  if (independent_variable <= independent_variables_.back()) {
+  if (degree_ == 0 || independent_variable <= GetIndependentVariables()[degree_ - 1]) {
     return false;
   }
-  independent_variables_.erase(independent_variables_.begin());
-  independent_variables_.push_back(independent_variable);
-  dependent_variables_.erase(dependent_variables_.begin());
-  dependent_variables_.push_back(dependent_variable);
+  // Overwrite the oldest data with the new data and move the head to the next oldest data
+  independent_variables_[head_] = independent_variables_[head_ + degree_] = independent_variable;
+  dependent_variables_[head_] = dependent_variables_[head_ + degree_] = dependent_variable;
+  head_ = (head_ + 1) % degree_;
   return true;
 }
 
 size_t Interpolation::FindNearestPoint(const double x) const {
+  const double* independent_variables = GetIndependentVariables();
   size_t output = 0;
-  double difference1 = fabs(x - independent_variables_[0]);
+  double difference1 = fabs(x - independent_variables[0]);
   for (size_t i = 0; i < degree_; i++) {
-    double difference2 = fabs(x - independent_variables_[i]);
+    double difference2 = fabs(x - independent_variables[i]);
     if (difference2 < difference1) {
       difference1 = difference2;
       output = i;
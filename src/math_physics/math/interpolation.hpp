@@ -14,6 +14,10 @@ namespace s2e::math {
 /**
  * @class Interpolation
  * @brief Class for interpolation calculation
+ * @note The data are stored in a fixed capacity ring buffer. Each data is written twice (at i and i + degree) so that the current window is always
+ *       contiguous from the head, and sliding the window with PushAndPopData does not move or allocate memory.
+ * @note CalcPolynomial is const but uses the mutable work space in this class. It is not reentrant, so that an instance must not be used from
+ *       multiple threads at the same time.
  */
 class Interpolation {
  public:
@@ -24,13 +28,7 @@ class Interpolation {
    * @param[in] independent_variables: Set of independent variables
    * @param[in] dependent_variables: Set of independent variables
    */
-  inline Interpolation(std::vector<double> independent_variables, std::vector<double> dependent_variables)
-      : independent_variables_(independent_variables), dependent_variables_(dependent_variables) {
-    degree_ = independent_variables_.size();
-    if (degree_ < 2) {
-      std::cout << "[WARNINGS] Interpolation degree is smaller than 2" << std::endl;
-    }
-  }
+  Interpolation(const std::vector<double>& independent_variables, const std::vector<double>& dependent_variables);
 
   /**
    * @fn CalcPolynomial
@@ -67,19 +65,24 @@ class Interpolation {
   inline size_t GetDegree() const { return degree_; }
   /**
    * @fn GetIndependentVariables
-   * @return List of independent variables
+   * @return Contiguous list of independent variables from the oldest data. The size is the degree.
+   * @note The list is valid until the next PushAndPopData
    */
-  inline std::vector<double> GetIndependentVariables() const { return independent_variables_; }
+  inline const double* GetIndependentVariables() const { return independent_variables_.data() + head_; }
   /**
    * @fn GetDependentVariables
-   * @return List of dependent variables
+   * @return Contiguous list of dependent variables from the oldest data. The size is the degree.
+   * @note The list is valid until the next PushAndPopData
    */
-  inline std::vector<double> GetDependentVariables() const { return dependent_variables_; }
+  inline const double* GetDependentVariables() const { return dependent_variables_.data() + head_; }
 
  private:
-  std::vector<double> independent_variables_{0.0};  //!< List of independent variable
-  std::vector<double> dependent_variables_{0.0};    //!< List of dependent variable
-  size_t degree_;                                   //!< Degree of interpolation
+  std::vector<double> independent_variables_;  //!< Ring buffer of independent variable (twice of the degree)
+  std::vector<double> dependent_variables_;    //!< Ring buffer of dependent variable (twice of the degree)
+  size_t degree_;                              //!< Degree of interpolation
+  size_t head_ = 0;                            //!< Position of the oldest data in the ring buffer
+  mutable std::vector<double> up_diff_;        //!< Work space of Neville's algorithm
+  mutable std::vector<double> down_diff_;      //!< Work space of Neville's algorithm
 
   /**
    * @fn FindNearestPoint
@@ -0,0 +1,96 @@
+/**
+ * @file test_barycentric_interpolation.cpp
+ * @brief Test codes for BarycentricInterpolation class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "barycentric_interpolation.hpp"
+#include "interpolation.hpp"
+
+using namespace s2e::math;
+
+/**
+ * @brief Test for polynomial basis compared with Neville's algorithm
+ */
+TEST(BarycentricInterpolation, Polynomial) {
+  std::vector<double> x{0.0, 1.0, 2.5, 3.0, 4.2, 5.0};
+  std::vector<double> y1, y2;
+  for (size_t i = 0; i < x.size(); i++) {
+    y1.push_back(pow(x[i], 5.0) - 2.0 * x[i]);
+    y2.push_back(exp(0.3 * x[i]));
+  }
+  Interpolation interpolation1(x, y1);
+  Interpolation interpolation2(x, y2);
+
+  BarycentricInterpolation barycentric(BarycentricInterpolationType::kPolynomial);
+  barycentric.SetNodes(x.data(), x.size());
+  EXPECT_EQ(x.size(), barycentric.GetNumberOfNodes());
+
+  std::vector<double> basis(x.size());
+  for (double xx = -0.5; xx < 5.5; xx += 0.1) {
+    barycentric.CalcBasis(xx, basis.data());
+    double value1 = 0.0, value2 = 0.0;
+    for (size_t i = 0; i < x.size(); i++) {
+      value1 += basis[i] * y1[i];
+      value2 += basis[i] * y2[i];
+    }
+    EXPECT_NEAR(interpolation1.CalcPolynomial(xx), value1, 1e-9);
+    EXPECT_NEAR(interpolation2.CalcPolynomial(xx), value2, 1e-12);
+  }
+
+  // The basis is the Kronecker delta on the nodes
+  barycentric.CalcBasis(x[2], basis.data());
+  for (size_t i = 0; i < x.size(); i++) {
+    EXPECT_DOUBLE_EQ(i == 2 ? 1.0 : 0.0, basis[i]);
+  }
+}
+
+/**
+ * @brief Test for trigonometric basis compared with Interpolation class
+ */
+TEST(BarycentricInterpolation, Trigonometric) {
+  const double period = 0.7;
+  std::vector<double> x{0.0, 0.8, 1.5, 2.4, 3.3};
+  std::vector<double> y;
+  for (size_t i = 0; i < x.size(); i++) {
+    y.push_back(2.0 * sin(period * x[i]) + cos(period * x[i]) + 0.5);
+  }
+  Interpolation interpolation(x, y);
+
+  BarycentricInterpolation barycentric(BarycentricInterpolationType::kTrigonometric, period);
+  barycentric.SetNodes(x.data(), x.size());
+
+  std::vector<double> basis(x.size());
+  for (double xx = 0.05; xx < 3.3; xx += 0.1) {
+    barycentric.CalcBasis(xx, basis.data());
+    double value = 0.0;
+    for (size_t i = 0; i < x.size(); i++) value += basis[i] * y[i];
+    EXPECT_NEAR(interpolation.CalcTrigonometric(xx, period), value, 1e-12);
+    EXPECT_NEAR(2.0 * sin(period * xx) + cos(period * xx) + 0.5, value, 1e-12);
+  }
+}
+
+/**
+ * @brief Test for derivative of the basis compared with numerical differentiation
+ */
+TEST(BarycentricInterpolation, BasisDerivative) {
+  std::vector<double> x{0.0, 0.8, 1.5, 2.4, 3.3};
+  std::vector<BarycentricInterpolation> interpolations{BarycentricInterpolation(BarycentricInterpolationType::kPolynomial),
+                                                       BarycentricInterpolation(BarycentricInterpolationType::kTrigonometric, 0.7)};
+  for (BarycentricInterpolation& interpolation : interpolations) {
+    interpolation.SetNodes(x.data(), x.size());
+    std::vector<double> derivative(x.size()), basis_plus(x.size()), basis_minus(x.size());
+    const double h = 1e-6;
+    // Include the point on the node
+    for (double xx = 0.0; xx < 3.4; xx += 0.1) {
+      interpolation.CalcBasisDerivative(xx, derivative.data());
+      interpolation.CalcBasis(xx + h, basis_plus.data());
+      interpolation.CalcBasis(xx - h, basis_minus.data());
+      for (size_t i = 0; i < x.size(); i++) {
+        EXPECT_NEAR((basis_plus[i] - basis_minus[i]) / (2.0 * h), derivative[i], 1e-6);
+      }
+    }
+  }
+}
@@ -0,0 +1,94 @@
+/**
+ * @file test_chebyshev_interpolation.cpp
+ * @brief Test codes for ChebyshevInterpolation class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "chebyshev_interpolation.hpp"
+
+/**
+ * @brief Test for polynomial function which is exactly expressed by the approximation
+ */
+TEST(ChebyshevInterpolation, Polynomial) {
+  const double start = -2.0;
+  const double end = 5.0;
+  const size_t degree = 3;
+  auto function = [](const double x) { return 1.0 - 2.0 * x + 0.5 * x * x * x; };
+
+  const std::vector<double> nodes = s2e::math::ChebyshevInterpolation::CalcNodes(start, end, degree);
+  ASSERT_EQ(degree + 1, nodes.size());
+  std::vector<std::vector<double>> values;
+  for (const double node : nodes) {
+    EXPECT_TRUE(node > start && node < end);
+    values.push_back({function(node), 3.0});
+  }
+  s2e::math::ChebyshevInterpolation interpolation(start, end, values);
+  EXPECT_EQ(degree, interpolation.GetDegree());
+  EXPECT_EQ(2, interpolation.GetDimension());
+
+  for (double x = start; x <= end; x += 0.35) {
+    double value[2];
+    interpolation.CalcValue(x, value);
+    EXPECT_NEAR(function(x), value[0], 1e-12);
+    EXPECT_NEAR(3.0, value[1], 1e-12);
+  }
+}
+
+/**
+ * @brief Test for circular motion approximation
+ */
+TEST(ChebyshevInterpolation, CircularMotion) {
+  const double start = 1000.0;
+  const double end = 1000.0 + 86400.0;
+  const double angular_velocity_rad_s = 2.66e-6;  // Approximately the moon orbit
+  const size_t degree = 12;
+
+  std::vector<std::vector<double>> values;
+  for (const double t : s2e::math::ChebyshevInterpolation::CalcNodes(start, end, degree)) {
+    values.push_back({cos(angular_velocity_rad_s * t), sin(angular_velocity_rad_s * t)});
+  }
+  s2e::math::ChebyshevInterpolation interpolation(start, end, values);
+
+  EXPECT_TRUE(interpolation.IsInRange(start));
+  EXPECT_TRUE(interpolation.IsInRange(end));
+  EXPECT_FALSE(interpolation.IsInRange(start - 1.0));
+  EXPECT_FALSE(interpolation.IsInRange(end + 1.0));
+  EXPECT_FALSE(s2e::math::ChebyshevInterpolation().IsInRange(start));
+
+  for (double t = start; t <= end; t += 1234.5) {
+    double value[2];
+    interpolation.CalcValue(t, value);
+    EXPECT_NEAR(cos(angular_velocity_rad_s * t), value[0], 1e-13);
+    EXPECT_NEAR(sin(angular_velocity_rad_s * t), value[1], 1e-13);
+  }
+}
+
+/**
+ * @brief Test for reconstruction from coefficients
+ */
+TEST(ChebyshevInterpolation, ConstructWithCoefficients) {
+  const double start = 0.0;
+  const double end = 10.0;
+  std::vector<std::vector<double>> values;
+  for (const double x : s2e::math::ChebyshevInterpolation::CalcNodes(start, end, 5)) {
+    values.push_back({exp(-0.1 * x), x * x});
+  }
+  const s2e::math::ChebyshevInterpolation original(start, end, values);
+  const s2e::math::ChebyshevInterpolation copied(original.GetStart(), original.GetEnd(), original.GetDimension(), original.GetCoefficients());
+  EXPECT_EQ(original.GetDegree(), copied.GetDegree());
+  EXPECT_EQ(original.GetDimension(), copied.GetDimension());
+
+  for (double x = start; x <= end; x += 0.7) {
+    double original_value[2];
+    double copied_value[2];
+    original.CalcValue(x, original_value);
+    copied.CalcValue(x, copied_value);
+    EXPECT_DOUBLE_EQ(original_value[0], copied_value[0]);
+    EXPECT_DOUBLE_EQ(original_value[1], copied_value[1]);
+  }
+
+  // Inconsistent size
+  EXPECT_FALSE(s2e::math::ChebyshevInterpolation(start, end, 2, {1.0, 2.0, 3.0}).IsInRange(1.0));
+}
@@ -117,3 +117,24 @@ TEST(Interpolation, PushAndPop) {
   ret = interpolation.PushAndPopData(1.0, 10.0);
   EXPECT_FALSE(ret);
 }
+
+/**
+ * @brief Test for PushAndPop function over the ring buffer wrap around
+ */
+TEST(Interpolation, PushAndPopWrapAround) {
+  std::vector<double> x{0.0, 1.0, 2.0, 3.0};
+  std::vector<double> y{0.0, 1.0, 4.0, 9.0};
+  s2e::math::Interpolation interpolation(x, y);
+
+  for (size_t n = 4; n < 15; n++) {
+    const double new_x = (double)n;
+    EXPECT_TRUE(interpolation.PushAndPopData(new_x, new_x * new_x));
+    for (size_t i = 0; i < x.size(); i++) {
+      const double expected_x = new_x - 3.0 + i;
+      EXPECT_DOUBLE_EQ(expected_x, interpolation.GetIndependentVariables()[i]);
+      EXPECT_DOUBLE_EQ(expected_x * expected_x, interpolation.GetDependentVariables()[i]);
+    }
+    const double xx = new_x - 1.3;
+    EXPECT_NEAR(xx * xx, interpolation.CalcPolynomial(xx), 1e-10);
+  }
+}
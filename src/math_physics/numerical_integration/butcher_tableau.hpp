@@ -0,0 +1,167 @@
+/**
+ * @file butcher_tableau.hpp
+ * @brief Butcher tableaux of explicit Runge-Kutta methods defined at compile time
+ * @note Ref: Montenbruck and Gill, Satellite Orbits, 4.1 Runge-Kutta Methods
+ *            P. J. Prince and J. R. Dormand, "High order embedded Runge-Kutta formulae", 1981
+ */
+
+#ifndef S2E_LIBRARY_NUMERICAL_INTEGRATION_BUTCHER_TABLEAU_HPP_
+#define S2E_LIBRARY_NUMERICAL_INTEGRATION_BUTCHER_TABLEAU_HPP_
+
+#include <array>
+#include <cstddef>
+
+namespace s2e::numerical_integration {
+
+/**
+ * @struct RungeKutta4Tableau
+ * @brief Butcher tableau of the classical 4th order Runge-Kutta method (4-order, 4-stage)
+ * @note Each tableau defines the number of stages, the order, the nodes (c), the weights (b) and the Runge-Kutta matrix (a).
+ *       Embedded methods also define the higher order weights (b_hat).
+ */
+struct RungeKutta4Tableau {
+  static constexpr size_t kNumberOfStages = 4;      //!< Number of stages (s in the equation)
+  static constexpr size_t kApproximationOrder = 4;  //!< Order of approximation (p in the equation)
+  static constexpr std::array<double, kNumberOfStages> kNodes = {0.0, 0.5, 0.5, 1.0};                      //!< Nodes (c vector)
+  static constexpr std::array<double, kNumberOfStages> kWeights = {1.0 / 6.0, 1.0 / 3.0, 1.0 / 3.0, 1.0 / 6.0};  //!< Weights (b vector)
+  //! Runge-Kutta matrix (a matrix)
+  static constexpr std::array<std::array<double, kNumberOfStages>, kNumberOfStages> kRkMatrix = {{
+      {0.0, 0.0, 0.0, 0.0},
+      {0.5, 0.0, 0.0, 0.0},
+      {0.0, 0.5, 0.0, 0.0},
+      {0.0, 0.0, 1.0, 0.0},
+  }};
+};
+
+/**
+ * @struct RungeKuttaFehlbergTableau
+ * @brief Butcher tableau of the Runge-Kutta-Fehlberg method (p=4th/q=5th order, 6-stage)
+ */
+struct RungeKuttaFehlbergTableau {
+  static constexpr size_t kNumberOfStages = 6;      //!< Number of stages (s in the equation)
+  static constexpr size_t kApproximationOrder = 4;  //!< Order of approximation (p in the equation)
+  //! Nodes (c vector)
+  static constexpr std::array<double, kNumberOfStages> kNodes = {0.0, 1.0 / 4.0, 3.0 / 8.0, 12.0 / 13.0, 1.0, 1.0 / 2.0};
+  //! Weights for the lower order approximation (b vector)
+  static constexpr std::array<double, kNumberOfStages> kWeights = {25.0 / 216.0, 0.0, 1408.0 / 2565.0, 2197.0 / 4104.0, -1.0 / 5.0, 0.0};
+  //! Weights for the higher order approximation (b_hat vector)
+  static constexpr std::array<double, kNumberOfStages> kHigherOrderWeights = {16.0 / 135.0,      0.0,          6656.0 / 12825.0,
+                                                                              28561.0 / 56430.0, -9.0 / 50.0, 2.0 / 55.0};
+  //! Runge-Kutta matrix (a matrix)
+  static constexpr std::array<std::array<double, kNumberOfStages>, kNumberOfStages> kRkMatrix = {{
+      {0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+      {1.0 / 4.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+      {3.0 / 32.0, 9.0 / 32.0, 0.0, 0.0, 0.0, 0.0},
+      {1932.0 / 2197.0, -7200.0 / 2197.0, 7296.0 / 2197.0, 0.0, 0.0, 0.0},
+      {439.0 / 216.0, -8.0, 3680.0 / 513.0, -845.0 / 4104.0, 0.0, 0.0},
+      {-8.0 / 27.0, 2.0, -3544.0 / 2565.0, 1859.0 / 4104.0, -11.0 / 40.0, 0.0},
+  }};
+};
+
+/**
+ * @struct DormandPrince5Tableau
+ * @brief Butcher tableau of the 5th order Dormand and Prince method RK5(4)7M (p=5th/q=4th order, 7-stage)
+ */
+struct DormandPrince5Tableau {
+  static constexpr size_t kNumberOfStages = 7;      //!< Number of stages (s in the equation)
+  static constexpr size_t kApproximationOrder = 5;  //!< Order of approximation (p in the equation)
+  //! Nodes (c vector)
+  static constexpr std::array<double, kNumberOfStages> kNodes = {0.0, 1.0 / 5.0, 3.0 / 10.0, 4.0 / 5.0, 8.0 / 9.0, 1.0, 1.0};
+  //! Weights for the lower order approximation (b vector)
+  static constexpr std::array<double, kNumberOfStages> kWeights = {5179.0 / 57600.0,      0.0,           7571.0 / 16695.0, 393.0 / 640.0,
+                                                                   -92097.0 / 339200.0, 187.0 / 2100.0, 1.0 / 40.0};
+  //! Weights for the higher order approximation (b_hat vector)
+  static constexpr std::array<double, kNumberOfStages> kHigherOrderWeights = {35.0 / 384.0,      0.0,          500.0 / 1113.0, 125.0 / 192.0,
+                                                                              -2187.0 / 6784.0, 11.0 / 84.0, 0.0};
+  //! Runge-Kutta matrix (a matrix)
+  static constexpr std::array<std::array<double, kNumberOfStages>, kNumberOfStages> kRkMatrix = {{
+      {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+      {1.0 / 5.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+      {3.0 / 40.0, 9.0 / 40.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+      {44.0 / 45.0, -56.0 / 15.0, 32.0 / 9.0, 0.0, 0.0, 0.0, 0.0},
+      {19372.0 / 6561.0, -25360.0 / 2187.0, 64448.0 / 6561.0, -212.0 / 729.0, 0.0, 0.0, 0.0},
+      {9017.0 / 3168.0, -355.0 / 33.0, 46732.0 / 5247.0, 49.0 / 176.0, -5103.0 / 18656.0, 0.0, 0.0},
+      {35.0 / 384.0, 0.0, 500.0 / 1113.0, 125.0 / 192.0, -2187.0 / 6784.0, 11.0 / 84.0, 0.0},
+  }};
+};
+
+/**
+ * @struct DormandPrince87Tableau
+ * @brief Butcher tableau of the 8th order Prince and Dormand method RK8(7)13M (p=7th/q=8th order, 13-stage)
+ * @note The coefficients are the rational approximations given in the reference.
+ */
+struct DormandPrince87Tableau {
+  static constexpr size_t kNumberOfStages = 13;     //!< Number of stages (s in the equation)
+  static constexpr size_t kApproximationOrder = 7;  //!< Order of approximation (p in the equation)
+  //! Nodes (c vector)
+  static constexpr std::array<double, kNumberOfStages> kNodes = {0.0,
+                                                                 1.0 / 18.0,
+                                                                 1.0 / 12.0,
+                                                                 1.0 / 8.0,
+                                                                 5.0 / 16.0,
+                                                                 3.0 / 8.0,
+                                                                 59.0 / 400.0,
+                                                                 93.0 / 200.0,
+                                                                 5490023248.0 / 9719169821.0,
+                                                                 13.0 / 20.0,
+                                                                 1201146811.0 / 1299019798.0,
+                                                                 1.0,
+                                                                 1.0};
+  //! Weights for the lower order approximation (b vector)
+  static constexpr std::array<double, kNumberOfStages> kWeights = {13451932.0 / 455176623.0,
+                                                                   0.0,
+                                                                   0.0,
+                                                                   0.0,
+                                                                   0.0,
+                                                                   -808719846.0 / 976000145.0,
+                                                                   1757004468.0 / 5645159321.0,
+                                                                   656045339.0 / 265891186.0,
+                                                                   -3867574721.0 / 1518517206.0,
+                                                                   465885868.0 / 322736535.0,
+                                                                   53011238.0 / 667516719.0,
+                                                                   2.0 / 45.0,
+                                                                   0.0};
+  //! Weights for the higher order approximation (b_hat vector)
+  static constexpr std::array<double, kNumberOfStages> kHigherOrderWeights = {14005451.0 / 335480064.0,
+                                                                              0.0,
+                                                                              0.0,
+                                                                              0.0,
+                                                                              0.0,
+                                                                              -59238493.0 / 1068277825.0,
+                                                                              181606767.0 / 758867731.0,
+                                                                              561292985.0 / 797845732.0,
+                                                                              -1041891430.0 / 1371343529.0,
+                                                                              760417239.0 / 1151165299.0,
+                                                                              118820643.0 / 751138087.0,
+                                                                              -528747749.0 / 2220607170.0,
+                                                                              1.0 / 4.0};
+  //! Runge-Kutta matrix (a matrix)
+  static constexpr std::array<std::array<double, kNumberOfStages>, kNumberOfStages> kRkMatrix = {{
+      {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+      {1.0 / 18.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+      {1.0 / 48.0, 1.0 / 16.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+      {1.0 / 32.0, 0.0, 3.0 / 32.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+      {5.0 / 16.0, 0.0, -75.0 / 64.0, 75.0 / 64.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+      {3.0 / 80.0, 0.0, 0.0, 3.0 / 16.0, 3.0 / 20.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+      {29443841.0 / 614563906.0, 0.0, 0.0, 77736538.0 / 692538347.0, -28693883.0 / 1125000000.0, 23124283.0 / 1800000000.0, 0.0, 0.0, 0.0,
+       0.0, 0.0, 0.0, 0.0},
+      {16016141.0 / 946692911.0, 0.0, 0.0, 61564180.0 / 158732637.0, 22789713.0 / 633445777.0, 545815736.0 / 2771057229.0,
+       -180193667.0 / 1043307555.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+      {39632708.0 / 573591083.0, 0.0, 0.0, -433636366.0 / 683701615.0, -421739975.0 / 2616292301.0, 100302831.0 / 723423059.0,
+       790204164.0 / 839813087.0, 800635310.0 / 3783071287.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+      {246121993.0 / 1340847787.0, 0.0, 0.0, -37695042795.0 / 15268766246.0, -309121744.0 / 1061227803.0, -12992083.0 / 490766935.0,
+       6005943493.0 / 2108947869.0, 393006217.0 / 1396673457.0, 123872331.0 / 1001029789.0, 0.0, 0.0, 0.0, 0.0},
+      {-1028468189.0 / 846180014.0, 0.0, 0.0, 8478235783.0 / 508512852.0, 1311729495.0 / 1432422823.0, -10304129995.0 / 1701304382.0,
+       -48777925059.0 / 3047939560.0, 15336726248.0 / 1032824649.0, -45442868181.0 / 3398467696.0, 3065993473.0 / 597172653.0, 0.0, 0.0, 0.0},
+      {185892177.0 / 718116043.0, 0.0, 0.0, -3185094517.0 / 667107341.0, -477755414.0 / 1098053517.0, -703635378.0 / 230739211.0,
+       5731566787.0 / 1027545527.0, 5232866602.0 / 850066563.0, -4093664535.0 / 808688257.0, 3962137247.0 / 1805957418.0,
+       65686358.0 / 487910083.0, 0.0, 0.0},
+      {403863854.0 / 491063109.0, 0.0, 0.0, -5068492393.0 / 434740067.0, -411421997.0 / 543043805.0, 652783627.0 / 914296604.0,
+       11173962825.0 / 925320556.0, -13158990841.0 / 6184727034.0, 3936647629.0 / 1978049680.0, -160528059.0 / 685178525.0,
+       248638103.0 / 1413531060.0, 0.0, 0.0},
+  }};
+};
+
+}  // namespace s2e::numerical_integration
+
+#endif  // S2E_LIBRARY_NUMERICAL_INTEGRATION_BUTCHER_TABLEAU_HPP_
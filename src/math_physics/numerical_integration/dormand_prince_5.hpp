@@ -18,7 +18,7 @@ namespace s2e::numerical_integration {
  * @brief Class for 5th order Dormand and Prince method
  */
 template <size_t N>
-class DormandPrince5 : public EmbeddedRungeKutta<N> {
+class DormandPrince5 : public EmbeddedRungeKutta<N, DormandPrince5Tableau> {
  public:
   /**
    * @fn DormandPrince5
@@ -34,16 +34,35 @@ class DormandPrince5 : public EmbeddedRungeKutta<N> {
    * @return : interpolated state x(t0 + sigma * h)
    */
   math::Vector<N> CalcInterpolationState(const double sigma) const override;
+  /**
+   * @fn IsInterpolationSupported
+   * @brief Return true since the interpolation is supported
+   */
+  bool IsInterpolationSupported() const override { return true; }
 
  private:
-  std::vector<math::Vector<5>> coefficients_;  //!< Coefficients to calculate interpolation weights
+  //! Coefficients of the polynomials of sigma to calculate interpolation weights
+  static constexpr std::array<std::array<double, 5>, DormandPrince5Tableau::kNumberOfStages - 1> kInterpolationCoefficients = {{
+      {1.0 / 11282082432.0 * 11282082432.0, 1.0 / 11282082432.0 * -32272833064.0, 1.0 / 11282082432.0 * 34969693132.0,
+       1.0 / 11282082432.0 * -13107642775.0, 1.0 / 11282082432.0 * 157015080.0},
+      {0.0, 0.0, 0.0, 0.0, 0.0},
+      {0.0, -100.0 / 32700410799.0 * -1323431896.0, -100.0 / 32700410799.0 * 2074956840.0, -100.0 / 32700410799.0 * -914128567.0,
+       -100.0 / 32700410799.0 * 15701508.0},
+      {0.0, 25.0 / 5641041216.0 * -889289856.0, 25.0 / 5641041216.0 * 2460397220.0, 25.0 / 5641041216.0 * -1518414297.0,
+       25.0 / 5641041216.0 * 94209048.0},
+      {0.0, -2187.0 / 199316789632.0 * -259006536.0, -2187.0 / 199316789632.0 * 687873124.0, -2187.0 / 199316789632.0 * -451824525.0,
+       -2187.0 / 199316789632.0 * 52338360.0},
+      {0.0, 11.0 / 2467955532.0 * -361440756.0, 11.0 / 2467955532.0 * 946554244.0, 11.0 / 2467955532.0 * -661884105.0,
+       11.0 / 2467955532.0 * 106151040.0},
+  }};
+
   /**
    * @fn CalcInterpolationWeights
    * @brief Calculate weights for interpolation
    * @param [in] sigma: Sigma value (0 < sigma < 1) for interpolation
    * @return : weights for interpolation
    */
-  std::vector<double> CalcInterpolationWeights(const double sigma) const;
+  std::array<double, DormandPrince5Tableau::kNumberOfStages> CalcInterpolationWeights(const double sigma) const;
 };
 
 }  // namespace s2e::numerical_integration
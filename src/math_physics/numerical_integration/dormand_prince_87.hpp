@@ -0,0 +1,42 @@
+/**
+ * @file dormand_prince_87.hpp
+ * @brief Class for 8th order Prince and Dormand method RK8(7)13M
+ * @note Ref: P. J. Prince and J. R. Dormand, "High order embedded Runge-Kutta formulae", 1981
+ *            O. Montenbruck and E. Gill, Satellite Orbits, 4.1.4 Step Size Control
+ */
+
+#ifndef S2E_LIBRARY_NUMERICAL_INTEGRATION_DORMAND_PRINCE_87_HPP_
+#define S2E_LIBRARY_NUMERICAL_INTEGRATION_DORMAND_PRINCE_87_HPP_
+
+#include <utilities/macros.hpp>
+
+#include "embedded_runge_kutta.hpp"
+
+namespace s2e::numerical_integration {
+
+/**
+ * @class DormandPrince87
+ * @brief Class for 8th order Prince and Dormand method RK8(7)13M
+ */
+template <size_t N>
+class DormandPrince87 : public EmbeddedRungeKutta<N, DormandPrince87Tableau> {
+ public:
+  /**
+   * @fn DormandPrince87
+   * @brief Constructor
+   * @param [in] step_width: Step width
+   * @param [in] ode: Ordinary differential equation
+   */
+  DormandPrince87(const double step_width, const InterfaceOde<N>& ode) : EmbeddedRungeKutta<N, DormandPrince87Tableau>(step_width, ode) {}
+
+  // We did not implement the interpolation for RK8(7)13M
+  math::Vector<N> CalcInterpolationState(const double sigma) const override {
+    UNUSED(sigma);
+    return this->current_state_;
+  }
+  bool IsInterpolationSupported() const override { return false; }
+};
+
+}  // namespace s2e::numerical_integration
+
+#endif  // S2E_LIBRARY_NUMERICAL_INTEGRATION_DORMAND_PRINCE_87_HPP_
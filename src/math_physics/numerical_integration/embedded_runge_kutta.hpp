@@ -13,16 +13,17 @@ namespace s2e::numerical_integration {
 /**
  * @class EmbeddedRungeKutta
  * @brief Class for Embedded Runge-Kutta method
+ * @note The Butcher tableau class should define the higher order weights in addition to the coefficients for RungeKutta.
  */
-template <size_t N>
-class EmbeddedRungeKutta : public RungeKutta<N> {
+template <size_t N, class Tableau>
+class EmbeddedRungeKutta : public RungeKutta<N, Tableau> {
  public:
   /**
    * @fn EmbeddedRungeKutta
    * @brief Constructor
    * @param [in] step_width: Step width
    */
-  EmbeddedRungeKutta(const double step_width, const InterfaceOde<N>& ode) : RungeKutta<N>(step_width, ode) {}
+  EmbeddedRungeKutta(const double step_width, const InterfaceOde<N>& ode) : RungeKutta<N, Tableau>(step_width, ode) {}
 
   /**
    * @fn Integrate
@@ -30,12 +31,31 @@ class EmbeddedRungeKutta : public RungeKutta<N> {
    */
   virtual void Integrate();
 
+  /**
+   * @fn IntegrateWithStepControl
+   * @brief Integrate one step with the error control. The step is retried with a smaller step width while the error exceeds the tolerance.
+   * @note The step width is kept as the accepted one for the interpolation. Use CalcOptimalStepWidth to get the width of the next step.
+   * @param[in] error_tolerance: Error tolerance (epsilon in the equation)
+   * @return true: the step is accepted, false: the error exceeds the tolerance even with the smallest trial
+   */
+  bool IntegrateWithStepControl(const double error_tolerance);
+
   /**
    * @fn ControlStepWidth
    * @brief Step width control
+   * @note The step width is set to the optimal one without the safety factor and the limit of the change ratio. IntegrateWithStepControl uses
+   *       CalcOptimalStepWidth instead.
    * @param[in] error_tolerance: Error tolerance (epsilon in the equation)
    */
   void ControlStepWidth(const double error_tolerance);
+  /**
+   * @fn CalcOptimalStepWidth
+   * @brief Calculate the optimal step width from the latest local truncation error
+   * @note The change ratio of the step width is limited with a safety factor to avoid oscillation of the step width.
+   * @param[in] error_tolerance: Error tolerance (epsilon in the equation)
+   * @return Optimal step width
+   */
+  double CalcOptimalStepWidth(const double error_tolerance) const;
 
   /**
    * @fn GetLocalTruncationError
@@ -44,11 +64,14 @@ class EmbeddedRungeKutta : public RungeKutta<N> {
   inline double GetLocalTruncationError() const { return local_truncation_error_; }
 
  protected:
-  // Parameters should be defined by child class
-  std::vector<double> higher_order_weights_;  //!< Weights vector for higher order approximation
-
   // Error
-  double local_truncation_error_;  //!< Norm of estimated local truncation error
+  double local_truncation_error_ = 0.0;  //!< Norm of estimated local truncation error
+
+  // Step width control parameters
+  static constexpr double kSafetyFactor = 0.9;          //!< Safety factor of the step width control
+  static constexpr double kMinimumChangeRatio = 0.2;    //!< Minimum ratio of the step width change
+  static constexpr double kMaximumChangeRatio = 5.0;    //!< Maximum ratio of the step width change
+  static constexpr size_t kMaximumNumberOfTrials = 10;  //!< Maximum number of trials for a step
 };
 
 }  // namespace s2e::numerical_integration
@@ -5,21 +5,22 @@
 #ifndef S2E_LIBRARY_NUMERICAL_INTEGRATION_EMBEDDED_RUNGE_KUTTA_IMPLEMENTATION_HPP_
 #define S2E_LIBRARY_NUMERICAL_INTEGRATION_EMBEDDED_RUNGE_KUTTA_IMPLEMENTATION_HPP_
 
+#include <algorithm>
+#include <cmath>
+
 #include "embedded_runge_kutta.hpp"
 
 namespace s2e::numerical_integration {
 
-template <size_t N>
-void EmbeddedRungeKutta<N>::Integrate() {
+template <size_t N, class Tableau>
+void EmbeddedRungeKutta<N, Tableau>::Integrate() {
   this->CalcSlope();
 
   this->previous_state_ = this->current_state_;
   math::Vector<N> lower_current_state = this->current_state_;   //!< eta in the equation
   math::Vector<N> higher_current_state = this->current_state_;  //!< eta_hat in the equation
-  for (size_t i = 0; i < this->number_of_stages_; i++) {
-    lower_current_state = lower_current_state + this->weights_[i] * this->step_width_ * this->slope_[i];
-    higher_current_state = higher_current_state + higher_order_weights_[i] * this->step_width_ * this->slope_[i];
-  }
+  this->AddWeightedSlopes(Tableau::kWeights, this->kNumberOfStages, lower_current_state);
+  this->AddWeightedSlopes(Tableau::kHigherOrderWeights, this->kNumberOfStages, higher_current_state);
 
   // Error evaluation
   math::Vector<N> truncation_error = lower_current_state - higher_current_state;
@@ -30,13 +31,40 @@ void EmbeddedRungeKutta<N>::Integrate() {
   this->current_independent_variable_ += this->step_width_;
 }
 
-template <size_t N>
-void EmbeddedRungeKutta<N>::ControlStepWidth(const double error_tolerance) {
-  double updated_step_width = pow(error_tolerance / local_truncation_error_, 1.0 / ((double)(this->approximation_order_ + 1))) * this->step_width_;
+template <size_t N, class Tableau>
+bool EmbeddedRungeKutta<N, Tableau>::IntegrateWithStepControl(const double error_tolerance) {
+  const double initial_independent_variable = this->current_independent_variable_;
+  const math::Vector<N> initial_state = this->current_state_;
+  for (size_t trial = 0; trial < kMaximumNumberOfTrials; trial++) {
+    Integrate();
+    if (local_truncation_error_ <= error_tolerance) return true;
+    if (trial + 1 == kMaximumNumberOfTrials) break;
+
+    // Reject the step and retry with a smaller step width
+    this->current_independent_variable_ = initial_independent_variable;
+    this->current_state_ = initial_state;
+    this->step_width_ = CalcOptimalStepWidth(error_tolerance);
+  }
+  return false;
+}
+
+template <size_t N, class Tableau>
+void EmbeddedRungeKutta<N, Tableau>::ControlStepWidth(const double error_tolerance) {
+  double updated_step_width = pow(error_tolerance / local_truncation_error_, 1.0 / ((double)(Tableau::kApproximationOrder + 1))) * this->step_width_;
   if (updated_step_width <= 0.0) return;  // TODO: Error handling
   this->step_width_ = updated_step_width;
 }
 
+template <size_t N, class Tableau>
+double EmbeddedRungeKutta<N, Tableau>::CalcOptimalStepWidth(const double error_tolerance) const {
+  double change_ratio = kMaximumChangeRatio;
+  if (local_truncation_error_ > 0.0) {
+    change_ratio = kSafetyFactor * pow(error_tolerance / local_truncation_error_, 1.0 / ((double)(Tableau::kApproximationOrder + 1)));
+  }
+  change_ratio = std::clamp(change_ratio, kMinimumChangeRatio, kMaximumChangeRatio);
+  return change_ratio * this->step_width_;
+}
+
 }  // namespace s2e::numerical_integration
 
 #endif  // S2E_LIBRARY_NUMERICAL_INTEGRATION_EMBEDDED_RUNGE_KUTTA_IMPLEMENTATION_HPP_
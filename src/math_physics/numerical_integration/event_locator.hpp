@@ -0,0 +1,128 @@
+/**
+ * @file event_locator.hpp
+ * @brief Class to locate discrete events on the interpolation of numerical integrator
+ */
+
+#ifndef S2E_LIBRARY_NUMERICAL_INTEGRATION_EVENT_LOCATOR_HPP_
+#define S2E_LIBRARY_NUMERICAL_INTEGRATION_EVENT_LOCATOR_HPP_
+
+#include <vector>
+
+#include "interface_switching_function.hpp"
+#include "numerical_integrator.hpp"
+
+namespace s2e::numerical_integration {
+
+/**
+ * @enum EventDirection
+ * @brief Direction of the zero crossing of switching function
+ */
+enum class EventDirection {
+  kIncreasing,  //!< Switching function changes from negative to positive
+  kDecreasing,  //!< Switching function changes from positive to negative
+  kBoth,        //!< Both directions
+};
+
+/**
+ * @struct Event
+ * @brief Information of a located event
+ */
+template <size_t N>
+struct Event {
+  size_t function_id;           //!< ID of the switching function returned by AddSwitchingFunction
+  EventDirection direction;     //!< Direction of the zero crossing (kIncreasing or kDecreasing)
+  double independent_variable;  //!< Independent variable at the event
+  math::Vector<N> state;        //!< Interpolated state vector at the event
+};
+
+/**
+ * @class EventLocator
+ * @brief Class to locate discrete events on the interpolation of numerical integrator
+ * @note The zero crossing of the switching functions are searched with the Illinois method on the interpolation of the latest step, so that no
+ *       additional evaluation of the differential equation is required for DP5. RKF evaluates the slope at the step end once in a step with
+ *       events. For the integrators without the interpolation (e.g. RK4, DP87), the events are reported at the end of the step in which the
+ *       sign changes.
+ *       Multiple crossings of a switching function in a step cannot be detected when the sign at the step end is the same as the start.
+ */
+template <size_t N>
+class EventLocator {
+ public:
+  /**
+   * @fn EventLocator
+   * @brief Constructor
+   * @param [in] integrator: Numerical integrator to be monitored
+   * @param [in] tolerance: Tolerance of the independent variable at the event
+   */
+  EventLocator(const NumericalIntegrator<N>& integrator, const double tolerance) : integrator_(integrator), tolerance_(tolerance) {}
+
+  /**
+   * @fn AddSwitchingFunction
+   * @brief Register a switching function. The value at the current state of the integrator is used as the initial value.
+   * @param [in] switching_function: Switching function
+   * @param [in] direction: Direction of the zero crossing to be detected
+   * @return ID of the switching function
+   */
+  size_t AddSwitchingFunction(const InterfaceSwitchingFunction<N>& switching_function, const EventDirection direction = EventDirection::kBoth);
+  /**
+   * @fn Initialize
+   * @brief Evaluate the switching functions at the current state of the integrator. Call this function after NumericalIntegrator::SetState.
+   */
+  void Initialize();
+  /**
+   * @fn Locate
+   * @brief Locate events in the latest integration step. Call this function after every step of the integrator.
+   * @return true: one or more events are located in the latest step
+   */
+  bool Locate();
+
+  /**
+   * @fn GetEvents
+   * @brief Return events located in the latest step in order of the independent variable
+   */
+  inline const std::vector<Event<N>>& GetEvents() const { return events_; }
+
+ private:
+  /**
+   * @struct SwitchingFunctionSetting
+   * @brief Registered switching function and its value at the latest step end
+   */
+  struct SwitchingFunctionSetting {
+    const InterfaceSwitchingFunction<N>* function;  //!< Switching function
+    EventDirection direction;                       //!< Direction of the zero crossing to be detected
+    double previous_value;                          //!< Value at the latest step end
+  };
+
+  const NumericalIntegrator<N>& integrator_;                   //!< Numerical integrator
+  const double tolerance_;                                     //!< Tolerance of the independent variable at the event
+  std::vector<SwitchingFunctionSetting> switching_functions_;  //!< Registered switching functions
+  std::vector<Event<N>> events_;                               //!< Events located in the latest step
+
+  static constexpr size_t kMaximumNumberOfIterations = 100;  //!< Maximum number of iterations of the root finding
+
+  /**
+   * @fn CalcValue
+   * @brief Calculate the value of switching function at the interpolated state
+   * @param [in] switching_function: Switching function
+   * @param [in] sigma: Sigma value (0 < sigma < 1) for interpolation
+   * @param [out] independent_variable: Independent variable at sigma
+   * @param [out] state: Interpolated state at sigma
+   * @return Value of the switching function
+   */
+  double CalcValue(const InterfaceSwitchingFunction<N>& switching_function, const double sigma, double& independent_variable,
+                   math::Vector<N>& state) const;
+  /**
+   * @fn LocateRoot
+   * @brief Locate the zero crossing of the switching function in the latest step with the Illinois method
+   * @param [in] switching_function: Switching function
+   * @param [in] start_value: Value of the switching function at the step start
+   * @param [in] end_value: Value of the switching function at the step end
+   * @param [out] event: Located event
+   */
+  void LocateRoot(const InterfaceSwitchingFunction<N>& switching_function, const double start_value, const double end_value, Event<N>& event) const;
+};
+
+}  // namespace s2e::numerical_integration
+
+#include "event_locator_implementation.hpp"
+
+#endif  // S2E_LIBRARY_NUMERICAL_INTEGRATION_EVENT_LOCATOR_HPP_
@@ -0,0 +1,108 @@
+/**
+ * @file event_locator_implementation.hpp
+ * @brief Implementation of event locator
+ */
+#ifndef S2E_LIBRARY_NUMERICAL_INTEGRATION_EVENT_LOCATOR_IMPLEMENTATION_HPP_
+#define S2E_LIBRARY_NUMERICAL_INTEGRATION_EVENT_LOCATOR_IMPLEMENTATION_HPP_
+
+#include <algorithm>
+#include <cmath>
+
+#include "event_locator.hpp"
+
+namespace s2e::numerical_integration {
+
+template <size_t N>
+size_t EventLocator<N>::AddSwitchingFunction(const InterfaceSwitchingFunction<N>& switching_function, const EventDirection direction) {
+  const double value = switching_function.CalcSwitchingFunction(integrator_.GetIndependentVariable(), integrator_.GetState());
+  switching_functions_.push_back({&switching_function, direction, value});
+  return switching_functions_.size() - 1;
+}
+
+template <size_t N>
+void EventLocator<N>::Initialize() {
+  for (auto& setting : switching_functions_) {
+    setting.previous_value = setting.function->CalcSwitchingFunction(integrator_.GetIndependentVariable(), integrator_.GetState());
+  }
+  events_.clear();
+}
+
+template <size_t N>
+bool EventLocator<N>::Locate() {
+  events_.clear();
+  for (size_t id = 0; id < switching_functions_.size(); id++) {
+    SwitchingFunctionSetting& setting = switching_functions_[id];
+    const double start_value = setting.previous_value;
+    const double end_value = setting.function->CalcSwitchingFunction(integrator_.GetIndependentVariable(), integrator_.GetState());
+    setting.previous_value = end_value;
+
+    // Zero at the step start is treated as the event of the previous step
+    EventDirection direction;
+    if (start_value < 0.0 && end_value >= 0.0) {
+      direction = EventDirection::kIncreasing;
+    } else if (start_value > 0.0 && end_value <= 0.0) {
+      direction = EventDirection::kDecreasing;
+    } else {
+      continue;
+    }
+    if (setting.direction != EventDirection::kBoth && setting.direction != direction) continue;
+
+    Event<N> event;
+    event.function_id = id;
+    event.direction = direction;
+    LocateRoot(*setting.function, start_value, end_value, event);
+    events_.push_back(event);
+  }
+
+  std::sort(events_.begin(), events_.end(),
+            [](const Event<N>& lhs, const Event<N>& rhs) { return lhs.independent_variable < rhs.independent_variable; });
+  return !events_.empty();
+}
+
+template <size_t N>
+double EventLocator<N>::CalcValue(const InterfaceSwitchingFunction<N>& switching_function, const double sigma, double& independent_variable,
+                                  math::Vector<N>& state) const {
+  independent_variable = integrator_.GetIndependentVariable() - (1.0 - sigma) * integrator_.GetStepWidth();
+  state = integrator_.CalcInterpolationState(sigma);
+  return switching_function.CalcSwitchingFunction(independent_variable, state);
+}
+
+template <size_t N>
+void EventLocator<N>::LocateRoot(const InterfaceSwitchingFunction<N>& switching_function, const double start_value, const double end_value,
+                                 Event<N>& event) const {
+  event.independent_variable = integrator_.GetIndependentVariable();
+  event.state = integrator_.GetState();
+  if (end_value == 0.0) return;
+  // The event is reported at the step end when the integrator does not support the interpolation
+  if (!integrator_.IsInterpolationSupported()) return;
+
+  // Illinois method: the regula falsi with halving the value at the retained end to avoid the slow convergence
+  const double sigma_tolerance = tolerance_ / fabs(integrator_.GetStepWidth());
+  double lower_sigma = 0.0;
+  double upper_sigma = 1.0;
+  double lower_value = start_value;
+  double upper_value = end_value;
+  int retained_side = 0;  // -1: lower side is updated in the previous iteration, 1: upper side is updated
+  for (size_t i = 0; i < kMaximumNumberOfIterations; i++) {
+    const double sigma = (lower_sigma * upper_value - upper_sigma * lower_value) / (upper_value - lower_value);
+    const double value = CalcValue(switching_function, sigma, event.independent_variable, event.state);
+    if (value == 0.0) return;
+
+    if ((value < 0.0) == (lower_value < 0.0)) {
+      lower_sigma = sigma;
+      lower_value = value;
+      if (retained_side == -1) upper_value *= 0.5;
+      retained_side = -1;
+    } else {
+      upper_sigma = sigma;
+      upper_value = value;
+      if (retained_side == 1) lower_value *= 0.5;
+      retained_side = 1;
+    }
+    if (upper_sigma - lower_sigma < sigma_tolerance) return;
+  }
+}
+
+}  // namespace s2e::numerical_integration
+
+#endif  // S2E_LIBRARY_NUMERICAL_INTEGRATION_EVENT_LOCATOR_IMPLEMENTATION_HPP_
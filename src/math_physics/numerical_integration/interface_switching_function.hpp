@@ -0,0 +1,33 @@
+/**
+ * @file interface_switching_function.hpp
+ * @brief Interface class for switching function to define discrete events
+ */
+
+#ifndef S2E_LIBRARY_NUMERICAL_INTEGRATION_INTERFACE_SWITCHING_FUNCTION_HPP_
+#define S2E_LIBRARY_NUMERICAL_INTEGRATION_INTERFACE_SWITCHING_FUNCTION_HPP_
+
+#include "../math/vector.hpp"
+
+namespace s2e::numerical_integration {
+
+/**
+ * @class InterfaceSwitchingFunction
+ * @brief Interface class for switching function to define discrete events
+ * @note An event occurs when the sign of the switching function changes (e.g. altitude - threshold, z position for node crossing)
+ */
+template <size_t N>
+class InterfaceSwitchingFunction {
+ public:
+  /**
+   * @fn CalcSwitchingFunction
+   * @brief Pure virtual function to define the switching function
+   * @param [in] independent_variable: Independent variable
+   * @param [in] state: State vector
+   * @return Value of the switching function. The event occurs at the zero crossing.
+   */
+  virtual double CalcSwitchingFunction(const double independent_variable, const math::Vector<N>& state) const = 0;
+};
+
+}  // namespace s2e::numerical_integration
+
+#endif  // S2E_LIBRARY_NUMERICAL_INTEGRATION_INTERFACE_SWITCHING_FUNCTION_HPP_
@@ -50,11 +50,28 @@ class NumericalIntegrator {
     previous_state_ = state;
   }
 
+  /**
+   * @fn SetStepWidth
+   * @brief Set step width of the next integration
+   * @param [in] step_width: Step width. The unit is depending on the independent variable
+   */
+  inline void SetStepWidth(const double step_width) { step_width_ = step_width; }
+
   /**
    * @fn GetState
    * @brief Return current state vector
    */
   inline const math::Vector<N>& GetState() const { return current_state_; }
+  /**
+   * @fn GetIndependentVariable
+   * @brief Return current value of independent variable
+   */
+  inline double GetIndependentVariable() const { return current_independent_variable_; }
+  /**
+   * @fn GetStepWidth
+   * @brief Return step width. After the integration, it is the step width of the latest step used for the interpolation.
+   */
+  inline double GetStepWidth() const { return step_width_; }
 
   /**
    * @fn CalcInterpolationState
@@ -63,6 +80,12 @@ class NumericalIntegrator {
    * @return : interpolated state x(t0 + sigma * h)
    */
   virtual math::Vector<N> CalcInterpolationState(const double sigma) const = 0;
+  /**
+   * @fn IsInterpolationSupported
+   * @brief Return true when CalcInterpolationState gives the interpolated state
+   * @note The integrators without the interpolation return the latest state from CalcInterpolationState for any sigma.
+   */
+  virtual bool IsInterpolationSupported() const = 0;
 
  protected:
   // Settings
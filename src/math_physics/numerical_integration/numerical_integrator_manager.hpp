@@ -9,6 +9,7 @@
 #include <memory>
 
 #include "dormand_prince_5.hpp"
+#include "dormand_prince_87.hpp"
 #include "runge_kutta_4.hpp"
 #include "runge_kutta_fehlberg.hpp"
 
@@ -22,6 +23,7 @@ enum class NumericalIntegrationMethod {
   kRk4 = 0,  //!< 4th order Runge-Kutta
   kRkf,      //!< Runge-Kutta-Fehlberg
   kDp5,      //!< 5th order Dormand and Prince
+  kDp87,     //!< 8th order Prince and Dormand RK8(7)13M
 };
 
 /**
@@ -48,6 +50,9 @@ class NumericalIntegratorManager {
       case NumericalIntegrationMethod::kDp5:
         integrator_ = std::make_shared<DormandPrince5<N>>(step_width, ode);
         break;
+      case NumericalIntegrationMethod::kDp87:
+        integrator_ = std::make_shared<DormandPrince87<N>>(step_width, ode);
+        break;
       default:
         integrator_ = std::make_shared<RungeKutta4<N>>(step_width, ode);
         break;
@@ -7,6 +7,9 @@
 #ifndef S2E_LIBRARY_NUMERICAL_INTEGRATION_RUNGE_KUTTA_HPP_
 #define S2E_LIBRARY_NUMERICAL_INTEGRATION_RUNGE_KUTTA_HPP_
 
+#include <array>
+
+#include "butcher_tableau.hpp"
 #include "numerical_integrator.hpp"
 
 namespace s2e::numerical_integration {
@@ -14,8 +17,10 @@ namespace s2e::numerical_integration {
 /**
  * @class RungeKutta
  * @brief Base Class for General Runge-Kutta method
+ * @note The coefficients are given by the Butcher tableau class (e.g. RungeKutta4Tableau) at compile time.
+ *       The slopes of all stages are stored in a fixed size array, so the integration does not allocate memory.
  */
-template <size_t N>
+template <size_t N, class Tableau>
 class RungeKutta : public NumericalIntegrator<N> {
  public:
   /**
@@ -24,7 +29,7 @@ class RungeKutta : public NumericalIntegrator<N> {
    * @param [in] step_width_s: Step width
    * @param [in] ode: Ordinary differential equation
    */
-  inline RungeKutta(const double step_width, const InterfaceOde<N>& ode) : NumericalIntegrator<N>(step_width, ode) {}
+  inline RungeKutta(const double step_width, const InterfaceOde<N>& ode) : NumericalIntegrator<N>(step_width, ode) { CalcSlope(); }
   /**
    * @fn ~RungeKutta
    * @brief Destructor
@@ -38,21 +43,23 @@ class RungeKutta : public NumericalIntegrator<N> {
   virtual void Integrate();
 
  protected:
-  // Settings
-  size_t number_of_stages_;     //!< Number of stage for integration (s in the equation)
-  size_t approximation_order_;  //!< Order of approximation (p in the equation)
+  static constexpr size_t kNumberOfStages = Tableau::kNumberOfStages;  //!< Number of stage for integration (s in the equation)
 
-  // Coefficients should be defined by child class
-  std::vector<double> nodes_;                   //!< Nodes vector for general RK (c vector in the equation)
-  std::vector<double> weights_;                 //!< Weights vector for general RK (b vector in the equation)
-  std::vector<std::vector<double>> rk_matrix_;  //!< Runge-Kutta matrix for general RK (a matrix in the equation)
-  std::vector<math::Vector<N>> slope_;          //!< Slope vector for general RK (k vector in the equation)
+  std::array<math::Vector<N>, kNumberOfStages> slope_;  //!< Slope vector for general RK (k vector in the equation)
 
   /**
    * @fn CalcSlope
    * @brief Calc slope vector (k in the RK equation)
    */
   void CalcSlope();
+  /**
+   * @fn AddWeightedSlopes
+   * @brief Add the slopes multiplied by the weights and the step width to the state
+   * @param [in] weights: Weights for each stage
+   * @param [in] number_of_slopes: Number of slopes to be added
+   * @param [in/out] state: State vector
+   */
+  void AddWeightedSlopes(const std::array<double, kNumberOfStages>& weights, const size_t number_of_slopes, math::Vector<N>& state) const;
 };
 
 }  // namespace s2e::numerical_integration
@@ -15,7 +15,7 @@ namespace s2e::numerical_integration {
  * @brief Class for Classical Runge-Kutta-Fehlberg method
  */
 template <size_t N>
-class RungeKuttaFehlberg : public EmbeddedRungeKutta<N> {
+class RungeKuttaFehlberg : public EmbeddedRungeKutta<N, RungeKuttaFehlbergTableau> {
  public:
   /**
    * @fn RungeKuttaFehlberg
@@ -23,22 +23,37 @@ class RungeKuttaFehlberg : public EmbeddedRungeKutta<N> {
    * @param [in] step_width: Step width
    */
   RungeKuttaFehlberg(const double step_width, const InterfaceOde<N>& ode);
+  /**
+   * @fn Integrate
+   * @brief Update the state vector and mark the slope for the interpolation to be recalculated
+   */
+  void Integrate() override;
   /**
    * @fn CalcInterpolationState
    * @brief Calculate interpolation state
+   * @note The interpolation needs the slope at the step end (k7). It is evaluated at the first call after each step and reused, so that
+   *       repeated calls in a step (e.g. root finding) cost only one evaluation of the differential equation per step.
    * @param [in] sigma: Sigma value (0 < sigma < 1) for interpolation
    * @return : interpolated state x(t0 + sigma * h)
    */
   math::Vector<N> CalcInterpolationState(const double sigma) const override;
+  /**
+   * @fn IsInterpolationSupported
+   * @brief Return true since the interpolation is supported
+   */
+  bool IsInterpolationSupported() const override { return true; }
 
  private:
+  mutable math::Vector<N> k7_;             //!< Slope at the end of the latest step for the interpolation
+  mutable bool is_k7_calculated_ = false;  //!< Flag of k7 calculated for the latest step
+
   /**
    * @fn CalcInterpolationWeights
    * @brief Calculate weights for interpolation
    * @param [in] sigma: Sigma value (0 < sigma < 1) for interpolation
    * @return : weights for interpolation
    */
-  std::vector<double> CalcInterpolationWeights(const double sigma) const;
+  std::array<double, RungeKuttaFehlbergTableau::kNumberOfStages + 1> CalcInterpolationWeights(const double sigma) const;
 };
 
 }  // namespace s2e::numerical_integration
@@ -9,31 +9,38 @@
 
 namespace s2e::numerical_integration {
 
-template <size_t N>
-void RungeKutta<N>::Integrate() {
+template <size_t N, class Tableau>
+void RungeKutta<N, Tableau>::Integrate() {
   CalcSlope();
 
   this->previous_state_ = this->current_state_;
-  for (size_t i = 0; i < number_of_stages_; i++) {
-    this->current_state_ = this->current_state_ + weights_[i] * this->step_width_ * slope_[i];
-  }
+  AddWeightedSlopes(Tableau::kWeights, kNumberOfStages, this->current_state_);
   this->current_independent_variable_ += this->step_width_;
 }
 
-template <size_t N>
-void RungeKutta<N>::CalcSlope() {
-  slope_.assign(number_of_stages_, math::Vector<N>(0.0));
-
-  for (size_t i = 0; i < number_of_stages_; i++) {
+template <size_t N, class Tableau>
+void RungeKutta<N, Tableau>::CalcSlope() {
+  for (size_t i = 0; i < kNumberOfStages; i++) {
     math::Vector<N> state = this->current_state_;
-    for (size_t j = 0; j < i; j++) {
-      state = state + rk_matrix_[i][j] * this->step_width_ * slope_[j];
-    }
-    double independent_variable = this->current_independent_variable_ + nodes_[i] * this->step_width_;
+    AddWeightedSlopes(Tableau::kRkMatrix[i], i, state);
+    const double independent_variable = this->current_independent_variable_ + Tableau::kNodes[i] * this->step_width_;
     slope_[i] = this->ode_.DerivativeFunction(independent_variable, state);
   }
 }
 
+template <size_t N, class Tableau>
+void RungeKutta<N, Tableau>::AddWeightedSlopes(const std::array<double, kNumberOfStages>& weights, const size_t number_of_slopes,
+                                               math::Vector<N>& state) const {
+  for (size_t j = 0; j < number_of_slopes; j++) {
+    // Many coefficients of the tableaux are zero
+    if (weights[j] == 0.0) continue;
+    const double coefficient = weights[j] * this->step_width_;
+    for (size_t k = 0; k < N; k++) {
+      state[k] += coefficient * slope_[j][k];
+    }
+  }
+}
+
 }  // namespace s2e::numerical_integration
 
 #endif  // S2E_LIBRARY_NUMERICAL_INTEGRATION_RUNGE_KUTTA_TEMPLATE_HPP_
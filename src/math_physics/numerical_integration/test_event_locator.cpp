@@ -0,0 +1,174 @@
+/**
+ * @file test_event_locator.cpp
+ * @brief Test codes for EventLocator class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include "dormand_prince_5.hpp"
+#include "event_locator.hpp"
+#include "ode_examples.hpp"
+#include "runge_kutta_4.hpp"
+#include "runge_kutta_fehlberg.hpp"
+
+/**
+ * @class CountingTwoBodyOrbitOde
+ * @brief 2D two body orbit which counts the number of derivative evaluations
+ */
+class CountingTwoBodyOrbitOde : public s2e::numerical_integration::Example2dTwoBodyOrbitOde {
+ public:
+  virtual s2e::math::Vector<4> DerivativeFunction(const double time_s, const s2e::math::Vector<4>& state) const {
+    number_of_evaluations_++;
+    return Example2dTwoBodyOrbitOde::DerivativeFunction(time_s, state);
+  }
+  mutable size_t number_of_evaluations_ = 0;
+};
+
+/**
+ * @class YPositionSwitchingFunction
+ * @brief Switching function for the crossing of the x axis
+ */
+class YPositionSwitchingFunction : public s2e::numerical_integration::InterfaceSwitchingFunction<4> {
+ public:
+  virtual double CalcSwitchingFunction(const double time_s, const s2e::math::Vector<4>& state) const {
+    UNUSED(time_s);
+    return state[1];
+  }
+};
+
+/**
+ * @class RadiusSwitchingFunction
+ * @brief Switching function for the crossing of the radius threshold
+ */
+class RadiusSwitchingFunction : public s2e::numerical_integration::InterfaceSwitchingFunction<4> {
+ public:
+  RadiusSwitchingFunction(const double threshold) : threshold_(threshold) {}
+  virtual double CalcSwitchingFunction(const double time_s, const s2e::math::Vector<4>& state) const {
+    UNUSED(time_s);
+    return sqrt(state[0] * state[0] + state[1] * state[1]) - threshold_;
+  }
+
+ private:
+  double threshold_;
+};
+
+/**
+ * @brief Test for x axis crossing of 2D two body orbit at periapsis and apoapsis
+ */
+TEST(EventLocator, LocateAxisCrossingDp5) {
+  CountingTwoBodyOrbitOde ode;
+  const double step_width_s = 0.1;
+  s2e::numerical_integration::DormandPrince5<4> dp5_ode(step_width_s, ode);
+
+  s2e::math::Vector<4> initial_state(0.0);
+  const double eccentricity = 0.1;
+  initial_state[0] = 1.0 - eccentricity;
+  initial_state[3] = sqrt((1.0 + eccentricity) / (1.0 - eccentricity));
+  dp5_ode.SetState(0.0, initial_state);
+
+  s2e::numerical_integration::EventLocator<4> event_locator(dp5_ode, 1e-10);
+  YPositionSwitchingFunction y_position;
+  const size_t id = event_locator.AddSwitchingFunction(y_position);
+
+  // The orbital period is 2 pi for the unit semi major axis and gravity constant
+  const double pi = 3.14159265358979323846;
+  std::vector<s2e::numerical_integration::Event<4>> events;
+  while (dp5_ode.GetIndependentVariable() < 2.0 * pi + 1.0) {
+    dp5_ode.Integrate();
+    const size_t number_of_evaluations = ode.number_of_evaluations_;
+    if (event_locator.Locate()) {
+      events.insert(events.end(), event_locator.GetEvents().begin(), event_locator.GetEvents().end());
+    }
+    // No additional derivative evaluation for the event location
+    EXPECT_EQ(number_of_evaluations, ode.number_of_evaluations_);
+  }
+
+  ASSERT_EQ(2, events.size());
+  EXPECT_EQ(id, events[0].function_id);
+  EXPECT_EQ(s2e::numerical_integration::EventDirection::kDecreasing, events[0].direction);
+  EXPECT_NEAR(pi, events[0].independent_variable, 1e-6);
+  EXPECT_NEAR(-(1.0 + eccentricity), events[0].state[0], 1e-6);
+  EXPECT_NEAR(0.0, events[0].state[1], 1e-9);
+  EXPECT_EQ(s2e::numerical_integration::EventDirection::kIncreasing, events[1].direction);
+  EXPECT_NEAR(2.0 * pi, events[1].independent_variable, 1e-6);
+  EXPECT_NEAR(1.0 - eccentricity, events[1].state[0], 1e-6);
+}
+
+/**
+ * @brief Test for direction filter and order of events with radius threshold crossing
+ */
+TEST(EventLocator, LocateRadiusCrossingRkf) {
+  CountingTwoBodyOrbitOde ode;
+  const double step_width_s = 0.1;
+  s2e::numerical_integration::RungeKuttaFehlberg<4> rkf_ode(step_width_s, ode);
+
+  s2e::math::Vector<4> initial_state(0.0);
+  const double eccentricity = 0.1;
+  initial_state[0] = 1.0 - eccentricity;
+  initial_state[3] = sqrt((1.0 + eccentricity) / (1.0 - eccentricity));
+  rkf_ode.SetState(0.0, initial_state);
+
+  s2e::numerical_integration::EventLocator<4> event_locator(rkf_ode, 1e-10);
+  RadiusSwitchingFunction radius(1.0);
+  YPositionSwitchingFunction y_position;
+  const size_t radius_id = event_locator.AddSwitchingFunction(radius, s2e::numerical_integration::EventDirection::kIncreasing);
+  const size_t y_position_id = event_locator.AddSwitchingFunction(y_position, s2e::numerical_integration::EventDirection::kDecreasing);
+
+  // Radius equals to the semi major axis at the eccentric anomaly of pi / 2
+  const double pi = 3.14159265358979323846;
+  const double expected_time_s = pi / 2.0 - eccentricity;
+
+  std::vector<s2e::numerical_integration::Event<4>> events;
+  while (rkf_ode.GetIndependentVariable() < 2.0 * pi + 1.0) {
+    rkf_ode.Integrate();
+    const size_t number_of_evaluations = ode.number_of_evaluations_;
+    if (event_locator.Locate()) {
+      events.insert(events.end(), event_locator.GetEvents().begin(), event_locator.GetEvents().end());
+      // The slope at the step end is evaluated once for the interpolation
+      EXPECT_EQ(number_of_evaluations + 1, ode.number_of_evaluations_);
+    } else {
+      EXPECT_EQ(number_of_evaluations, ode.number_of_evaluations_);
+    }
+  }
+
+  ASSERT_EQ(2, events.size());
+  EXPECT_EQ(radius_id, events[0].function_id);
+  EXPECT_NEAR(expected_time_s, events[0].independent_variable, 1e-5);
+  EXPECT_NEAR(1.0, sqrt(events[0].state[0] * events[0].state[0] + events[0].state[1] * events[0].state[1]), 1e-6);
+  EXPECT_EQ(y_position_id, events[1].function_id);
+  EXPECT_NEAR(pi, events[1].independent_variable, 1e-5);
+}
+
+/**
+ * @brief Test for the integrator without interpolation. The event is reported at the end of the step.
+ */
+TEST(EventLocator, LocateAtStepEndRk4) {
+  s2e::numerical_integration::Example2dTwoBodyOrbitOde ode;
+  const double step_width_s = 0.5;
+  s2e::numerical_integration::RungeKutta4<4> rk4_ode(step_width_s, ode);
+
+  s2e::math::Vector<4> initial_state(0.0);
+  initial_state[0] = 1.0;
+  initial_state[3] = 1.0;
+  rk4_ode.SetState(0.0, initial_state);
+
+  s2e::numerical_integration::EventLocator<4> event_locator(rk4_ode, 1e-10);
+  YPositionSwitchingFunction y_position;
+  event_locator.AddSwitchingFunction(y_position);
+
+  // The first crossing at t = pi is in the 7th step [3.0, 3.5]
+  for (size_t i = 0; i < 6; i++) {
+    rk4_ode.Integrate();
+    EXPECT_FALSE(event_locator.Locate());
+  }
+  rk4_ode.Integrate();
+  ASSERT_TRUE(event_locator.Locate());
+  ASSERT_EQ(1, event_locator.GetEvents().size());
+
+  const s2e::numerical_integration::Event<4>& event = event_locator.GetEvents()[0];
+  EXPECT_EQ(s2e::numerical_integration::EventDirection::kDecreasing, event.direction);
+  EXPECT_DOUBLE_EQ(rk4_ode.GetIndependentVariable(), event.independent_variable);
+  EXPECT_DOUBLE_EQ(3.5, event.independent_variable);
+  for (size_t i = 0; i < 4; i++) {
+    EXPECT_DOUBLE_EQ(rk4_ode.GetState()[i], event.state[i]);
+  }
+}
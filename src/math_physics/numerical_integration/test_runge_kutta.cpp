@@ -6,6 +6,7 @@
 
 #include "../orbit/kepler_orbit.hpp"
 #include "dormand_prince_5.hpp"
+#include "dormand_prince_87.hpp"
 #include "numerical_integrator_manager.hpp"
 #include "ode_examples.hpp"
 #include "runge_kutta_4.hpp"
@@ -22,6 +23,22 @@ TEST(NUMERICAL_INTEGRATION, Constructor) {
   EXPECT_DOUBLE_EQ(0.0, state[0]);
 }
 
+/**
+ * @brief Test for the interpolation support flag of each integrator
+ */
+TEST(NUMERICAL_INTEGRATION, IsInterpolationSupported) {
+  s2e::numerical_integration::ExampleLinearOde ode;
+  s2e::numerical_integration::RungeKutta4<1> rk4_ode(0.1, ode);
+  s2e::numerical_integration::RungeKuttaFehlberg<1> rkf_ode(0.1, ode);
+  s2e::numerical_integration::DormandPrince5<1> dp5_ode(0.1, ode);
+  s2e::numerical_integration::DormandPrince87<1> dp87_ode(0.1, ode);
+
+  EXPECT_FALSE(rk4_ode.IsInterpolationSupported());
+  EXPECT_TRUE(rkf_ode.IsInterpolationSupported());
+  EXPECT_TRUE(dp5_ode.IsInterpolationSupported());
+  EXPECT_FALSE(dp87_ode.IsInterpolationSupported());
+}
+
 /**
  * @brief Test for integration with nominal linear function with RK4
  */
@@ -698,3 +715,95 @@ TEST(NUMERICAL_INTEGRATION, Interpolation2dTwoBodyOrbitLargeEccentricity) {
   EXPECT_NEAR(kepler.GetVelocity_i_m_s()[0], state_dp5[2], error_tolerance);
   EXPECT_NEAR(kepler.GetVelocity_i_m_s()[1], state_dp5[3], error_tolerance);
 }
+
+/**
+ * @brief Accuracy and convergence order of RK8(7)13M with 2D two body orbit
+ */
+TEST(NUMERICAL_INTEGRATION, Integrate2dTwoBodyOrbitDp87) {
+  s2e::numerical_integration::Example2dTwoBodyOrbitOde ode;
+
+  s2e::math::Vector<4> initial_state(0.0);
+  const double eccentricity = 0.1;
+  initial_state[0] = 1.0 - eccentricity;
+  initial_state[1] = 0.0;
+  initial_state[2] = 0.0;
+  initial_state[3] = sqrt((1.0 + eccentricity) / (1.0 - eccentricity));
+
+  // Estimation by Kepler Orbit calculation
+  s2e::math::Vector<3> initial_position(0.0);
+  s2e::math::Vector<3> initial_velocity(0.0);
+  initial_position[0] = initial_state[0];
+  initial_velocity[1] = initial_state[3];
+  s2e::orbit::OrbitalElements oe(1.0, 0.0, initial_position, initial_velocity);
+  s2e::orbit::KeplerOrbit kepler(1.0, oe);
+  const double end_time_s = 5.0;
+  kepler.CalcOrbit(end_time_s / (24.0 * 60.0 * 60.0));
+
+  double position_errors[2];
+  const double step_widths_s[2] = {0.5, 0.25};
+  for (size_t trial = 0; trial < 2; trial++) {
+    s2e::numerical_integration::NumericalIntegratorManager<4> numerical_integrator(step_widths_s[trial], ode,
+                                                                                   s2e::numerical_integration::NumericalIntegrationMethod::kDp87);
+    numerical_integrator.GetIntegrator()->SetState(0.0, initial_state);
+    const size_t step_num = (size_t)(end_time_s / step_widths_s[trial] + 0.5);
+    for (size_t i = 0; i < step_num; i++) {
+      numerical_integrator.GetIntegrator()->Integrate();
+    }
+    s2e::math::Vector<4> state = numerical_integrator.GetIntegrator()->GetState();
+    position_errors[trial] = sqrt(pow(kepler.GetPosition_i_m()[0] - state[0], 2.0) + pow(kepler.GetPosition_i_m()[1] - state[1], 2.0));
+    EXPECT_NEAR(kepler.GetVelocity_i_m_s()[0], state[2], 1e-6);
+    EXPECT_NEAR(kepler.GetVelocity_i_m_s()[1], state[3], 1e-6);
+  }
+  EXPECT_LT(position_errors[0], 1e-6);
+  // 8th order method: the error decreases by about 2^8 when the step width is halved
+  EXPECT_GT(position_errors[0] / position_errors[1], 100.0);
+}
+
+/**
+ * @brief Accuracy of adaptive step integration and interpolation with 2D two body orbit with large eccentricity
+ */
+TEST(NUMERICAL_INTEGRATION, IntegrateWithStepControl2dTwoBodyOrbitLargeEccentricity) {
+  s2e::numerical_integration::Example2dTwoBodyOrbitOde ode;
+  s2e::numerical_integration::DormandPrince5<4> dp5_ode(0.01, ode);
+
+  s2e::math::Vector<4> initial_state(0.0);
+  const double eccentricity = 0.9;
+  initial_state[0] = 1.0 - eccentricity;
+  initial_state[1] = 0.0;
+  initial_state[2] = 0.0;
+  initial_state[3] = sqrt((1.0 + eccentricity) / (1.0 - eccentricity));
+  dp5_ode.SetState(0.0, initial_state);
+
+  // Integrate until the step covers the end time, and get the state at the end time with the interpolation
+  const double end_time_s = 20.0;
+  const double error_tolerance = 1e-8;
+  size_t step_num = 0;
+  while (true) {
+    const double step_start_time_s = dp5_ode.GetIndependentVariable();
+    EXPECT_TRUE(dp5_ode.IntegrateWithStepControl(error_tolerance));
+    step_num++;
+    if (dp5_ode.GetIndependentVariable() >= end_time_s) {
+      const double sigma = (end_time_s - step_start_time_s) / dp5_ode.GetStepWidth();
+      const s2e::math::Vector<4> state = dp5_ode.CalcInterpolationState(sigma);
+
+      // Estimation by Kepler Orbit calculation
+      s2e::math::Vector<3> initial_position(0.0);
+      s2e::math::Vector<3> initial_velocity(0.0);
+      initial_position[0] = initial_state[0];
+      initial_velocity[1] = initial_state[3];
+      s2e::orbit::OrbitalElements oe(1.0, 0.0, initial_position, initial_velocity);
+      s2e::orbit::KeplerOrbit kepler(1.0, oe);
+      kepler.CalcOrbit(end_time_s / (24.0 * 60.0 * 60.0));
+
+      const double accuracy = 1e-5;
+      EXPECT_NEAR(kepler.GetPosition_i_m()[0], state[0], accuracy);
+      EXPECT_NEAR(kepler.GetPosition_i_m()[1], state[1], accuracy);
+      EXPECT_NEAR(kepler.GetVelocity_i_m_s()[0], state[2], accuracy);
+      EXPECT_NEAR(kepler.GetVelocity_i_m_s()[1], state[3], accuracy);
+      break;
+    }
+    dp5_ode.SetStepWidth(dp5_ode.CalcOptimalStepWidth(error_tolerance));
+  }
+  // The fixed step integration in Integrate2dTwoBodyOrbitLargeEccentricity needs 2000 steps with worse accuracy
+  EXPECT_LT(step_num, 1000);
+}
@@ -0,0 +1,249 @@
+/**
+ * @file chebyshev_ephemeris.cpp
+ * @brief Pre-generated ephemeris of celestial bodies expressed with Chebyshev polynomials
+ */
+
+#include "chebyshev_ephemeris.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+
+namespace s2e::orbit {
+
+// File format (native byte order)
+// Header: magic, start time, segment length, number of segments, degree, number of bodies, frame name, aberration correction, center body name
+// Each body: ID, name, gravity constant, radii, coefficients of all segments
+static const char kFileMagic[8] = {'S', '2', 'E', 'E', 'P', 'H', '0', '1'};
+static const size_t kOrbitDimension = 6;
+// Limits of the header values to reject a broken file before allocating memory
+static const size_t kMaxDegree = 1024;
+static const size_t kMaxNumberOfBodies = 1024;
+// Minimum size of a body without coefficients: ID, length of the name, gravity constant and radii
+static const uint64_t kMinBodySize = sizeof(int32_t) + sizeof(uint64_t) + 4 * sizeof(double);
+
+/**
+ * @fn WriteValue
+ * @brief Write a value as binary
+ */
+template <typename T>
+static void WriteValue(std::ofstream& file, const T value) {
+  file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+/**
+ * @fn ReadValue
+ * @brief Read a value as binary
+ */
+template <typename T>
+static T ReadValue(std::ifstream& file) {
+  T value{};
+  file.read(reinterpret_cast<char*>(&value), sizeof(T));
+  return value;
+}
+
+/**
+ * @fn WriteString
+ * @brief Write a string with its length
+ */
+static void WriteString(std::ofstream& file, const std::string& value) {
+  WriteValue<uint64_t>(file, value.size());
+  file.write(value.data(), value.size());
+}
+
+/**
+ * @fn ReadString
+ * @brief Read a string written by WriteString
+ */
+static std::string ReadString(std::ifstream& file) {
+  const uint64_t length = ReadValue<uint64_t>(file);
+  // Names in the ephemeris are short. A long length means a broken file.
+  const uint64_t kMaxLength = 1024;
+  if (!file || length > kMaxLength) {
+    file.setstate(std::ios::failbit);
+    return "";
+  }
+  std::string value(length, '\0');
+  file.read(&value[0], length);
+  return value;
+}
+
+/**
+ * @fn CalcRemainingFileSize
+ * @brief Return the size from the current read position to the end of the file
+ */
+static uint64_t CalcRemainingFileSize(std::ifstream& file) {
+  const std::streampos current_position = file.tellg();
+  file.seekg(0, std::ios::end);
+  const std::streampos end_position = file.tellg();
+  file.seekg(current_position);
+  if (!file || end_position < current_position) return 0;
+  return (uint64_t)(end_position - current_position);
+}
+
+ChebyshevEphemeris::ChebyshevEphemeris(const double start_ephemeris_time_s, const double segment_length_s, const size_t number_of_segments,
+                                       const size_t degree, const std::string inertial_frame_name, const std::string aberration_correction_setting,
+                                       const std::string center_body_name)
+    : start_ephemeris_time_s_(start_ephemeris_time_s),
+      segment_length_s_(segment_length_s),
+      number_of_segments_(number_of_segments),
+      degree_(degree),
+      inertial_frame_name_(inertial_frame_name),
+      aberration_correction_setting_(aberration_correction_setting),
+      center_body_name_(center_body_name) {}
+
+std::vector<double> ChebyshevEphemeris::CalcSegmentNodes(const size_t segment_index) const {
+  const double segment_start_s = start_ephemeris_time_s_ + segment_length_s_ * segment_index;
+  return math::ChebyshevInterpolation::CalcNodes(segment_start_s, segment_start_s + segment_length_s_, degree_);
+}
+
+bool ChebyshevEphemeris::AddBody(const EphemerisBodyInformation& body_information,
+                                 const std::vector<std::vector<std::vector<double>>>& orbits_at_nodes_km) {
+  if (orbits_at_nodes_km.size() != number_of_segments_) return false;
+
+  std::vector<math::ChebyshevInterpolation> segments;
+  for (size_t segment_index = 0; segment_index < number_of_segments_; segment_index++) {
+    const std::vector<std::vector<double>>& orbits_km = orbits_at_nodes_km[segment_index];
+    if (orbits_km.size() != degree_ + 1) return false;
+    for (const std::vector<double>& orbit_km : orbits_km) {
+      if (orbit_km.size() != kOrbitDimension) return false;
+    }
+    const double segment_start_s = start_ephemeris_time_s_ + segment_length_s_ * segment_index;
+    segments.push_back(math::ChebyshevInterpolation(segment_start_s, segment_start_s + segment_length_s_, orbits_km));
+  }
+  bodies_.push_back(body_information);
+  orbits_.push_back(segments);
+  return true;
+}
+
+bool ChebyshevEphemeris::WriteFile(const std::string& file_name) const {
+  std::ofstream file(file_name, std::ios::binary);
+  if (!file.is_open()) {
+    std::cout << "[Warning] Ephemeris file cannot be opened: " << file_name << std::endl;
+    return false;
+  }
+
+  file.write(kFileMagic, sizeof(kFileMagic));
+  WriteValue<double>(file, start_ephemeris_time_s_);
+  WriteValue<double>(file, segment_length_s_);
+  WriteValue<uint64_t>(file, number_of_segments_);
+  WriteValue<uint64_t>(file, degree_);
+  WriteValue<uint64_t>(file, bodies_.size());
+  WriteString(file, inertial_frame_name_);
+  WriteString(file, aberration_correction_setting_);
+  WriteString(file, center_body_name_);
+
+  for (size_t body_index = 0; body_index < bodies_.size(); body_index++) {
+    const EphemerisBodyInformation& body = bodies_[body_index];
+    WriteValue<int32_t>(file, body.id);
+    WriteString(file, body.name);
+    WriteValue<double>(file, body.gravity_constant_m3_s2);
+    for (size_t i = 0; i < 3; i++) WriteValue<double>(file, body.radii_m[i]);
+    for (const math::ChebyshevInterpolation& segment : orbits_[body_index]) {
+      const std::vector<double>& coefficients = segment.GetCoefficients();
+      file.write(reinterpret_cast<const char*>(coefficients.data()), sizeof(double) * coefficients.size());
+    }
+  }
+
+  if (!file) {
+    std::cout << "[Warning] Ephemeris file writing failed: " << file_name << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool ChebyshevEphemeris::ReadFile(const std::string& file_name) {
+  std::ifstream file(file_name, std::ios::binary);
+  if (!file.is_open()) {
+    std::cout << "[Warning] Ephemeris file not found: " << file_name << std::endl;
+    return false;
+  }
+
+  char magic[sizeof(kFileMagic)];
+  file.read(magic, sizeof(magic));
+  if (!file || std::string(magic, sizeof(magic)) != std::string(kFileMagic, sizeof(kFileMagic))) {
+    std::cout << "[Warning] Unsupported ephemeris file format: " << file_name << std::endl;
+    return false;
+  }
+
+  const double start_ephemeris_time_s = ReadValue<double>(file);
+  const double segment_length_s = ReadValue<double>(file);
+  const size_t number_of_segments = (size_t)ReadValue<uint64_t>(file);
+  const size_t degree = (size_t)ReadValue<uint64_t>(file);
+  const size_t number_of_bodies = (size_t)ReadValue<uint64_t>(file);
+  const std::string inertial_frame_name = ReadString(file);
+  const std::string aberration_correction_setting = ReadString(file);
+  const std::string center_body_name = ReadString(file);
+  if (!file || !(segment_length_s > 0.0) || degree > kMaxDegree || number_of_bodies > kMaxNumberOfBodies) {
+    std::cout << "[Warning] Broken ephemeris file header: " << file_name << std::endl;
+    return false;
+  }
+
+  // The coefficients of all bodies and segments must be in the rest of the file. The divisions avoid the overflow of the products.
+  const size_t number_of_coefficients = (degree + 1) * kOrbitDimension;
+  const uint64_t segment_size = sizeof(double) * number_of_coefficients;
+  const uint64_t remaining_size = CalcRemainingFileSize(file);
+  if (number_of_segments > remaining_size / segment_size ||
+      number_of_bodies > remaining_size / (kMinBodySize + number_of_segments * segment_size)) {
+    std::cout << "[Warning] Ephemeris file is smaller than its header: " << file_name << std::endl;
+    return false;
+  }
+
+  std::vector<EphemerisBodyInformation> bodies;
+  std::vector<std::vector<math::ChebyshevInterpolation>> orbits;
+  for (size_t body_index = 0; body_index < number_of_bodies && file; body_index++) {
+    EphemerisBodyInformation body;
+    body.id = ReadValue<int32_t>(file);
+    body.name = ReadString(file);
+    body.gravity_constant_m3_s2 = ReadValue<double>(file);
+    for (size_t i = 0; i < 3; i++) body.radii_m[i] = ReadValue<double>(file);
+
+    std::vector<math::ChebyshevInterpolation> segments;
+    std::vector<double> coefficients(number_of_coefficients);
+    for (size_t segment_index = 0; segment_index < number_of_segments && file; segment_index++) {
+      file.read(reinterpret_cast<char*>(coefficients.data()), sizeof(double) * number_of_coefficients);
+      const double segment_start_s = start_ephemeris_time_s + segment_length_s * segment_index;
+      segments.push_back(math::ChebyshevInterpolation(segment_start_s, segment_start_s + segment_length_s, kOrbitDimension, coefficients));
+    }
+    bodies.push_back(body);
+    orbits.push_back(segments);
+  }
+  if (!file) {
+    std::cout << "[Warning] Broken ephemeris file: " << file_name << std::endl;
+    return false;
+  }
+
+  start_ephemeris_time_s_ = start_ephemeris_time_s;
+  segment_length_s_ = segment_length_s;
+  number_of_segments_ = number_of_segments;
+  degree_ = degree;
+  inertial_frame_name_ = inertial_frame_name;
+  aberration_correction_setting_ = aberration_correction_setting;
+  center_body_name_ = center_body_name;
+  bodies_ = bodies;
+  orbits_ = orbits;
+  return true;
+}
+
+bool ChebyshevEphemeris::CalcOrbit(const size_t body_index, const double ephemeris_time_s, double orbit_km[6]) const {
+  if (body_index >= orbits_.size() || number_of_segments_ == 0) return false;
+
+  const double elapsed_segments = (ephemeris_time_s - start_ephemeris_time_s_) / segment_length_s_;
+  const bool is_in_range = elapsed_segments >= 0.0 && elapsed_segments <= (double)number_of_segments_;
+  // Clamp to the time span, since the Chebyshev series diverges outside its segment. The end of the time span belongs to the last segment.
+  size_t segment_index = 0;
+  double clamped_time_s = ephemeris_time_s;
+  if (elapsed_segments >= (double)number_of_segments_) {
+    segment_index = number_of_segments_ - 1;
+    clamped_time_s = GetEndEphemerisTime_s();
+  } else if (elapsed_segments > 0.0) {
+    segment_index = (size_t)floor(elapsed_segments);
+  } else {
+    clamped_time_s = start_ephemeris_time_s_;
+  }
+  orbits_[body_index][segment_index].CalcValue(clamped_time_s, orbit_km);
+  return is_in_range;
+}
+
+}  // namespace s2e::orbit
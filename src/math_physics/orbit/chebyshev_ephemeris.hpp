@@ -0,0 +1,150 @@
+/**
+ * @file chebyshev_ephemeris.hpp
+ * @brief Pre-generated ephemeris of celestial bodies expressed with Chebyshev polynomials
+ */
+
+#ifndef S2E_LIBRARY_ORBIT_CHEBYSHEV_EPHEMERIS_HPP_
+#define S2E_LIBRARY_ORBIT_CHEBYSHEV_EPHEMERIS_HPP_
+
+#include <math_physics/math/chebyshev_interpolation.hpp>
+#include <string>
+#include <vector>
+
+namespace s2e::orbit {
+
+/**
+ * @struct EphemerisBodyInformation
+ * @brief Constant information of a celestial body stored in the ephemeris
+ */
+struct EphemerisBodyInformation {
+  int id = 0;                           //!< SPICE ID
+  std::string name;                     //!< SPICE name
+  double gravity_constant_m3_s2 = 0.0;  //!< Gravity constant [m^3/s^2]
+  double radii_m[3] = {0.0, 0.0, 0.0};  //!< 3 axis planetographic radii [m]
+};
+
+/**
+ * @class ChebyshevEphemeris
+ * @brief Pre-generated ephemeris of celestial bodies expressed with Chebyshev polynomials
+ * @details The time span is divided into segments with the same length, and the position [km] and velocity [km/s] of each body are approximated
+ *          with Chebyshev polynomials in each segment. The ephemeris is immutable after generation or reading, so it can be shared between cases.
+ */
+class ChebyshevEphemeris {
+ public:
+  /**
+   * @fn ChebyshevEphemeris
+   * @brief Default constructor for an empty ephemeris. Use ReadFile to load the ephemeris.
+   */
+  ChebyshevEphemeris() {}
+  /**
+   * @fn ChebyshevEphemeris
+   * @brief Constructor for generation
+   * @param [in] start_ephemeris_time_s: Start of the time span [s]
+   * @param [in] segment_length_s: Length of a segment [s]
+   * @param [in] number_of_segments: Number of segments
+   * @param [in] degree: Degree of the Chebyshev polynomials
+   * @param [in] inertial_frame_name: Definition of inertial frame
+   * @param [in] aberration_correction_setting: Stellar aberration correction
+   * @param [in] center_body_name: Center body name of inertial frame
+   */
+  ChebyshevEphemeris(const double start_ephemeris_time_s, const double segment_length_s, const size_t number_of_segments, const size_t degree,
+                     const std::string inertial_frame_name, const std::string aberration_correction_setting, const std::string center_body_name);
+
+  /**
+   * @fn CalcSegmentNodes
+   * @brief Calculate the ephemeris times where the orbit should be sampled for a segment
+   * @param [in] segment_index: Index of the segment
+   * @return Ephemeris times of the Chebyshev nodes [s]
+   */
+  std::vector<double> CalcSegmentNodes(const size_t segment_index) const;
+  /**
+   * @fn AddBody
+   * @brief Add a body to the ephemeris
+   * @param [in] body_information: Constant information of the body
+   * @param [in] orbits_at_nodes_km: Position [km] and velocity [km/s] at the nodes of CalcSegmentNodes stored as [segment][node][6]
+   * @return True when the size of the orbits is consistent with the ephemeris setting
+   */
+  bool AddBody(const EphemerisBodyInformation& body_information, const std::vector<std::vector<std::vector<double>>>& orbits_at_nodes_km);
+
+  /**
+   * @fn WriteFile
+   * @brief Write the ephemeris to a binary file
+   * @param [in] file_name: Path to the file
+   * @return True when succeeded
+   */
+  bool WriteFile(const std::string& file_name) const;
+  /**
+   * @fn ReadFile
+   * @brief Read the ephemeris from a binary file written by WriteFile
+   * @note The header values are checked against the limits and the file size before allocating memory. The ephemeris is not changed when
+   *       the reading fails.
+   * @param [in] file_name: Path to the file
+   * @return True when succeeded
+   */
+  bool ReadFile(const std::string& file_name);
+
+  /**
+   * @fn CalcOrbit
+   * @brief Calculate position and velocity of a body
+   * @note The orbit at the nearest end of the time span is returned when the time is out of the time span, since the Chebyshev series
+   *       diverges quickly outside its segment.
+   * @param [in] body_index: Index of the body
+   * @param [in] ephemeris_time_s: Ephemeris time [s]
+   * @param [out] orbit_km: Position [km] and velocity [km/s]
+   * @return True when the time is in the time span
+   */
+  bool CalcOrbit(const size_t body_index, const double ephemeris_time_s, double orbit_km[6]) const;
+
+  // Getters
+  /**
+   * @fn GetNumberOfBodies
+   * @brief Return number of bodies
+   */
+  inline size_t GetNumberOfBodies() const { return bodies_.size(); }
+  /**
+   * @fn GetBodyInformation
+   * @brief Return constant information of a body
+   */
+  inline const EphemerisBodyInformation& GetBodyInformation(const size_t body_index) const { return bodies_[body_index]; }
+  /**
+   * @fn GetStartEphemerisTime_s
+   * @brief Return start of the time span [s]
+   */
+  inline double GetStartEphemerisTime_s() const { return start_ephemeris_time_s_; }
+  /**
+   * @fn GetEndEphemerisTime_s
+   * @brief Return end of the time span [s]
+   */
+  inline double GetEndEphemerisTime_s() const { return start_ephemeris_time_s_ + segment_length_s_ * number_of_segments_; }
+  /**
+   * @fn GetInertialFrameName
+   * @brief Return definition of inertial frame
+   */
+  inline const std::string& GetInertialFrameName() const { return inertial_frame_name_; }
+  /**
+   * @fn GetAberrationCorrectionSetting
+   * @brief Return stellar aberration correction
+   */
+  inline const std::string& GetAberrationCorrectionSetting() const { return aberration_correction_setting_; }
+  /**
+   * @fn GetCenterBodyName
+   * @brief Return center body name of inertial frame
+   */
+  inline const std::string& GetCenterBodyName() const { return center_body_name_; }
+
+ private:
+  double start_ephemeris_time_s_ = 0.0;        //!< Start of the time span [s]
+  double segment_length_s_ = 0.0;              //!< Length of a segment [s]
+  size_t number_of_segments_ = 0;              //!< Number of segments
+  size_t degree_ = 0;                          //!< Degree of the Chebyshev polynomials
+  std::string inertial_frame_name_;            //!< Definition of inertial frame
+  std::string aberration_correction_setting_;  //!< Stellar aberration correction
+  std::string center_body_name_;               //!< Center body name of inertial frame
+
+  std::vector<EphemerisBodyInformation> bodies_;                  //!< Constant information of bodies
+  std::vector<std::vector<math::ChebyshevInterpolation>> orbits_;  //!< Chebyshev approximation of orbits stored as [body][segment]
+};
+
+}  // namespace s2e::orbit
+
+#endif  // S2E_LIBRARY_ORBIT_CHEBYSHEV_EPHEMERIS_HPP_
@@ -5,6 +5,8 @@
 
 #include "interpolation_orbit.hpp"
 
+#include <cmath>
+
 namespace s2e::orbit {
 
 InterpolationOrbit::InterpolationOrbit(const size_t degree) {
@@ -19,6 +21,7 @@ InterpolationOrbit::InterpolationOrbit(const size_t degree) {
 }
 
 bool InterpolationOrbit::PushAndPopData(const double time, const math::Vector<3> position) {
+  ResetTrigonometricWeights();
   bool result;
   for (size_t axis = 0; axis < 3; axis++) {
     result = interpolation_position_[axis].PushAndPopData(time, position[axis]);
@@ -30,9 +33,44 @@ bool InterpolationOrbit::PushAndPopData(const double time, const math::Vector<3>
 }
 
 math::Vector<3> InterpolationOrbit::CalcPositionWithTrigonometric(const double time, const double period) const {
-  math::Vector<3> output_position;
+  const double* time_list = GetTimeList();
+  const size_t degree = GetDegree();
+  size_t start_id = 0;
+  size_t end_id = degree;
+
+  // Trigonometric interpolation needs odd number of points. The farthest point is removed as same as math::Interpolation.
+  if (degree % 2 == 0) {
+    size_t nearest_point = 0;
+    for (size_t i = 1; i < degree; i++) {
+      if (fabs(time - time_list[i]) < fabs(time - time_list[nearest_point])) nearest_point = i;
+    }
+    if (nearest_point * 2 < degree) {
+      end_id--;
+    } else {
+      start_id++;
+    }
+  }
+
+  // The node weights are calculated only when the data or the period is changed, and the basis is shared by all axes
+  if (period != trigonometric_period_) {
+    ResetTrigonometricWeights();
+    trigonometric_period_ = period;
+  }
+  math::BarycentricInterpolation& interpolation = trigonometric_interpolations_[start_id];
+  if (!is_trigonometric_weights_calculated_[start_id]) {
+    interpolation.SetPeriod(period);
+    interpolation.SetNodes(&time_list[start_id], end_id - start_id);
+    is_trigonometric_weights_calculated_[start_id] = true;
+  }
+  basis_.resize(end_id - start_id);
+  interpolation.CalcBasis(time, basis_.data());
+
+  math::Vector<3> output_position(0.0);
   for (size_t axis = 0; axis < 3; axis++) {
-    output_position[axis] = interpolation_position_[axis].CalcTrigonometric(time, period);
+    const double* position_list = GetPositionDataList(axis);
+    for (size_t i = start_id; i < end_id; i++) {
+      output_position[axis] += basis_[i - start_id] * position_list[i];
+    }
   }
   return output_position;
 }
@@ -45,4 +83,9 @@ math::Vector<3> InterpolationOrbit::CalcPositionWithPolynomial(const double time
   return output_position;
 }
 
+void InterpolationOrbit::ResetTrigonometricWeights() const {
+  is_trigonometric_weights_calculated_[0] = false;
+  is_trigonometric_weights_calculated_[1] = false;
+}
+
 }  // namespace s2e::orbit
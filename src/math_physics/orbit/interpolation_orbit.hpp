@@ -6,6 +6,7 @@
 #ifndef S2E_LIBRARY_ORBIT_INTERPOLATION_ORBIT_HPP_
 #define S2E_LIBRARY_ORBIT_INTERPOLATION_ORBIT_HPP_
 
+#include <math_physics/math/barycentric_interpolation.hpp>
 #include <math_physics/math/interpolation.hpp>
 #include <math_physics/math/vector.hpp>
 #include <vector>
@@ -16,6 +17,8 @@ namespace s2e::orbit {
  * @class InterpolationOrbit
  * @brief Orbit calculation with mathematical interpolation
  * @note Coordinate and unit of position is defined by users of this function
+ * @note The calculation functions are const but use the mutable work space and the cached node weights in this class. They are not reentrant,
+ *       so that an instance must not be used from multiple threads at the same time.
  */
 class InterpolationOrbit {
  public:
@@ -59,17 +62,17 @@ class InterpolationOrbit {
   inline size_t GetDegree() const { return interpolation_position_[0].GetDegree(); }
   /**
    * @fn GetTimeList
-   * @return Time list registered for the interpolation
+   * @return Contiguous time list registered for the interpolation. The size is the degree, and it is valid until the next PushAndPopData.
    */
-  inline std::vector<double> GetTimeList() const { return interpolation_position_[0].GetIndependentVariables(); }
+  inline const double* GetTimeList() const { return interpolation_position_[0].GetIndependentVariables(); }
   /**
    * @fn GetTimeList
    * @param[in] axis: Axis of position [0, 2]
-   * @return Position list registered for the interpolation
+   * @return Contiguous position list registered for the interpolation. The size is the degree, and it is valid until the next PushAndPopData.
    * @note return id=2 data when the input axis is over 3.
    */
-  inline std::vector<double> GetPositionDataList(const size_t axis) const {
-    if (axis > 3) {
+  inline const double* GetPositionDataList(const size_t axis) const {
+    if (axis > 2) {
       return interpolation_position_[2].GetDependentVariables();
     }
     return interpolation_position_[axis].GetDependentVariables();
@@ -77,6 +80,20 @@ class InterpolationOrbit {
 
  private:
   std::vector<math::Interpolation> interpolation_position_;  // 3D vector of interpolation
+
+  // Cache of the trigonometric interpolation shared by all axes. With even degree, the window starts from the first or the second data.
+  mutable math::BarycentricInterpolation trigonometric_interpolations_[2] = {
+      math::BarycentricInterpolation(math::BarycentricInterpolationType::kTrigonometric),
+      math::BarycentricInterpolation(math::BarycentricInterpolationType::kTrigonometric)};  //!< Interpolation for each window start
+  mutable bool is_trigonometric_weights_calculated_[2] = {false, false};                    //!< Flag of node weights valid for the current data
+  mutable double trigonometric_period_ = 0.0;                                               //!< Period of the calculated node weights
+  mutable std::vector<double> basis_;                                                       //!< Work space of the basis at the time
+
+  /**
+   * @fn ResetTrigonometricWeights
+   * @brief Mark the node weights of the trigonometric interpolation to be recalculated
+   */
+  void ResetTrigonometricWeights() const;
 };
 
 }  // namespace s2e::orbit
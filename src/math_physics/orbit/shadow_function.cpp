@@ -0,0 +1,131 @@
+/**
+ * @file shadow_function.cpp
+ * @brief Shadow function of the sun occulted by celestial bodies with the conical shadow model
+ * @note Ref: O. Montenbruck and E. Gill, Satellite Orbits, Chp. 3.4.2
+ */
+
+#include "shadow_function.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <math_physics/math/constants.hpp>
+
+namespace s2e::orbit {
+
+ApparentDiskGeometry CalcApparentDiskGeometry(const math::Vector<3>& sun_position_m, const double sun_radius_m,
+                                              const math::Vector<3>& body_position_m, const double body_radius_m) {
+  ApparentDiskGeometry geometry;
+  geometry.sun_radius_rad = asin(sun_radius_m / sun_position_m.CalcNorm());
+  geometry.body_radius_rad = asin(body_radius_m / body_position_m.CalcNorm());
+
+  // Angle of deviation from the body center to the sun center
+  const math::Vector<3> body_to_sun_m = sun_position_m - body_position_m;
+  geometry.separation_rad = acos(InnerProduct(body_position_m, body_to_sun_m) / body_position_m.CalcNorm() / body_to_sun_m.CalcNorm());
+  return geometry;
+}
+
+double CalcShadowFunction(const ApparentDiskGeometry& geometry) {
+  const double a = geometry.sun_radius_rad;
+  const double b = geometry.body_radius_rad;
+  const double c = geometry.separation_rad;
+
+  if (c < fabs(a - b) && a <= b) {
+    // The occultation is total (spacecraft is in umbra)
+    return 0.0;
+  } else if (c < fabs(a - b) && a > b) {
+    // The occultation is partial but maximum
+    return 1.0 - (b * b) / (a * a);
+  } else if (fabs(a - b) <= c && c <= (a + b)) {
+    // Spacecraft is in penumbra
+    // The angle between the center of the sun and the common chord
+    const double x = (c * c + a * a - b * b) / (2.0 * c);
+    // The length of the common chord of the apparent solar disk and apparent body disk
+    const double y = sqrt(std::max(a * a - x * x, 0.0));
+    // The area of the occulted segment of the apparent solar disk
+    const double area = a * a * acos(x / a) + b * b * acos((c - x) / b) - c * y;
+    return 1.0 - area / (math::pi * a * a);
+  }
+  // No occultation takes place
+  return 1.0;
+}
+
+double CalcShadowFunction(const math::Vector<3>& sun_position_m, const double sun_radius_m, const std::vector<math::Vector<3>>& body_positions_m,
+                          const std::vector<double>& body_radii_m) {
+  const double sun_distance_m = sun_position_m.CalcNorm();
+  const double sin_sun_radius = sun_radius_m / sun_distance_m;
+  const double cos_sun_radius = sqrt(1.0 - sin_sun_radius * sin_sun_radius);
+
+  double shadow_function = 1.0;
+  for (size_t i = 0; i < body_positions_m.size(); i++) {
+    const math::Vector<3>& body_position_m = body_positions_m[i];
+    const double body_distance_m = body_position_m.CalcNorm();
+    const math::Vector<3> body_to_sun_m = sun_position_m - body_position_m;
+    const double cos_separation = InnerProduct(body_position_m, body_to_sun_m) / body_distance_m / body_to_sun_m.CalcNorm();
+
+    // Cone test: the disks overlap only when separation < sun radius + body radius, i.e. cos(separation) > cos(sum of the radii)
+    const double sin_body_radius = body_radii_m[i] / body_distance_m;
+    const double cos_body_radius = sqrt(1.0 - sin_body_radius * sin_body_radius);
+    const double cos_radius_sum = cos_sun_radius * cos_body_radius - sin_sun_radius * sin_body_radius;
+    if (!(cos_separation > cos_radius_sum)) continue;
+
+    ApparentDiskGeometry geometry;
+    geometry.sun_radius_rad = asin(sin_sun_radius);
+    geometry.body_radius_rad = asin(sin_body_radius);
+    geometry.separation_rad = acos(std::min(cos_separation, 1.0));
+    shadow_function *= CalcShadowFunction(geometry);
+  }
+  return shadow_function;
+}
+
+/**
+ * @fn CalcTimeToBoundary_s
+ * @brief Return the time when the linearly extrapolated margin becomes zero
+ * @param [in] margin_rad: Angular margin to the boundary [rad]
+ * @param [in] margin_rate_rad_s: Rate of the angular margin [rad/s]
+ * @return Time to the boundary [s]. Infinity when the margin does not approach zero.
+ */
+static double CalcTimeToBoundary_s(const double margin_rad, const double margin_rate_rad_s) {
+  const double infinity = std::numeric_limits<double>::infinity();
+  if (margin_rate_rad_s == 0.0 || !std::isfinite(margin_rate_rad_s) || !std::isfinite(margin_rad)) return infinity;
+  const double time_s = -margin_rad / margin_rate_rad_s;
+  return time_s > 0.0 ? time_s : infinity;
+}
+
+double CalcTimeToShadowEvent_s(const math::Vector<3>& sun_position_m, const math::Vector<3>& sun_velocity_m_s, const double sun_radius_m,
+                               const std::vector<math::Vector<3>>& body_positions_m, const std::vector<math::Vector<3>>& body_velocities_m_s,
+                               const std::vector<double>& body_radii_m, ShadowEvent& shadow_event) {
+  // Margins are evaluated at the current time and after a short time with the relative velocities to get their rates
+  const double dt_s = 1.0;
+  const math::Vector<3> sun_position_next_m = sun_position_m + dt_s * sun_velocity_m_s;
+
+  double time_to_event_s = std::numeric_limits<double>::infinity();
+  shadow_event = ShadowEvent::kNone;
+  for (size_t i = 0; i < body_positions_m.size(); i++) {
+    const math::Vector<3> body_position_next_m = body_positions_m[i] + dt_s * body_velocities_m_s[i];
+    const ApparentDiskGeometry geometry = CalcApparentDiskGeometry(sun_position_m, sun_radius_m, body_positions_m[i], body_radii_m[i]);
+    const ApparentDiskGeometry geometry_next = CalcApparentDiskGeometry(sun_position_next_m, sun_radius_m, body_position_next_m, body_radii_m[i]);
+
+    // Penumbra boundary
+    const double penumbra_margin_rad = geometry.CalcPenumbraMargin_rad();
+    const double penumbra_margin_rate_rad_s = (geometry_next.CalcPenumbraMargin_rad() - penumbra_margin_rad) / dt_s;
+    const double time_to_penumbra_s = CalcTimeToBoundary_s(penumbra_margin_rad, penumbra_margin_rate_rad_s);
+    if (time_to_penumbra_s < time_to_event_s) {
+      time_to_event_s = time_to_penumbra_s;
+      shadow_event = penumbra_margin_rad > 0.0 ? ShadowEvent::kPenumbraEntry : ShadowEvent::kPenumbraExit;
+    }
+
+    // Umbra boundary exists only when the body looks larger than the sun
+    if (geometry.body_radius_rad <= geometry.sun_radius_rad) continue;
+    const double umbra_margin_rad = geometry.CalcUmbraMargin_rad();
+    const double umbra_margin_rate_rad_s = (geometry_next.CalcUmbraMargin_rad() - umbra_margin_rad) / dt_s;
+    const double time_to_umbra_s = CalcTimeToBoundary_s(umbra_margin_rad, umbra_margin_rate_rad_s);
+    if (time_to_umbra_s < time_to_event_s) {
+      time_to_event_s = time_to_umbra_s;
+      shadow_event = umbra_margin_rad > 0.0 ? ShadowEvent::kUmbraEntry : ShadowEvent::kUmbraExit;
+    }
+  }
+  return time_to_event_s;
+}
+
+}  // namespace s2e::orbit
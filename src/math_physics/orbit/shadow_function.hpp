@@ -0,0 +1,104 @@
+/**
+ * @file shadow_function.hpp
+ * @brief Shadow function of the sun occulted by celestial bodies with the conical shadow model
+ * @note Ref: O. Montenbruck and E. Gill, Satellite Orbits, Chp. 3.4.2
+ */
+
+#ifndef S2E_LIBRARY_ORBIT_SHADOW_FUNCTION_HPP_
+#define S2E_LIBRARY_ORBIT_SHADOW_FUNCTION_HPP_
+
+#include <math_physics/math/vector.hpp>
+#include <vector>
+
+namespace s2e::orbit {
+
+/**
+ * @enum ShadowEvent
+ * @brief Transition of the shadow condition
+ */
+enum class ShadowEvent {
+  kNone,           //!< No transition is predicted
+  kPenumbraEntry,  //!< Entry into the penumbra
+  kUmbraEntry,     //!< Entry into the umbra
+  kUmbraExit,      //!< Exit from the umbra
+  kPenumbraExit,   //!< Exit from the penumbra
+};
+
+/**
+ * @struct ApparentDiskGeometry
+ * @brief Apparent disks of the sun and an occulting body seen from the spacecraft
+ */
+struct ApparentDiskGeometry {
+  double sun_radius_rad = 0.0;   //!< Apparent radius of the sun [rad]
+  double body_radius_rad = 0.0;  //!< Apparent radius of the occulting body [rad]
+  double separation_rad = 0.0;   //!< Angular separation between the centers of the disks [rad]
+
+  /**
+   * @fn CalcPenumbraMargin_rad
+   * @brief Return the angular margin to the penumbra boundary. Negative value means the spacecraft is in the shadow.
+   */
+  inline double CalcPenumbraMargin_rad() const { return separation_rad - (sun_radius_rad + body_radius_rad); }
+  /**
+   * @fn CalcUmbraMargin_rad
+   * @brief Return the angular margin to the umbra boundary. Negative value means the spacecraft is in the umbra.
+   * @note The value is always positive when the body looks smaller than the sun (antumbra).
+   */
+  inline double CalcUmbraMargin_rad() const { return separation_rad - (body_radius_rad - sun_radius_rad); }
+};
+
+/**
+ * @fn CalcApparentDiskGeometry
+ * @brief Calculate the apparent disks of the sun and an occulting body
+ * @param [in] sun_position_m: Sun position from the spacecraft [m]
+ * @param [in] sun_radius_m: Sun radius [m]
+ * @param [in] body_position_m: Occulting body position from the spacecraft [m]
+ * @param [in] body_radius_m: Occulting body radius [m]
+ * @return Apparent disk geometry
+ */
+ApparentDiskGeometry CalcApparentDiskGeometry(const math::Vector<3>& sun_position_m, const double sun_radius_m,
+                                              const math::Vector<3>& body_position_m, const double body_radius_m);
+
+/**
+ * @fn CalcShadowFunction
+ * @brief Calculate the ratio of the visible solar disk occulted by a body
+ * @param [in] geometry: Apparent disk geometry
+ * @return Shadow function (1: no occultation, 0: umbra)
+ */
+double CalcShadowFunction(const ApparentDiskGeometry& geometry);
+
+/**
+ * @fn CalcShadowFunction
+ * @brief Calculate the ratio of the visible solar disk occulted by multiple bodies in one pass
+ * @note Bodies which cannot occult the sun are skipped with a cone test using only square roots. The occultations by the bodies are multiplied.
+ * @param [in] sun_position_m: Sun position from the spacecraft [m]
+ * @param [in] sun_radius_m: Sun radius [m]
+ * @param [in] body_positions_m: Occulting body positions from the spacecraft [m]
+ * @param [in] body_radii_m: Occulting body radii [m]
+ * @return Shadow function (1: no occultation, 0: umbra)
+ */
+double CalcShadowFunction(const math::Vector<3>& sun_position_m, const double sun_radius_m, const std::vector<math::Vector<3>>& body_positions_m,
+                          const std::vector<double>& body_radii_m);
+
+/**
+ * @fn CalcTimeToShadowEvent_s
+ * @brief Predict the next transition of the shadow condition by multiple bodies
+ * @note The angular margins to the shadow boundaries are linearly extrapolated with their rates, which are calculated by the finite difference
+ *       over 1 second with the relative velocities. The prediction is accurate only near the boundary. Far from the boundary, it can be wrong
+ *       by minutes or miss the transition, so that the prediction should be repeated as the time to the transition becomes short.
+ *       No transition is predicted for a boundary when the rate of the margin is zero or not finite.
+ * @param [in] sun_position_m: Sun position from the spacecraft [m]
+ * @param [in] sun_velocity_m_s: Sun velocity relative to the spacecraft [m/s]
+ * @param [in] sun_radius_m: Sun radius [m]
+ * @param [in] body_positions_m: Occulting body positions from the spacecraft [m]
+ * @param [in] body_velocities_m_s: Occulting body velocities relative to the spacecraft [m/s]
+ * @param [in] body_radii_m: Occulting body radii [m]
+ * @param [out] shadow_event: Predicted transition
+ * @return Time to the transition [s]. Infinity when no transition is predicted.
+ */
+double CalcTimeToShadowEvent_s(const math::Vector<3>& sun_position_m, const math::Vector<3>& sun_velocity_m_s, const double sun_radius_m,
+                               const std::vector<math::Vector<3>>& body_positions_m, const std::vector<math::Vector<3>>& body_velocities_m_s,
+                               const std::vector<double>& body_radii_m, ShadowEvent& shadow_event);
+
+}  // namespace s2e::orbit
+
+#endif  // S2E_LIBRARY_ORBIT_SHADOW_FUNCTION_HPP_
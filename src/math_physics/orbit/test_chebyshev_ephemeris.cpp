@@ -0,0 +1,169 @@
+/**
+ * @file test_chebyshev_ephemeris.cpp
+ * @brief Test codes for ChebyshevEphemeris class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#include "chebyshev_ephemeris.hpp"
+
+using namespace s2e::orbit;
+
+/**
+ * @brief Circular orbit used as the reference ephemeris
+ */
+static void CalcCircularOrbit_km(const double radius_km, const double angular_velocity_rad_s, const double time_s, double orbit_km[6]) {
+  const double angle_rad = angular_velocity_rad_s * time_s;
+  orbit_km[0] = radius_km * cos(angle_rad);
+  orbit_km[1] = radius_km * sin(angle_rad);
+  orbit_km[2] = 0.0;
+  orbit_km[3] = -radius_km * angular_velocity_rad_s * sin(angle_rad);
+  orbit_km[4] = radius_km * angular_velocity_rad_s * cos(angle_rad);
+  orbit_km[5] = 0.0;
+}
+
+/**
+ * @brief Generate an ephemeris with two bodies in circular orbits
+ */
+static ChebyshevEphemeris GenerateEphemeris(const double start_s, const double segment_length_s, const size_t number_of_segments) {
+  ChebyshevEphemeris ephemeris(start_s, segment_length_s, number_of_segments, 12, "J2000", "NONE", "EARTH");
+  const double radii_km[] = {384400.0, 149597870.0};
+  const double angular_velocities_rad_s[] = {2.66e-6, 1.99e-7};
+  for (size_t body_index = 0; body_index < 2; body_index++) {
+    std::vector<std::vector<std::vector<double>>> orbits_km;
+    for (size_t segment_index = 0; segment_index < number_of_segments; segment_index++) {
+      std::vector<std::vector<double>> segment_orbits_km;
+      for (const double node_s : ephemeris.CalcSegmentNodes(segment_index)) {
+        std::vector<double> orbit_km(6);
+        CalcCircularOrbit_km(radii_km[body_index], angular_velocities_rad_s[body_index], node_s, orbit_km.data());
+        segment_orbits_km.push_back(orbit_km);
+      }
+      orbits_km.push_back(segment_orbits_km);
+    }
+    EphemerisBodyInformation body;
+    body.id = body_index == 0 ? 301 : 10;
+    body.name = body_index == 0 ? "MOON" : "SUN";
+    body.gravity_constant_m3_s2 = body_index == 0 ? 4.9028e12 : 1.32712e20;
+    for (size_t i = 0; i < 3; i++) body.radii_m[i] = body_index == 0 ? 1737.4e3 : 696000e3;
+    EXPECT_TRUE(ephemeris.AddBody(body, orbits_km));
+  }
+  return ephemeris;
+}
+
+/**
+ * @brief Test for orbit calculation
+ */
+TEST(ChebyshevEphemeris, CalcOrbit) {
+  const double start_s = 6.0e8;
+  const double segment_length_s = 86400.0;
+  const ChebyshevEphemeris ephemeris = GenerateEphemeris(start_s, segment_length_s, 3);
+  EXPECT_EQ(2, ephemeris.GetNumberOfBodies());
+  EXPECT_DOUBLE_EQ(start_s + 3.0 * segment_length_s, ephemeris.GetEndEphemerisTime_s());
+
+  for (double time_s = start_s; time_s <= ephemeris.GetEndEphemerisTime_s(); time_s += 3600.0) {
+    double orbit_km[6];
+    double expected_orbit_km[6];
+    EXPECT_TRUE(ephemeris.CalcOrbit(0, time_s, orbit_km));
+    CalcCircularOrbit_km(384400.0, 2.66e-6, time_s, expected_orbit_km);
+    for (size_t i = 0; i < 3; i++) {
+      EXPECT_NEAR(expected_orbit_km[i], orbit_km[i], 1e-6);
+      EXPECT_NEAR(expected_orbit_km[i + 3], orbit_km[i + 3], 1e-12);
+    }
+  }
+
+  double orbit_km[6];
+  EXPECT_FALSE(ephemeris.CalcOrbit(0, start_s - 10.0, orbit_km));
+  EXPECT_FALSE(ephemeris.CalcOrbit(0, ephemeris.GetEndEphemerisTime_s() + 10.0, orbit_km));
+  EXPECT_FALSE(ephemeris.CalcOrbit(2, start_s, orbit_km));
+
+  // The orbit is clamped to the time span instead of the divergent extrapolation of the series
+  const double end_s = ephemeris.GetEndEphemerisTime_s();
+  for (const double time_s : {start_s - 1.0e6, end_s + 1.0e6}) {
+    double edge_orbit_km[6];
+    EXPECT_FALSE(ephemeris.CalcOrbit(0, time_s, orbit_km));
+    EXPECT_TRUE(ephemeris.CalcOrbit(0, time_s < start_s ? start_s : end_s, edge_orbit_km));
+    for (size_t i = 0; i < 6; i++) EXPECT_DOUBLE_EQ(edge_orbit_km[i], orbit_km[i]);
+  }
+}
+
+/**
+ * @brief Test for writing and reading file
+ */
+TEST(ChebyshevEphemeris, WriteAndReadFile) {
+  const ChebyshevEphemeris ephemeris = GenerateEphemeris(1.0e8, 43200.0, 4);
+  const std::string file_name = "test_chebyshev_ephemeris.bin";
+  ASSERT_TRUE(ephemeris.WriteFile(file_name));
+
+  ChebyshevEphemeris read_ephemeris;
+  ASSERT_TRUE(read_ephemeris.ReadFile(file_name));
+  std::remove(file_name.c_str());
+
+  EXPECT_EQ("J2000", read_ephemeris.GetInertialFrameName());
+  EXPECT_EQ("NONE", read_ephemeris.GetAberrationCorrectionSetting());
+  EXPECT_EQ("EARTH", read_ephemeris.GetCenterBodyName());
+  EXPECT_DOUBLE_EQ(ephemeris.GetStartEphemerisTime_s(), read_ephemeris.GetStartEphemerisTime_s());
+  EXPECT_DOUBLE_EQ(ephemeris.GetEndEphemerisTime_s(), read_ephemeris.GetEndEphemerisTime_s());
+  ASSERT_EQ(2, read_ephemeris.GetNumberOfBodies());
+  EXPECT_EQ(10, read_ephemeris.GetBodyInformation(1).id);
+  EXPECT_EQ("SUN", read_ephemeris.GetBodyInformation(1).name);
+  EXPECT_DOUBLE_EQ(1.32712e20, read_ephemeris.GetBodyInformation(1).gravity_constant_m3_s2);
+  EXPECT_DOUBLE_EQ(696000e3, read_ephemeris.GetBodyInformation(1).radii_m[2]);
+
+  for (double time_s = 1.0e8; time_s <= read_ephemeris.GetEndEphemerisTime_s(); time_s += 5000.0) {
+    for (size_t body_index = 0; body_index < 2; body_index++) {
+      double orbit_km[6];
+      double read_orbit_km[6];
+      ephemeris.CalcOrbit(body_index, time_s, orbit_km);
+      read_ephemeris.CalcOrbit(body_index, time_s, read_orbit_km);
+      for (size_t i = 0; i < 6; i++) EXPECT_DOUBLE_EQ(orbit_km[i], read_orbit_km[i]);
+    }
+  }
+
+  ChebyshevEphemeris missing_ephemeris;
+  EXPECT_FALSE(missing_ephemeris.ReadFile("not_existing_ephemeris.bin"));
+}
+
+/**
+ * @brief Test for reading files with broken headers
+ */
+TEST(ChebyshevEphemeris, ReadBrokenFile) {
+  const ChebyshevEphemeris ephemeris = GenerateEphemeris(1.0e8, 43200.0, 4);
+  const std::string file_name = "test_chebyshev_ephemeris_broken.bin";
+  ASSERT_TRUE(ephemeris.WriteFile(file_name));
+  std::ifstream original_file(file_name, std::ios::binary);
+  const std::string original((std::istreambuf_iterator<char>(original_file)), std::istreambuf_iterator<char>());
+  original_file.close();
+
+  // Offsets of the number of segments, the degree and the number of bodies after the magic, the start time and the segment length
+  const size_t kNumberOfSegmentsOffset = 24;
+  const size_t kDegreeOffset = 32;
+  const size_t kNumberOfBodiesOffset = 40;
+  const uint64_t broken_values[] = {5, 100, (uint64_t)1 << 40, (uint64_t)1 << 61, UINT64_MAX};
+  for (const size_t offset : {kNumberOfSegmentsOffset, kDegreeOffset, kNumberOfBodiesOffset}) {
+    for (const uint64_t value : broken_values) {
+      std::string broken = original;
+      std::memcpy(&broken[offset], &value, sizeof(value));
+      std::ofstream broken_file(file_name, std::ios::binary);
+      broken_file.write(broken.data(), broken.size());
+      broken_file.close();
+
+      ChebyshevEphemeris read_ephemeris;
+      EXPECT_FALSE(read_ephemeris.ReadFile(file_name));
+      EXPECT_EQ(0, read_ephemeris.GetNumberOfBodies());
+    }
+  }
+
+  // Truncated file
+  std::ofstream truncated_file(file_name, std::ios::binary);
+  truncated_file.write(original.data(), original.size() - 8);
+  truncated_file.close();
+  ChebyshevEphemeris read_ephemeris;
+  EXPECT_FALSE(read_ephemeris.ReadFile(file_name));
+  std::remove(file_name.c_str());
+}
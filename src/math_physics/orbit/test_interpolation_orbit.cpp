@@ -5,6 +5,7 @@
 #include <gtest/gtest.h>
 
 #include <cmath>
+#include <vector>
 
 #include "interpolation_orbit.hpp"
 
@@ -50,3 +51,43 @@ TEST(InterpolationOrbit, PushAndPop) {
   bool ret = interpolation_orbit.PushAndPopData(time, position);
   EXPECT_FALSE(ret);
 }
+
+/**
+ * @brief Test for trigonometric interpolation with the cached node weights
+ */
+TEST(InterpolationOrbit, CalcPositionWithTrigonometric) {
+  for (const size_t degree : {8, 9}) {
+    InterpolationOrbit interpolation_orbit(degree);
+    std::vector<double> time_list(degree, -1.0);
+    std::vector<std::vector<double>> position_list(3, std::vector<double>(degree, 0.0));
+    const double step_s = 60.0;
+
+    for (size_t epoch = 0; epoch < degree + 3; epoch++) {
+      const double time_s = epoch * step_s;
+      s2e::math::Vector<3> position;
+      position[0] = 7.0e6 * cos(1.0e-3 * time_s);
+      position[1] = 7.0e6 * sin(1.0e-3 * time_s);
+      position[2] = 1.0e3 * time_s;
+      EXPECT_TRUE(interpolation_orbit.PushAndPopData(time_s, position));
+      time_list.erase(time_list.begin());
+      time_list.push_back(time_s);
+      for (size_t axis = 0; axis < 3; axis++) {
+        position_list[axis].erase(position_list[axis].begin());
+        position_list[axis].push_back(position[axis]);
+      }
+      if (epoch + 1 < degree) continue;
+
+      // The windows starting from both ends are used with even degree. The period is changed and restored in the same data.
+      for (const double period : {1.0e-3, 1.1e-3, 1.0e-3}) {
+        for (const double ratio : {0.1, 0.5, 0.9, 0.2}) {
+          const double target_time_s = time_list.front() + ratio * (time_list.back() - time_list.front());
+          const s2e::math::Vector<3> interpolated = interpolation_orbit.CalcPositionWithTrigonometric(target_time_s, period);
+          for (size_t axis = 0; axis < 3; axis++) {
+            const s2e::math::Interpolation reference(time_list, position_list[axis]);
+            EXPECT_NEAR(reference.CalcTrigonometric(target_time_s, period), interpolated[axis], 1e-6);
+          }
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,157 @@
+/**
+ * @file test_shadow_function.cpp
+ * @brief Test codes for shadow function with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+
+#include "../math/constants.hpp"
+#include "shadow_function.hpp"
+
+using namespace s2e::orbit;
+
+static const double kSunDistance_m = 1.496e11;
+static const double kSunRadius_m = 6.96e8;
+static const double kEarthRadius_m = 6.378e6;
+
+/**
+ * @brief Make a position of the earth seen from a spacecraft on a circular orbit in the plane including the sun direction
+ */
+static s2e::math::Vector<3> MakeEarthPosition_m(const double orbit_radius_m, const double angle_from_sun_rad) {
+  s2e::math::Vector<3> earth_position_m;
+  earth_position_m[0] = -orbit_radius_m * cos(angle_from_sun_rad);
+  earth_position_m[1] = -orbit_radius_m * sin(angle_from_sun_rad);
+  earth_position_m[2] = 0.0;
+  return earth_position_m;
+}
+
+/**
+ * @brief Test for umbra, penumbra and sunlight
+ */
+TEST(ShadowFunction, SingleBody) {
+  s2e::math::Vector<3> sun_position_m(0.0);
+  sun_position_m[0] = kSunDistance_m;
+  const double orbit_radius_m = 7.0e6;
+
+  // Sunlight side
+  ApparentDiskGeometry geometry = CalcApparentDiskGeometry(sun_position_m, kSunRadius_m, MakeEarthPosition_m(orbit_radius_m, 0.0), kEarthRadius_m);
+  EXPECT_DOUBLE_EQ(1.0, CalcShadowFunction(geometry));
+  EXPECT_GT(geometry.CalcPenumbraMargin_rad(), 0.0);
+
+  // Behind the earth
+  geometry = CalcApparentDiskGeometry(sun_position_m, kSunRadius_m, MakeEarthPosition_m(orbit_radius_m, s2e::math::pi), kEarthRadius_m);
+  EXPECT_DOUBLE_EQ(0.0, CalcShadowFunction(geometry));
+  EXPECT_LT(geometry.CalcUmbraMargin_rad(), 0.0);
+
+  // Scan the boundary. The shadow function decreases monotonically in the penumbra.
+  double previous_shadow_function = 1.0;
+  bool is_penumbra_found = false;
+  for (double angle_rad = 2.0; angle_rad < s2e::math::pi; angle_rad += 1e-4) {
+    geometry = CalcApparentDiskGeometry(sun_position_m, kSunRadius_m, MakeEarthPosition_m(orbit_radius_m, angle_rad), kEarthRadius_m);
+    const double shadow_function = CalcShadowFunction(geometry);
+    EXPECT_LE(shadow_function, previous_shadow_function + 1e-12);
+    if (shadow_function > 0.0 && shadow_function < 1.0) {
+      is_penumbra_found = true;
+      EXPECT_LT(geometry.CalcPenumbraMargin_rad(), 0.0);
+      EXPECT_GT(geometry.CalcUmbraMargin_rad(), 0.0);
+    }
+    previous_shadow_function = shadow_function;
+  }
+  EXPECT_TRUE(is_penumbra_found);
+}
+
+/**
+ * @brief Test for batched calculation with the cone test
+ */
+TEST(ShadowFunction, MultipleBodies) {
+  s2e::math::Vector<3> sun_position_m(0.0);
+  sun_position_m[0] = kSunDistance_m;
+  sun_position_m[2] = 1.0e9;
+  const double orbit_radius_m = 7.0e6;
+  const double moon_radius_m = 1.737e6;
+
+  for (double angle_rad = 0.0; angle_rad < 2.0 * s2e::math::pi; angle_rad += 1e-3) {
+    const s2e::math::Vector<3> earth_position_m = MakeEarthPosition_m(orbit_radius_m, angle_rad);
+    s2e::math::Vector<3> moon_position_m = earth_position_m;
+    moon_position_m[0] -= 3.844e8 * cos(3.0 * angle_rad);
+    moon_position_m[1] -= 3.844e8 * sin(3.0 * angle_rad);
+
+    const double expected = CalcShadowFunction(CalcApparentDiskGeometry(sun_position_m, kSunRadius_m, earth_position_m, kEarthRadius_m)) *
+                            CalcShadowFunction(CalcApparentDiskGeometry(sun_position_m, kSunRadius_m, moon_position_m, moon_radius_m));
+    const double batched = CalcShadowFunction(sun_position_m, kSunRadius_m, {earth_position_m, moon_position_m}, {kEarthRadius_m, moon_radius_m});
+    EXPECT_NEAR(expected, batched, 1e-9);
+  }
+}
+
+/**
+ * @brief Test for the prediction of the shadow events on a circular orbit compared with the scan of the shadow function
+ */
+TEST(ShadowFunction, CalcTimeToShadowEvent) {
+  const double gravity_constant_m3_s2 = 3.986004418e14;
+  const double orbit_radius_m = 7.0e6;
+  const double angular_velocity_rad_s = sqrt(gravity_constant_m3_s2 / pow(orbit_radius_m, 3.0));
+  const double period_s = 2.0 * s2e::math::pi / angular_velocity_rad_s;
+  s2e::math::Vector<3> sun_position_from_earth_m(0.0);
+  sun_position_from_earth_m[0] = kSunDistance_m;
+  sun_position_from_earth_m[2] = 3.0e10;
+
+  // Positions and velocities from the spacecraft. The sun is fixed in the earth centered frame.
+  std::vector<s2e::math::Vector<3>> earth_position_m(1);
+  std::vector<s2e::math::Vector<3>> earth_velocity_m_s(1);
+  s2e::math::Vector<3> sun_position_m;
+  auto calc_relative_states = [&](const double time_s) {
+    const double angle_rad = angular_velocity_rad_s * time_s;
+    earth_position_m[0] = MakeEarthPosition_m(orbit_radius_m, angle_rad);
+    earth_velocity_m_s[0] = MakeEarthPosition_m(orbit_radius_m * angular_velocity_rad_s, angle_rad + 0.5 * s2e::math::pi);
+    sun_position_m = sun_position_from_earth_m + earth_position_m[0];
+  };
+
+  // Scan the shadow function to find the transitions
+  std::vector<ShadowEvent> expected_events;
+  std::vector<double> expected_times_s;
+  const double scan_step_s = 0.01;
+  double previous_shadow_function = 1.0;
+  for (double time_s = 0.0; time_s < period_s; time_s += scan_step_s) {
+    calc_relative_states(time_s);
+    const double shadow_function = CalcShadowFunction(sun_position_m, kSunRadius_m, earth_position_m, {kEarthRadius_m});
+    ShadowEvent event = ShadowEvent::kNone;
+    if (previous_shadow_function == 1.0 && shadow_function < 1.0) event = ShadowEvent::kPenumbraEntry;
+    if (previous_shadow_function > 0.0 && shadow_function == 0.0) event = ShadowEvent::kUmbraEntry;
+    if (previous_shadow_function == 0.0 && shadow_function > 0.0) event = ShadowEvent::kUmbraExit;
+    if (previous_shadow_function < 1.0 && shadow_function == 1.0) event = ShadowEvent::kPenumbraExit;
+    if (event != ShadowEvent::kNone) {
+      expected_events.push_back(event);
+      expected_times_s.push_back(time_s);
+    }
+    previous_shadow_function = shadow_function;
+  }
+  ASSERT_EQ(4u, expected_events.size());
+
+  // Predict the transitions from a short time before them. The lead times are shorter than the duration of the penumbra.
+  ShadowEvent event;
+  for (size_t i = 0; i < expected_events.size(); i++) {
+    for (const double lead_time_s : {0.5, 2.0}) {
+      calc_relative_states(expected_times_s[i] - lead_time_s);
+      const double time_to_event_s = CalcTimeToShadowEvent_s(sun_position_m, earth_velocity_m_s[0], kSunRadius_m, earth_position_m,
+                                                             earth_velocity_m_s, {kEarthRadius_m}, event);
+      EXPECT_EQ(expected_events[i], event);
+      EXPECT_NEAR(lead_time_s, time_to_event_s, 2.0 * scan_step_s);
+    }
+  }
+
+  // The error of the linear extrapolation grows with the distance from the boundary
+  calc_relative_states(expected_times_s[0] - 600.0);
+  const double time_to_penumbra_entry_s = CalcTimeToShadowEvent_s(sun_position_m, earth_velocity_m_s[0], kSunRadius_m, earth_position_m,
+                                                                  earth_velocity_m_s, {kEarthRadius_m}, event);
+  EXPECT_EQ(ShadowEvent::kPenumbraEntry, event);
+  EXPECT_NEAR(600.0, time_to_penumbra_entry_s, 60.0);
+  EXPECT_GT(fabs(600.0 - time_to_penumbra_entry_s), 2.0 * scan_step_s);
+
+  // No transition is predicted without the relative motion
+  const s2e::math::Vector<3> zero_velocity_m_s(0.0);
+  EXPECT_EQ(std::numeric_limits<double>::infinity(),
+            CalcTimeToShadowEvent_s(sun_position_m, zero_velocity_m_s, kSunRadius_m, earth_position_m, {zero_velocity_m_s}, {kEarthRadius_m}, event));
+  EXPECT_EQ(ShadowEvent::kNone, event);
+}